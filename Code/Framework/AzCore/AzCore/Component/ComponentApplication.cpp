@@ -14,6 +14,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TickDispatcher.h>
 
 #include <AzCore/Debug/LocalFileEventLogger.h>
 
@@ -21,6 +22,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -46,6 +48,7 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path_fwd.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/IO/GenericStreams.h>
 
 #include <AzCore/Driller/Driller.h>
 #include <AzCore/Memory/MemoryDriller.h>
@@ -94,6 +97,47 @@ static void PrintEntityName(const AZ::ConsoleCommandContainer& arguments)
 AZ_CONSOLEFREEFUNC(
     PrintEntityName, AZ::ConsoleFunctorFlags::Null, "Parameter: EntityId value, Prints the name of the entity to the console");
 
+static void OnHeapSamplingIntervalChanged(const AZ::u64& samplingInterval)
+{
+    AZ::Debug::AllocationRecords::SetSamplingInterval(aznumeric_cast<size_t>(AZStd::GetMax(samplingInterval, AZ::u64(1))));
+}
+
+AZ_CVAR(AZ::u64, mem_heapSamplingInterval, 512 * 1024, OnHeapSamplingIntervalChanged, AZ::ConsoleFunctorFlags::Null,
+    "Average number of bytes between the allocations recorded by allocators in sampled recording mode.");
+
+static void mem_heap_profile(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty())
+    {
+        AZ_Warning("Memory", false, "Usage: mem_heap_profile <file path>");
+        return;
+    }
+
+    const AZStd::string filePath(arguments.front());
+    AZ::IO::SystemFile profileFile;
+    if (!profileFile.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY | AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH))
+    {
+        AZ_Warning("Memory", false, "Unable to open %s to write the heap profile.", filePath.c_str());
+        return;
+    }
+
+    AZ::IO::SystemFileStream profileStream(&profileFile, false);
+    if (AZ::AllocatorManager::Instance().WriteSampledHeapProfile(profileStream))
+    {
+        AZ_Printf("Memory", "Heap profile written to %s\n", filePath.c_str());
+    }
+    else
+    {
+        AZ_Warning("Memory", false, "No allocator records sampled allocations, set the recording mode to RECORD_SAMPLED.");
+    }
+}
+
+AZ_CONSOLEFREEFUNC(mem_heap_profile, AZ::ConsoleFunctorFlags::Null,
+    "Writes the sampled allocations of the allocators in sampled recording mode as a pprof heap profile. Usage: mem_heap_profile <file path>");
+
+AZ_CVAR(bool, sys_parallelTick, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Tick TickBus handlers that declare their tick access in parallel on the job system. Off by default, when disabled all handlers are ticked on the main thread.");
+
 namespace AZ
 {
     static EnvironmentVariable<OverrunDetectionSchema> s_overrunDetectionSchema;
@@ -327,7 +371,8 @@ namespace AZ
                     ->Value("No records", Debug::AllocationRecords::RECORD_NO_RECORDS)
                     ->Value("No stack trace", Debug::AllocationRecords::RECORD_STACK_NEVER)
                     ->Value("Stack trace when file/line missing", Debug::AllocationRecords::RECORD_STACK_IF_NO_FILE_LINE)
-                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL);
+                    ->Value("Stack trace always", Debug::AllocationRecords::RECORD_FULL)
+                    ->Value("Sampled stack traces", Debug::AllocationRecords::RECORD_SAMPLED);
                 ec->Class<Descriptor>("System memory settings", "Settings for managing application memory usage")
                     ->ClassElement(Edit::ClassElements::EditorData, "")
                         ->Attribute(Edit::Attributes::AutoExpand, true)
@@ -439,6 +484,7 @@ namespace AZ
         // Initializes the OSAllocator and SystemAllocator as soon as possible
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
         // Now that the Allocators are initialized, the Command Line parameters can be parsed
         m_commandLine.Parse(m_argC, m_argV);
@@ -592,6 +638,7 @@ namespace AZ
         // to use supplied startupParameters and descriptor parameters this time
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
         // This can be moved to the ComponentApplication constructor if need be
         // This is reading the *.setreg files using SystemFile and merging the settings
@@ -766,6 +813,12 @@ namespace AZ
 
     void ComponentApplication::DestroyAllocator()
     {
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         // kill the system allocator if we created it
         if (m_isSystemAllocatorOwner)
         {
@@ -960,11 +1013,33 @@ namespace AZ
         //!    3. <project_build_path>/bin/$<CONFIG>/Registry
         //! 3. MergeSettingsToRegistry_GemRegistries - Merges the settings registry files from each gem's <GemRoot>/Registry directory
 
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
-            AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
-        SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+        //! When a snapshot path is configured, the result of merging the engine, gem and project registry files is restored
+        //! from a binary snapshot if the registry is in the same state as when the snapshot was written and none of the
+        //! merged files changed. Otherwise the files are merged as usual and the snapshot is rewritten.
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        SettingsRegistryInterface::FixedValueString snapshotPath;
+        const bool useSnapshot = registryImpl != nullptr
+            && registry.Get(snapshotPath, SettingsRegistryMergeUtils::RegistrySnapshotPathKey) && !snapshotPath.empty();
+        u64 snapshotKey = 0;
+        size_t snapshotHistoryStart = 0;
+        if (useSnapshot)
+        {
+            snapshotKey = registryImpl->GetSnapshotKey(specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            snapshotHistoryStart = registryImpl->GetFileHistoryCount();
+        }
+
+        if (!useSnapshot || !registryImpl->LoadSnapshot(snapshotPath.c_str(), snapshotKey))
+        {
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_TargetBuildDependencyRegistry(registry,
+                AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_EngineRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_GemRegistries(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_ProjectRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
+            if (useSnapshot)
+            {
+                registryImpl->SaveSnapshot(snapshotPath.c_str(), snapshotKey, snapshotHistoryStart, AZ_TRAIT_OS_PLATFORM_CODENAME);
+            }
+        }
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_O3deUserRegistry(registry, AZ_TRAIT_OS_PLATFORM_CODENAME, specializations, &scratchBuffer);
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
@@ -1386,6 +1461,19 @@ namespace AZ
 #endif
     }
 
+    //=========================================================================
+    // CreateFrameArenaAllocator
+    //=========================================================================
+    void ComponentApplication::CreateFrameArenaAllocator()
+    {
+        if (!AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            // pages come from the SystemAllocator
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_isFrameArenaAllocatorOwner = true;
+        }
+    }
+
     //=========================================================================
     // Tick
     //=========================================================================
@@ -1395,6 +1483,12 @@ namespace AZ
             AZ_PROFILE_TIMER("System", "Component application simulation tick function");
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+            // The previous frame is over, release its scratch memory before anything of this frame runs.
+            if (AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+            {
+                static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            }
+
             AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
 
             m_deltaTime = 0.0f;
@@ -1412,7 +1506,8 @@ namespace AZ
             m_currentTime = now;
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "ComponentApplication::Tick:OnTick");
-                EBUS_EVENT(TickBus, OnTick, m_deltaTime, ScriptTimePoint(now));
+                m_tickDispatcher.SetParallelTickEnabled(sys_parallelTick);
+                m_tickDispatcher.Tick(m_deltaTime, ScriptTimePoint(now));
             }
         }
         if (m_drillerManager)
@@ -10,6 +10,7 @@
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TickDispatcher.h>
 #include <AzCore/Debug/ProfileModuleInit.h>
 #include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/OSAllocator.h>
@@ -324,6 +325,9 @@ namespace AZ
         /// Create the system allocator using the data in the m_descriptor
         void        CreateSystemAllocator();
 
+        /// Create the frame arena allocator, which is reset at the start of every Tick
+        void        CreateFrameArenaAllocator();
+
         /// Create the drillers
         void        CreateDrillers();
 
@@ -388,6 +392,7 @@ namespace AZ
         bool                                        m_isStarted{ false };
         bool                                        m_isSystemAllocatorOwner{ false };
         bool                                        m_isOSAllocatorOwner{ false };
+        bool                                        m_isFrameArenaAllocatorOwner{ false };
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocatorAllocate*                         m_osAllocator{ nullptr };
@@ -411,6 +416,8 @@ namespace AZ
 
         Debug::DrillerManager*                      m_drillerManager{ nullptr };
 
+        TickDispatcher                              m_tickDispatcher;
+
         StartupParameters                           m_startupParameters;
 
         char**                                      m_argV{ nullptr };
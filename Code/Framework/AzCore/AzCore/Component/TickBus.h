@@ -16,7 +16,10 @@
 
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/Debug/AssetTracking.h>
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/parallel/mutex.h> // For TickBus thread events.
 #include <AzCore/Script/ScriptTimePoint.h>
 
@@ -52,7 +55,45 @@ namespace AZ
         TICK_LAST           = 100000,  ///< Last position in the tick handler order.
     };
 
-        
+
+    /**
+     * Describes the data a tick handler reads and writes in OnTick.
+     * Data is identified by a name picked by the systems that own it, for instance AZ_CRC_CE("TransformData").
+     * Handlers with the same tick order form a tick phase, and handlers in a phase whose access doesn't conflict
+     * are ticked in parallel on the job system. See TickEvents::GetTickAccess.
+     */
+    struct TickAccess
+    {
+        static constexpr size_t MaxEntries = 8;
+
+        AZStd::fixed_vector<Crc32, MaxEntries> m_reads;
+        AZStd::fixed_vector<Crc32, MaxEntries> m_writes;
+
+        /**
+         * Returns true if the two handlers can't run at the same time, which is the case if either of them writes
+         * data the other reads or writes.
+         */
+        bool ConflictsWith(const TickAccess& other) const
+        {
+            for (Crc32 write : m_writes)
+            {
+                if (AZStd::find(other.m_reads.begin(), other.m_reads.end(), write) != other.m_reads.end() ||
+                    AZStd::find(other.m_writes.begin(), other.m_writes.end(), write) != other.m_writes.end())
+                {
+                    return true;
+                }
+            }
+            for (Crc32 write : other.m_writes)
+            {
+                if (AZStd::find(m_reads.begin(), m_reads.end(), write) != m_reads.end())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+
     /**
      * Interface for AZ::TickBus, which is the EBus that dispatches tick events.
      * These tick events are executed on the main game thread. In games, AZ::TickBus
@@ -137,6 +178,24 @@ namespace AZ
             return m_tickOrder;
         }
 
+        /**
+         * Opts the handler in to parallel ticking.
+         * By default handlers receive OnTick on the main thread, one after another in tick order. A handler that returns true
+         * and fills in the data it accesses is instead ticked on a job thread, concurrently with the other opted in handlers
+         * that have the same tick order and don't conflict with it. Conflicting handlers in the same phase are still ticked
+         * in the order they're connected. Handlers that don't opt in are never ticked concurrently with any other handler,
+         * so the ordering relative to them is unchanged.
+         * Parallel handlers must not connect to or disconnect from the TickBus, or any other bus that isn't thread safe,
+         * from OnTick. Use TickBus::QueueFunction to defer such work to the next tick.
+         * This is called once per tick, so the access can change between ticks.
+         * @param access Receives the data the handler reads and writes in OnTick.
+         * @return True if the handler can be ticked in parallel, false to tick it on the main thread.
+         */
+        virtual bool GetTickAccess([[maybe_unused]] TickAccess& access)
+        {
+            return false;
+        }
+
     protected:
         // Only the component application is allowed to issue ticks.
         friend class ComponentApplication;
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/TickDispatcher.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    void TickDispatcher::SetParallelTickEnabled(bool enabled)
+    {
+        m_parallelTickEnabled = enabled;
+    }
+
+    bool TickDispatcher::IsParallelTickEnabled() const
+    {
+        return m_parallelTickEnabled;
+    }
+
+    void TickDispatcher::SetJobContext(JobContext* context)
+    {
+        m_jobContext = context;
+    }
+
+    void TickDispatcher::Tick(float deltaTime, ScriptTimePoint time)
+    {
+        if (!m_parallelTickEnabled)
+        {
+            TickBus::Broadcast(&TickEvents::OnTick, deltaTime, time);
+            return;
+        }
+
+        TickBus::EnumerateHandlers([this, deltaTime, &time](TickEvents* handler)
+            {
+                int tickOrder = handler->GetTickOrder();
+                TickAccess access;
+                if (handler->GetTickAccess(access))
+                {
+                    if (!m_phase.empty() && tickOrder != m_phaseTickOrder)
+                    {
+                        FlushPhase(deltaTime, time);
+                    }
+                    AddToPhase(handler, tickOrder, access);
+                }
+                else
+                {
+                    // Handlers that didn't opt in keep their place in the tick order, so everything before them has to finish first.
+                    FlushPhase(deltaTime, time);
+                    TickHandler(handler, deltaTime, time);
+                }
+                return true;
+            });
+        FlushPhase(deltaTime, time);
+    }
+
+    void TickDispatcher::TickHandler(TickEvents* handler, float deltaTime, ScriptTimePoint time)
+    {
+        // Go through the bus's processing policy like a broadcast does, so the asset tracking scope of the handler is
+        // entered on the thread that ticks it.
+        TickEvents::EventProcessingPolicy::Call(&TickEvents::OnTick, handler, deltaTime, time);
+    }
+
+    void TickDispatcher::AddToPhase(TickEvents* handler, int tickOrder, const TickAccess& access)
+    {
+        if (m_phase.empty())
+        {
+            m_phaseTickOrder = tickOrder;
+            m_numWaves = 0;
+            m_dataStates.clear();
+        }
+
+        // A handler has to be ticked in a later wave than every earlier handler in the phase it conflicts with.
+        u32 wave = 0;
+        for (Crc32 read : access.m_reads)
+        {
+            auto it = m_dataStates.find(read);
+            if (it != m_dataStates.end() && it->second.m_hasWrite)
+            {
+                wave = AZStd::max(wave, it->second.m_lastWriteWave + 1);
+            }
+        }
+        for (Crc32 write : access.m_writes)
+        {
+            auto it = m_dataStates.find(write);
+            if (it != m_dataStates.end())
+            {
+                if (it->second.m_hasWrite)
+                {
+                    wave = AZStd::max(wave, it->second.m_lastWriteWave + 1);
+                }
+                if (it->second.m_hasRead)
+                {
+                    wave = AZStd::max(wave, it->second.m_lastReadWave + 1);
+                }
+            }
+        }
+
+        for (Crc32 read : access.m_reads)
+        {
+            DataState& state = m_dataStates[read];
+            state.m_lastReadWave = state.m_hasRead ? AZStd::max(state.m_lastReadWave, wave) : wave;
+            state.m_hasRead = true;
+        }
+        for (Crc32 write : access.m_writes)
+        {
+            DataState& state = m_dataStates[write];
+            state.m_lastWriteWave = wave;
+            state.m_hasWrite = true;
+        }
+
+        m_phase.push_back(PhaseHandler{ handler, access, wave });
+        m_numWaves = AZStd::max(m_numWaves, wave + 1);
+    }
+
+    void TickDispatcher::FlushPhase(float deltaTime, ScriptTimePoint time)
+    {
+        if (m_phase.empty())
+        {
+            return;
+        }
+
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "TickDispatcher::FlushPhase");
+
+        JobContext* jobContext = m_jobContext ? m_jobContext : JobContext::GetGlobalContext();
+
+        if (m_numWaves > 1)
+        {
+            // Group the handlers per wave while keeping the order they were connected in.
+            AZStd::stable_sort(m_phase.begin(), m_phase.end(),
+                [](const PhaseHandler& lhs, const PhaseHandler& rhs)
+                {
+                    return lhs.m_wave < rhs.m_wave;
+                });
+        }
+
+        PhaseHandler* waveBegin = m_phase.data();
+        PhaseHandler* phaseEnd = m_phase.data() + m_phase.size();
+        while (waveBegin != phaseEnd)
+        {
+            PhaseHandler* waveEnd = waveBegin + 1;
+            while (waveEnd != phaseEnd && waveEnd->m_wave == waveBegin->m_wave)
+            {
+                ++waveEnd;
+            }
+            TickWave(waveBegin, waveEnd, deltaTime, time, jobContext);
+            waveBegin = waveEnd;
+        }
+
+        m_phase.clear();
+    }
+
+    void TickDispatcher::TickWave(PhaseHandler* begin, PhaseHandler* end, float deltaTime, ScriptTimePoint time, JobContext* jobContext)
+    {
+        size_t numHandlers = end - begin;
+        size_t numWorkers = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        if (numHandlers == 1 || numWorkers == 0)
+        {
+            for (PhaseHandler* handler = begin; handler != end; ++handler)
+            {
+                TickHandler(handler->m_handler, deltaTime, time);
+            }
+            return;
+        }
+
+        // Handlers are split in batches to keep the job overhead low when there are many small handlers. The calling
+        // thread ticks the first batch itself instead of waiting idle.
+        size_t numBatches = AZStd::min(numHandlers, numWorkers + 1);
+        size_t batchSize = (numHandlers + numBatches - 1) / numBatches;
+
+        JobCompletion completion(jobContext);
+        for (size_t batchStart = batchSize; batchStart < numHandlers; batchStart += batchSize)
+        {
+            PhaseHandler* batchBegin = begin + batchStart;
+            PhaseHandler* batchEnd = begin + AZStd::min(batchStart + batchSize, numHandlers);
+            auto tickBatch = [batchBegin, batchEnd, deltaTime, time]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "TickDispatcher::TickBatch");
+                for (PhaseHandler* handler = batchBegin; handler != batchEnd; ++handler)
+                {
+                    TickHandler(handler->m_handler, deltaTime, time);
+                }
+            };
+            Job* job = CreateJobFunction(tickBatch, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+
+        for (PhaseHandler* handler = begin; handler != begin + batchSize; ++handler)
+        {
+            TickHandler(handler->m_handler, deltaTime, time);
+        }
+        completion.StartAndWaitForCompletion();
+    }
+} // namespace AZ
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    class JobContext;
+
+    /**
+     * Sends OnTick to all TickBus handlers.
+     * Handlers that don't provide their TickAccess are ticked on the calling thread in tick order, the same way
+     * a broadcast on the TickBus does. Handlers that do are collected per tick order into a phase, which is split
+     * into waves of handlers without conflicting access. The handlers in a wave are ticked in parallel on the job
+     * system and the waves of a phase run one after another.
+     */
+    class TickDispatcher
+    {
+    public:
+        //! Enables or disables parallel ticking, disabled by default. When disabled all handlers are ticked on the calling thread.
+        void SetParallelTickEnabled(bool enabled);
+        bool IsParallelTickEnabled() const;
+
+        //! Sets the job context used for parallel handlers. If not set, the global job context is used.
+        void SetJobContext(JobContext* context);
+
+        void Tick(float deltaTime, ScriptTimePoint time);
+
+    private:
+        struct PhaseHandler
+        {
+            TickEvents* m_handler;
+            TickAccess m_access;
+            u32 m_wave;
+        };
+
+        struct DataState
+        {
+            u32 m_lastWriteWave{ 0 };
+            u32 m_lastReadWave{ 0 };
+            bool m_hasWrite{ false };
+            bool m_hasRead{ false };
+        };
+
+        static void TickHandler(TickEvents* handler, float deltaTime, ScriptTimePoint time);
+        void AddToPhase(TickEvents* handler, int tickOrder, const TickAccess& access);
+        void FlushPhase(float deltaTime, ScriptTimePoint time);
+        void TickWave(PhaseHandler* begin, PhaseHandler* end, float deltaTime, ScriptTimePoint time, JobContext* jobContext);
+
+        AZStd::vector<PhaseHandler> m_phase;
+        AZStd::unordered_map<Crc32, DataState> m_dataStates;
+        JobContext* m_jobContext{ nullptr };
+        int m_phaseTickOrder{ 0 };
+        u32 m_numWaves{ 0 };
+        bool m_parallelTickEnabled{ false };
+    };
+} // namespace AZ
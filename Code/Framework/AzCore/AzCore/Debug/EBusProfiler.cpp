@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/EBusProfiler.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/EBus/Environment.h>
+#include <AzCore/Module/Environment.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzCore/std/time.h>
+
+#include <inttypes.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace
+        {
+            struct EBusEventKey
+            {
+                bool operator==(const EBusEventKey& rhs) const
+                {
+                    return m_busName == rhs.m_busName && m_eventId == rhs.m_eventId;
+                }
+
+                const char* m_busName;
+                AZ::u64 m_eventId;
+            };
+
+            struct EBusEventKeyHash
+            {
+                size_t operator()(const EBusEventKey& key) const
+                {
+                    size_t hash = 0;
+                    AZStd::hash_combine(hash, reinterpret_cast<uintptr_t>(key.m_busName), key.m_eventId);
+                    return hash;
+                }
+            };
+
+            using EBusProfilerString = AZStd::basic_string<char, AZStd::char_traits<char>, EBusEnvironmentAllocator>;
+
+            struct EBusEventRecord
+            {
+                // The names are copied, the dispatching module may be unloaded before the statistics are reported.
+                EBusProfilerString m_busName;
+                EBusProfilerString m_eventSignature;
+                AZ::u64 m_numDispatches[3] = {}; // Indexed by EBusDispatchType.
+                AZ::u64 m_numHandlersVisited = 0;
+                AZ::s64 m_totalTicks = 0;
+                AZ::s64 m_selfTicks = 0;
+                AZ::s64 m_maxTicks = 0;
+                Debug::ProfilerRegister* m_register = nullptr;
+                AZ::u64 m_profilerId = 0;
+            };
+
+            using EBusEventRecords = AZStd::unordered_map<EBusEventKey, EBusEventRecord, EBusEventKeyHash, AZStd::equal_to<EBusEventKey>, EBusEnvironmentAllocator>;
+
+            // The records are kept per thread so recording a dispatch never waits for other threads.
+            struct EBusProfilerThreadData
+            {
+                AZStd::mutex m_mutex; ///< Only contended while the statistics are read or reset.
+                EBusEventRecords m_records;
+            };
+
+            // Shared by all modules through the environment, so the profiler is started and stopped for all of them.
+            struct EBusProfilerState
+            {
+                ~EBusProfilerState()
+                {
+                    EBusEnvironmentAllocator allocator;
+                    for (EBusProfilerThreadData* threadData : m_threads)
+                    {
+                        threadData->~EBusProfilerThreadData();
+                        allocator.deallocate(threadData, sizeof(EBusProfilerThreadData), alignof(EBusProfilerThreadData));
+                    }
+                }
+
+                AZStd::atomic_bool m_isRunning{ false };
+                AZStd::mutex m_threadsMutex;
+                AZStd::vector<EBusProfilerThreadData*, EBusEnvironmentAllocator> m_threads;
+            };
+
+            static EnvironmentVariable<EBusProfilerState> s_ebusProfilerState;
+            static const char* s_ebusProfilerStateName = "EBusProfilerState";
+
+            EBusProfilerState* GetProfilerState()
+            {
+                if (!s_ebusProfilerState && Environment::IsReady())
+                {
+                    s_ebusProfilerState = Environment::CreateVariable<EBusProfilerState>(s_ebusProfilerStateName);
+                }
+                return s_ebusProfilerState.IsConstructed() ? &s_ebusProfilerState.Get() : nullptr;
+            }
+
+            EBusProfilerThreadData& GetThreadData(EBusProfilerState& state)
+            {
+                thread_local static EBusProfilerState* s_owner = nullptr;
+                thread_local static EBusProfilerThreadData* s_threadData = nullptr;
+                if (s_owner != &state)
+                {
+                    EBusEnvironmentAllocator allocator;
+                    void* memory = allocator.allocate(sizeof(EBusProfilerThreadData), alignof(EBusProfilerThreadData));
+                    s_threadData = new (memory) EBusProfilerThreadData();
+                    s_owner = &state;
+
+                    AZStd::scoped_lock lock(state.m_threadsMutex);
+                    state.m_threads.push_back(s_threadData);
+                }
+                return *s_threadData;
+            }
+
+            // Set while a dispatch is recorded, so dispatches caused by the bookkeeping itself are not measured.
+            bool& IsRecordingFlag()
+            {
+                thread_local static bool s_isRecording = false;
+                return s_isRecording;
+            }
+
+            AZ::u64 TicksToNanoseconds(AZ::s64 ticks)
+            {
+                static const double s_nanosecondsPerTick = 1e9 / static_cast<double>(AZStd::GetTimeTicksPerSecond());
+                return static_cast<AZ::u64>(static_cast<double>(ticks) * s_nanosecondsPerTick);
+            }
+
+            // Returns the text between the balanced brackets starting at open, without the brackets.
+            AZStd::string_view GetBracketed(AZStd::string_view text, size_t open)
+            {
+                const char openChar = text[open];
+                const char closeChar = openChar == '<' ? '>' : (openChar == '{' ? '}' : ']');
+                int depth = 0;
+                for (size_t i = open; i < text.size(); ++i)
+                {
+                    if (text[i] == openChar)
+                    {
+                        ++depth;
+                    }
+                    else if (text[i] == closeChar && --depth == 0)
+                    {
+                        return text.substr(open + 1, i - open - 1);
+                    }
+                }
+                return text.substr(open + 1);
+            }
+
+            // Returns the text up to the first separator that's not nested in brackets.
+            AZStd::string_view GetUntilSeparator(AZStd::string_view text, AZStd::string_view separators)
+            {
+                int depth = 0;
+                for (size_t i = 0; i < text.size(); ++i)
+                {
+                    const char c = text[i];
+                    if (c == '<' || c == '(' || c == '{' || c == '[')
+                    {
+                        ++depth;
+                    }
+                    else if ((c == '>' || c == ')' || c == '}' || c == ']') && depth > 0)
+                    {
+                        --depth;
+                    }
+                    else if (depth == 0 && separators.find(c) != AZStd::string_view::npos)
+                    {
+                        return text.substr(0, i);
+                    }
+                }
+                return text;
+            }
+
+            AZStd::string RemoveTypeKeywords(AZStd::string_view text)
+            {
+                AZStd::string result(text);
+                for (const char* keyword : { "class ", "struct ", "__cdecl " })
+                {
+                    for (size_t pos = result.find(keyword); pos != AZStd::string::npos; pos = result.find(keyword, pos))
+                    {
+                        result.erase(pos, strlen(keyword));
+                    }
+                }
+                return result;
+            }
+
+            // Returns the first template argument of a function signature produced by AZ_FUNCTION_SIGNATURE, which is
+            // formatted as "Function() [with First = ...; ...]" by GCC, "Function() [First = ...]" by Clang and
+            // "Function<...>(void)" or "Class<...>::Function(void)" by MSVC.
+            AZStd::string GetFirstTemplateArgument(AZStd::string_view signature, AZStd::string_view templateName)
+            {
+                const size_t argumentsStart = signature.rfind('[');
+                if (argumentsStart != AZStd::string_view::npos)
+                {
+                    AZStd::string_view arguments = GetBracketed(signature, argumentsStart);
+                    const size_t valueStart = arguments.find(" = ");
+                    if (valueStart != AZStd::string_view::npos)
+                    {
+                        return RemoveTypeKeywords(GetUntilSeparator(arguments.substr(valueStart + 3), ";,"));
+                    }
+                }
+
+                const size_t templateStart = signature.find(templateName);
+                if (templateStart != AZStd::string_view::npos)
+                {
+                    AZStd::string_view arguments = GetBracketed(signature, templateStart + templateName.size() - 1);
+                    return RemoveTypeKeywords(GetUntilSeparator(arguments, ","));
+                }
+                return AZStd::string(signature);
+            }
+
+            AZStd::string GetBusDisplayName(const char* busName)
+            {
+                AZStd::string_view signature(busName);
+                if (signature.find("EBus<") != AZStd::string_view::npos)
+                {
+                    return GetFirstTemplateArgument(signature, "EBus<");
+                }
+                if (const size_t eventStart = signature.find("Event<"); eventStart != AZStd::string_view::npos)
+                {
+                    // AZ::Event signals, name them after the event type.
+                    const size_t packStart = signature.rfind("= {");
+                    AZStd::string_view parameters = packStart != AZStd::string_view::npos
+                        ? GetBracketed(signature, packStart + 2)
+                        : GetBracketed(signature, eventStart + 5);
+                    return AZStd::string::format("AZ::Event<%s>", RemoveTypeKeywords(parameters).c_str());
+                }
+                return AZStd::string(signature);
+            }
+
+            AZStd::string GetEventDisplayName(const char* eventSignature, AZ::u64 eventId)
+            {
+                AZStd::string name = GetFirstTemplateArgument(eventSignature, "GetEventSignature<");
+                if (eventId != 0)
+                {
+                    // Events of a bus often have the same signature, the id tells them apart.
+                    name += AZStd::string::format(" #%016" PRIx64, eventId);
+                }
+                return name;
+            }
+        } // namespace
+
+        const AZStd::atomic_bool* EBusDispatchScope::FindIsRunning()
+        {
+            EBusProfilerState* state = GetProfilerState();
+            if (!state)
+            {
+                return nullptr;
+            }
+            // The state is kept alive by this module's reference to the environment variable, so the pointer stays valid.
+            s_isRunning.store(&state->m_isRunning, AZStd::memory_order_relaxed);
+            return &state->m_isRunning;
+        }
+
+        bool EBusDispatchScope::IsRecording()
+        {
+            return IsRecordingFlag();
+        }
+
+        void EBusDispatchScope::Begin(const char* busName, Debug::EBusDispatchType type, AZ::u64 eventId, const char* eventSignature)
+        {
+            EBusDispatchScope*& current = GetCurrent();
+            m_parent = current;
+            current = this;
+
+            m_busName = busName;
+            m_eventSignature = eventSignature;
+            m_eventId = eventId;
+            m_type = type;
+            m_isActive = true;
+            m_startTicks = AZStd::GetTimeNowTicks();
+        }
+
+        void EBusDispatchScope::End()
+        {
+            const AZ::s64 ticks = AZStd::GetTimeNowTicks() - m_startTicks;
+            const AZ::s64 selfTicks = ticks - m_childTicks;
+
+            GetCurrent() = m_parent;
+            if (m_parent)
+            {
+                m_parent->m_childTicks += ticks;
+            }
+
+            EBusProfilerState* state = GetProfilerState();
+            if (!state)
+            {
+                return;
+            }
+
+            IsRecordingFlag() = true;
+
+            EBusProfilerThreadData& threadData = GetThreadData(*state);
+            EBusEventRecord* record = nullptr;
+            {
+                AZStd::scoped_lock lock(threadData.m_mutex);
+                record = &threadData.m_records[EBusEventKey{ m_busName, m_eventId }];
+                if (record->m_busName.empty())
+                {
+                    record->m_busName = m_busName;
+                    record->m_eventSignature = m_eventSignature;
+                }
+                record->m_numDispatches[static_cast<size_t>(m_type)]++;
+                record->m_numHandlersVisited += m_numHandlersVisited;
+                record->m_totalTicks += ticks;
+                record->m_selfTicks += selfTicks;
+                record->m_maxTicks = AZStd::max(record->m_maxTicks, ticks);
+            }
+
+            // Records are only inserted by the owning thread, so the record stays valid outside of the lock.
+            if (const AZ::u64 profilerId = Debug::Profiler::GetId())
+            {
+                if (record->m_profilerId != profilerId)
+                {
+                    record->m_register = Debug::ProfilerRegister::ValueCreate("EBus", record->m_busName.c_str(), record->m_eventSignature.c_str(), 0);
+                    record->m_profilerId = profilerId;
+                }
+                record->m_register->ValueAdd(1, aznumeric_cast<AZ::s64>(m_numHandlersVisited),
+                    aznumeric_cast<AZ::s64>(TicksToNanoseconds(ticks)), aznumeric_cast<AZ::s64>(TicksToNanoseconds(selfTicks)));
+            }
+
+            IsRecordingFlag() = false;
+        }
+    } // namespace Internal
+
+    namespace Debug
+    {
+        void EBusProfiler::Start()
+        {
+#if AZ_EBUS_PROFILER_ENABLED
+            if (Internal::EBusProfilerState* state = Internal::GetProfilerState())
+            {
+                state->m_isRunning = true;
+            }
+#else
+            AZ_Warning("EBusProfiler", false, "EBus dispatches are not instrumented, build with AZ_EBUS_PROFILER_ENABLED to profile them.");
+#endif
+        }
+
+        void EBusProfiler::Stop()
+        {
+            if (Internal::EBusProfilerState* state = Internal::GetProfilerState())
+            {
+                state->m_isRunning = false;
+            }
+        }
+
+        bool EBusProfiler::IsRunning()
+        {
+            Internal::EBusProfilerState* state = Internal::GetProfilerState();
+            return state && state->m_isRunning;
+        }
+
+        void EBusProfiler::Reset()
+        {
+            Internal::EBusProfilerState* state = Internal::GetProfilerState();
+            if (!state)
+            {
+                return;
+            }
+
+            AZStd::scoped_lock threadsLock(state->m_threadsMutex);
+            for (Internal::EBusProfilerThreadData* threadData : state->m_threads)
+            {
+                // The records are cleared instead of erased, so the owning threads can keep using them.
+                AZStd::scoped_lock lock(threadData->m_mutex);
+                for (auto& recordIt : threadData->m_records)
+                {
+                    Internal::EBusEventRecord& record = recordIt.second;
+                    AZStd::fill(AZStd::begin(record.m_numDispatches), AZStd::end(record.m_numDispatches), AZ::u64(0));
+                    record.m_numHandlersVisited = 0;
+                    record.m_totalTicks = 0;
+                    record.m_selfTicks = 0;
+                    record.m_maxTicks = 0;
+                }
+            }
+        }
+
+        AZStd::vector<EBusDispatchStats> EBusProfiler::GetStats()
+        {
+            AZStd::vector<EBusDispatchStats> stats;
+            Internal::EBusProfilerState* state = Internal::GetProfilerState();
+            if (!state)
+            {
+                return stats;
+            }
+
+            // Copy the records first, so no locks are held while the names are formatted.
+            struct RecordCopy
+            {
+                Internal::EBusEventKey m_key;
+                Internal::EBusEventRecord m_record;
+            };
+            AZStd::vector<RecordCopy> records;
+            {
+                AZStd::scoped_lock threadsLock(state->m_threadsMutex);
+                for (Internal::EBusProfilerThreadData* threadData : state->m_threads)
+                {
+                    AZStd::scoped_lock lock(threadData->m_mutex);
+                    for (const auto& recordIt : threadData->m_records)
+                    {
+                        records.push_back({ recordIt.first, recordIt.second });
+                    }
+                }
+            }
+
+            // The same bus has a different name pointer in every module and every thread has its own records, so
+            // merge them by name.
+            AZStd::unordered_map<AZStd::string, size_t> statsIndices;
+            for (const RecordCopy& copy : records)
+            {
+                const Internal::EBusEventRecord& record = copy.m_record;
+                AZ::u64 numDispatches = record.m_numDispatches[0] + record.m_numDispatches[1] + record.m_numDispatches[2];
+                if (numDispatches == 0)
+                {
+                    continue;
+                }
+
+                AZStd::string busName = Internal::GetBusDisplayName(record.m_busName.c_str());
+                AZStd::string eventName = Internal::GetEventDisplayName(record.m_eventSignature.c_str(), copy.m_key.m_eventId);
+                AZStd::string key = busName + "::" + eventName;
+                auto indexIt = statsIndices.find(key);
+                if (indexIt == statsIndices.end())
+                {
+                    indexIt = statsIndices.emplace(AZStd::move(key), stats.size()).first;
+                    EBusDispatchStats& entry = stats.emplace_back();
+                    entry.m_busName = AZStd::move(busName);
+                    entry.m_eventName = AZStd::move(eventName);
+                }
+
+                EBusDispatchStats& entry = stats[indexIt->second];
+                entry.m_numEvents += record.m_numDispatches[static_cast<size_t>(EBusDispatchType::Event)];
+                entry.m_numBroadcasts += record.m_numDispatches[static_cast<size_t>(EBusDispatchType::Broadcast)];
+                entry.m_numEnumerations += record.m_numDispatches[static_cast<size_t>(EBusDispatchType::Enumerate)];
+                entry.m_numHandlersVisited += record.m_numHandlersVisited;
+                entry.m_totalTimeUs += Internal::TicksToNanoseconds(record.m_totalTicks) / 1000;
+                entry.m_selfTimeUs += Internal::TicksToNanoseconds(record.m_selfTicks) / 1000;
+                entry.m_maxTimeUs = AZStd::max(entry.m_maxTimeUs, Internal::TicksToNanoseconds(record.m_maxTicks) / 1000);
+            }
+
+            AZStd::sort(stats.begin(), stats.end(),
+                [](const EBusDispatchStats& lhs, const EBusDispatchStats& rhs)
+                {
+                    return lhs.m_selfTimeUs > rhs.m_selfTimeUs;
+                });
+            return stats;
+        }
+
+        void EBusProfiler::PrintReport(size_t maxEvents)
+        {
+            AZStd::vector<EBusDispatchStats> stats = GetStats();
+            AZ_Printf("EBusProfiler", "%zu profiled events%s, showing the %zu with the highest self time.\n",
+                stats.size(), IsRunning() ? "" : " (profiler is stopped)", AZStd::min(maxEvents, stats.size()));
+            AZ_Printf("EBusProfiler", "%12s %12s %8s %12s %12s %10s  %s\n",
+                "dispatches", "handlers", "fan-out", "self (us)", "total (us)", "max (us)", "event");
+            for (size_t i = 0; i < AZStd::min(maxEvents, stats.size()); ++i)
+            {
+                const EBusDispatchStats& entry = stats[i];
+                const AZ::u64 numDispatches = entry.GetNumDispatches();
+                AZ_Printf("EBusProfiler", "%12" PRIu64 " %12" PRIu64 " %8.1f %12" PRIu64 " %12" PRIu64 " %10" PRIu64 "  %s %s\n",
+                    numDispatches, entry.m_numHandlersVisited,
+                    static_cast<double>(entry.m_numHandlersVisited) / static_cast<double>(numDispatches),
+                    entry.m_selfTimeUs, entry.m_totalTimeUs, entry.m_maxTimeUs,
+                    entry.m_busName.c_str(), entry.m_eventName.c_str());
+            }
+        }
+
+        static void ebus_profiler(const AZ::ConsoleCommandContainer& arguments)
+        {
+            constexpr size_t DefaultReportSize = 20;
+            const AZStd::string_view command = arguments.empty() ? AZStd::string_view("report") : arguments.front();
+            if (command == "start")
+            {
+                EBusProfiler::Start();
+            }
+            else if (command == "stop")
+            {
+                EBusProfiler::Stop();
+            }
+            else if (command == "reset")
+            {
+                EBusProfiler::Reset();
+            }
+            else if (command == "report")
+            {
+                size_t maxEvents = DefaultReportSize;
+                if (arguments.size() > 1)
+                {
+                    maxEvents = aznumeric_cast<size_t>(AZStd::stoull(AZStd::string(arguments[1])));
+                }
+                EBusProfiler::PrintReport(maxEvents);
+            }
+            else
+            {
+                AZ_Warning("EBusProfiler", false, "Unknown ebus_profiler command '%.*s'.", AZ_STRING_ARG(command));
+            }
+        }
+
+        AZ_CONSOLEFREEFUNC(ebus_profiler, AZ::ConsoleFunctorFlags::Null,
+            "Profiles EBus and AZ::Event dispatches. Usage: ebus_profiler start|stop|reset|report [number of events, default 20]");
+    } // namespace Debug
+} // namespace AZ
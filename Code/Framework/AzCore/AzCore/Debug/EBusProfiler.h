@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/EBus/Internal/DispatchProfiler.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace Debug
+    {
+        //! Dispatch statistics of a single event function of an EBus or AZ::Event.
+        struct EBusDispatchStats
+        {
+            AZStd::string m_busName;        ///< Interface of the EBus, or the AZ::Event type.
+            AZStd::string m_eventName;      ///< Signature of the event function, followed by its id to tell events with the same signature apart.
+            AZ::u64 m_numEvents = 0;        ///< Number of Event calls, sent to a single address.
+            AZ::u64 m_numBroadcasts = 0;    ///< Number of Broadcast calls and AZ::Event signals.
+            AZ::u64 m_numEnumerations = 0;  ///< Number of EnumerateHandlers calls.
+            AZ::u64 m_numHandlersVisited = 0;
+            AZ::u64 m_totalTimeUs = 0;      ///< Time of all dispatches, including the time of the dispatches they caused.
+            AZ::u64 m_selfTimeUs = 0;       ///< Time of all dispatches, excluding the time of the dispatches they caused.
+            AZ::u64 m_maxTimeUs = 0;        ///< Longest single dispatch.
+
+            AZ::u64 GetNumDispatches() const { return m_numEvents + m_numBroadcasts + m_numEnumerations; }
+        };
+
+        /**
+         * Collects the number of dispatches, the number of handlers visited and the time spent per EBus and event
+         * function, to find buses that dominate the frame and handler fan-outs that should be batched.
+         * The profiler is stopped by default and can be controlled from the console with the ebus_profiler command.
+         * While it's running the statistics are also published as value registers of the "EBus" system of the
+         * AZ::Debug::Profiler, with the number of dispatches, handlers visited, total and self time in nanoseconds.
+         * @note Requires AZ_EBUS_PROFILER_ENABLED, otherwise the dispatches are not instrumented and nothing is recorded.
+         */
+        class EBusProfiler
+        {
+        public:
+            static void Start();
+            static void Stop();
+            static bool IsRunning();
+
+            //! Clears the statistics collected so far.
+            static void Reset();
+
+            //! Returns the statistics of all threads, sorted by descending self time.
+            static AZStd::vector<EBusDispatchStats> GetStats();
+
+            //! Prints the events with the highest self time to the log.
+            static void PrintReport(size_t maxEvents);
+        };
+    } // namespace Debug
+} // namespace AZ
@@ -9,6 +9,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/EBus/Internal/DispatchProfiler.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/stack.h>
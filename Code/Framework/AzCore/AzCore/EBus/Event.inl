@@ -255,6 +255,7 @@ namespace AZ
     template <typename... Params>
     void Event<Params...>::Signal(const Params&... params) const
     {
+        EBUS_PROFILE_DISPATCH(AZ_FUNCTION_SIGNATURE, Broadcast, &Event::Signal);
         m_updating = true;
 
         // Trigger all added handler callbacks
@@ -262,6 +263,7 @@ namespace AZ
         {
             if (handler)
             {
+                EBUS_PROFILE_HANDLER_VISITED();
                 handler->m_callback(params...);
             }
         }
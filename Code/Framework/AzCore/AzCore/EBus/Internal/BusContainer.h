@@ -14,6 +14,7 @@
 #include <AzCore/EBus/Internal/Handlers.h>
 #include <AzCore/EBus/Internal/StoragePolicies.h>
 #include <AzCore/EBus/Internal/Debug.h>
+#include <AzCore/EBus/Internal/DispatchProfiler.h>
 
 AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
@@ -112,6 +113,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Event(const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -145,6 +147,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -155,6 +158,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResult(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -188,6 +192,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -198,6 +203,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void EventReverse(const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -217,6 +223,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -227,6 +234,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResultReverse(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -246,6 +254,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -256,6 +265,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Event(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -285,6 +295,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -292,6 +303,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResult(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -321,6 +333,7 @@ namespace AZ
                         while (handlerIt != handlersEnd)
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -328,6 +341,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void EventReverse(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -343,6 +357,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -350,6 +365,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResultReverse(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -365,6 +381,7 @@ namespace AZ
                         while (handlerIt != handlers.rend())
                         {
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -374,6 +391,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Broadcast(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -407,6 +425,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
 
@@ -420,6 +439,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -453,6 +473,7 @@ namespace AZ
                             while (handlerIt != handlersEnd)
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
 
@@ -466,6 +487,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void BroadcastReverse(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -496,6 +518,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, *itr, args...);
                             }
                             holder.release();
@@ -524,6 +547,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -554,6 +578,7 @@ namespace AZ
                             while (handlerIt != handlers.rend())
                             {
                                 auto itr = handlerIt++;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                             }
                             holder.release();
@@ -584,6 +609,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlers(Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -593,7 +619,7 @@ namespace AZ
                         auto addressesEnd = addresses.end();
                         while (addressIt != addressesEnd)
                         {
-                            if (!context->m_buses.EnumerateHandlersImpl(context, *addressIt++, AZStd::forward<Callback>(callback)))
+                            if (!context->m_buses.EnumerateHandlersImpl(context, *addressIt++, AZStd::forward<Callback>(callback), EBUS_PROFILE_DISPATCH_SCOPE()))
                             {
                                 break;
                             }
@@ -603,6 +629,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlersId(const IdType& id, Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -611,20 +638,21 @@ namespace AZ
                         auto addressIt = addresses.find(id);
                         if (addressIt != addresses.end())
                         {
-                            context->m_buses.EnumerateHandlersImpl(context, *addressIt, AZStd::forward<Callback>(callback));
+                            context->m_buses.EnumerateHandlersImpl(context, *addressIt, AZStd::forward<Callback>(callback), EBUS_PROFILE_DISPATCH_SCOPE());
                         }
                     }
                 }
                 template <class Callback>
                 static void EnumerateHandlersPtr(const BusPtr& ptr, Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
 
                         if (ptr)
                         {
-                            context->m_buses.EnumerateHandlersImpl(context, *ptr, AZStd::forward<Callback>(callback));
+                            context->m_buses.EnumerateHandlersImpl(context, *ptr, AZStd::forward<Callback>(callback), EBUS_PROFILE_DISPATCH_SCOPE());
                         }
                     }
                 }
@@ -632,7 +660,7 @@ namespace AZ
 
             // All enumerate functions do basically the same thing once they have a holder, so implement it here
             template <class Callback>
-            static bool EnumerateHandlersImpl(void* context, HandlerHolder& holder, Callback&& callback)
+            static bool EnumerateHandlersImpl(void* context, HandlerHolder& holder, Callback&& callback, [[maybe_unused]] EBusDispatchScope* dispatchScope)
             {
                 auto& handlers = holder.m_handlers;
                 auto handlerIt = handlers.begin();
@@ -660,6 +688,7 @@ namespace AZ
                 {
                     bool result = false;
                     auto itr = handlerIt++;
+                    EBUS_PROFILE_HANDLER_VISITED_BY(dispatchScope);
                     Traits::EventProcessingPolicy::CallResult(result, callback, itr->m_interface);
 
                     if (!result)
@@ -792,6 +821,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Event(const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -802,6 +832,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -809,6 +840,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResult(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -819,6 +851,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -826,6 +859,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void EventReverse(const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -836,6 +870,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -843,6 +878,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResultReverse(Results& results, const IdType& id, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -853,6 +889,7 @@ namespace AZ
                         if (addressIt != addresses.end() && addressIt->m_interface)
                         {
                             CallstackEntry entry(context, &addressIt->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), addressIt->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -860,6 +897,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Event(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -871,6 +909,7 @@ namespace AZ
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -878,6 +917,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResult(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -889,6 +929,7 @@ namespace AZ
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -896,6 +937,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void EventReverse(const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -907,6 +949,7 @@ namespace AZ
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -914,6 +957,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void EventResultReverse(Results& results, const BusPtr& busPtr, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Event, func);
                     if (busPtr)
                     {
                         auto* context = Bus::GetContext();
@@ -925,6 +969,7 @@ namespace AZ
                         if (busPtr->m_interface)
                         {
                             CallstackEntry entry(context, &busPtr->m_busId);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), busPtr->m_interface, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -934,6 +979,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Broadcast(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -964,6 +1010,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                         }
@@ -972,6 +1019,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1002,6 +1050,7 @@ namespace AZ
                             {
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                         }
@@ -1010,6 +1059,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void BroadcastReverse(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1038,6 +1088,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::Call(func, inst, args...);
                             }
                             holder.release();
@@ -1066,6 +1117,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1094,6 +1146,7 @@ namespace AZ
                                 CallstackEntry entry(context, &holder.m_busId);
                                 // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                                 // due to potential of multiple addresses of this EBus container invoking the function multiple times
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(results, func, inst, args...);
                             }
                             holder.release();
@@ -1124,6 +1177,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlers(Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1152,6 +1206,7 @@ namespace AZ
                             if (Interface* inst = (addressIt++)->m_interface)
                             {
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1164,6 +1219,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlersId(const IdType& id, Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1176,6 +1232,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &id);
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1188,6 +1245,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlersPtr(const BusPtr& ptr, Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1198,6 +1256,7 @@ namespace AZ
                             {
                                 CallstackEntry entry(context, &ptr->m_busId);
                                 bool result = false;
+                                EBUS_PROFILE_HANDLER_VISITED();
                                 Traits::EventProcessingPolicy::CallResult(result, callback, inst);
                                 if (!result)
                                 {
@@ -1333,6 +1392,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Broadcast(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1361,6 +1421,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1368,6 +1429,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1396,6 +1458,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1403,6 +1466,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void BroadcastReverse(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1417,6 +1481,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(func, *itr, args...);
                         }
                     }
@@ -1424,6 +1489,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1438,6 +1504,7 @@ namespace AZ
                             // @func and @args cannot be forwarded here as rvalue arguments need to bind to const lvalue arguments
                             // due to potential of multiple handlers of this EBus container invoking the function multiple times
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, func, *itr, args...);
                         }
                     }
@@ -1447,6 +1514,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlers(Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1473,6 +1541,7 @@ namespace AZ
                         {
                             bool result = false;
                             auto itr = handlerIt++;
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(result, callback, itr->m_interface);
                             if (!result)
                             {
@@ -1527,6 +1596,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void Broadcast(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1536,6 +1606,7 @@ namespace AZ
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1543,6 +1614,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResult(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1552,6 +1624,7 @@ namespace AZ
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1559,6 +1632,7 @@ namespace AZ
                 template <typename Function, typename... ArgsT>
                 static void BroadcastReverse(Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1568,6 +1642,7 @@ namespace AZ
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1575,6 +1650,7 @@ namespace AZ
                 template <typename Results, typename Function, typename... ArgsT>
                 static void BroadcastResultReverse(Results& results, Function&& func, ArgsT&&... args)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Broadcast, func);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1584,6 +1660,7 @@ namespace AZ
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
                         }
                     }
@@ -1593,6 +1670,7 @@ namespace AZ
                 template <class Callback>
                 static void EnumerateHandlers(Callback&& callback)
                 {
+                    EBUS_PROFILE_DISPATCH(Bus::GetName(), Enumerate, callback);
                     if (auto* context = Bus::GetContext())
                     {
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
@@ -1601,6 +1679,7 @@ namespace AZ
                         if (handler)
                         {
                             CallstackEntry entry(context, nullptr);
+                            EBUS_PROFILE_HANDLER_VISITED();
                             Traits::EventProcessingPolicy::Call(callback, handler);
                         }
                     }
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_member_function_pointer.h>
+#include <AzCore/std/typetraits/decay.h>
+
+// Set AZ_EBUS_PROFILER_ENABLED to 0 to compile the EBus dispatch instrumentation out completely. When it's compiled
+// in, the profiler still has to be started at runtime (see AZ::Debug::EBusProfiler) and costs a single inlined, relaxed
+// flag load per dispatch while it's stopped.
+#if !defined(AZ_EBUS_PROFILER_ENABLED)
+#   if defined(_RELEASE)
+#       define AZ_EBUS_PROFILER_ENABLED 0
+#   else
+#       define AZ_EBUS_PROFILER_ENABLED 1
+#   endif
+#endif
+
+namespace AZ
+{
+    namespace Debug
+    {
+        enum class EBusDispatchType : AZ::u8
+        {
+            Event,      ///< Event sent to a single address.
+            Broadcast,  ///< Event sent to all addresses.
+            Enumerate,  ///< Enumeration of the handlers with a callback.
+        };
+    } // namespace Debug
+
+    namespace Internal
+    {
+        /**
+         * Measures a single EBus dispatch while the EBusProfiler is running. The time is inclusive, the time spent in
+         * dispatches started by the handlers is also tracked separately so the cost of the dispatch itself can be
+         * reported. Handlers visited by the dispatch are counted by the dispatch site through OnHandlerVisited.
+         */
+        class EBusDispatchScope
+        {
+        public:
+            template<class Function>
+            EBusDispatchScope(const char* busName, Debug::EBusDispatchType type, const Function& function)
+            {
+                if (IsProfilingEnabled())
+                {
+                    Begin(busName, type, GetEventId(function), GetEventSignature<AZStd::decay_t<Function>>());
+                }
+            }
+
+            ~EBusDispatchScope()
+            {
+                if (m_isActive)
+                {
+                    End();
+                }
+            }
+
+            EBusDispatchScope(const EBusDispatchScope&) = delete;
+            EBusDispatchScope& operator=(const EBusDispatchScope&) = delete;
+
+            //! The count is only recorded if the scope is active, so it's cheaper to always increment it than to check.
+            void OnHandlerVisited()
+            {
+                ++m_numHandlersVisited;
+            }
+
+            static bool IsProfilingEnabled()
+            {
+                const AZStd::atomic_bool* isRunning = s_isRunning.load(AZStd::memory_order_relaxed);
+                if (!isRunning)
+                {
+                    isRunning = FindIsRunning();
+                }
+                return isRunning && isRunning->load(AZStd::memory_order_relaxed) && !IsRecording();
+            }
+
+        private:
+            //! Looks up the flag shared by all modules and caches it in s_isRunning. Returns null if it's not available yet.
+            static const AZStd::atomic_bool* FindIsRunning();
+            //! True while a dispatch is recorded on this thread, so dispatches caused by the bookkeeping are not measured.
+            static bool IsRecording();
+
+            void Begin(const char* busName, Debug::EBusDispatchType type, AZ::u64 eventId, const char* eventSignature);
+            void End();
+
+            //! Identifies the event function, 0 for callbacks that are not member functions.
+            template<class Function>
+            static AZ::u64 GetEventId([[maybe_unused]] const Function& function)
+            {
+                if constexpr (AZStd::is_member_function_pointer_v<Function>)
+                {
+                    // Member function pointers have an implementation defined layout. For virtual functions the value
+                    // identifies the vtable slot, so it's the same for all handlers of the bus.
+                    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&function);
+                    AZ::u64 id = 0;
+                    for (size_t i = 0; i < sizeof(Function); ++i)
+                    {
+                        id = id * 131 + bytes[i];
+                    }
+                    return id;
+                }
+                else
+                {
+                    return 0;
+                }
+            }
+
+            template<class Function>
+            static const char* GetEventSignature()
+            {
+                return AZ_FUNCTION_SIGNATURE;
+            }
+
+            //! Innermost dispatch that's being measured on this thread.
+            static EBusDispatchScope*& GetCurrent()
+            {
+                thread_local static EBusDispatchScope* s_current = nullptr;
+                return s_current;
+            }
+
+            //! Points to the running flag of the profiler, cached per module so the stopped profiler isn't looked up on every dispatch.
+            static inline AZStd::atomic<const AZStd::atomic_bool*> s_isRunning{ nullptr };
+
+            EBusDispatchScope* m_parent = nullptr;
+            const char* m_busName = nullptr;
+            const char* m_eventSignature = nullptr;
+            AZ::u64 m_eventId = 0;
+            AZ::s64 m_startTicks = 0;
+            AZ::s64 m_childTicks = 0;
+            AZ::u64 m_numHandlersVisited = 0;
+            Debug::EBusDispatchType m_type = Debug::EBusDispatchType::Event;
+            bool m_isActive = false;
+        };
+    } // namespace Internal
+} // namespace AZ
+
+#if AZ_EBUS_PROFILER_ENABLED
+#   define EBUS_PROFILE_DISPATCH(busName, dispatchType, function) \
+        AZ::Internal::EBusDispatchScope ebusDispatchScope(busName, AZ::Debug::EBusDispatchType::dispatchType, function)
+#   define EBUS_PROFILE_DISPATCH_SCOPE() &ebusDispatchScope
+#   define EBUS_PROFILE_HANDLER_VISITED() ebusDispatchScope.OnHandlerVisited()
+#   define EBUS_PROFILE_HANDLER_VISITED_BY(dispatchScope) dispatchScope->OnHandlerVisited()
+#else
+#   define EBUS_PROFILE_DISPATCH(busName, dispatchType, function)
+#   define EBUS_PROFILE_DISPATCH_SCOPE() nullptr
+#   define EBUS_PROFILE_HANDLER_VISITED()
+#   define EBUS_PROFILE_HANDLER_VISITED_BY(dispatchScope)
+#endif
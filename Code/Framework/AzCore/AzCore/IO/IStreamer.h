@@ -129,6 +129,49 @@ namespace AZ::IO
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
             size_t offset = 0) = 0;
 
+        //! Creates a request to read a file that can be served as a read-only view into the file instead of a copy. Uncompressed files
+        //! in archives can be memory mapped by the stack so the data doesn't need to be copied or cached. If a view can't be provided
+        //! the data is read into memory reserved with the allocator instead. In both cases the memory is owned by the request and
+        //! stays valid until there are no more references to the FileRequestPtr. Memory from this request can't be claimed with
+        //! GetReadRequestResult and the data must not be written to.
+        //! @param relativePath Relative path to the file to load. This can include aliases such as @assets@.
+        //! @param allocator The allocator used to reserve and release memory if no view could be provided.
+        //!         The allocator needs to live at least as long as the FileRequestPtr is in use.
+        //! @param size The number of bytes to read from the file at the relative path.
+        //! @param deadline The amount of time from calling Read that the request should complete. Is FileRequest::s_noDeadline
+        //!         if the request doesn't need to be completed before a specific time.
+        //! @param priority The priority used to order requests if multiple requests are at risk of missing their deadline.
+        //! @param offset The offset into the file where reading begins.
+        //! @return A smart pointer to the newly created request with the read command.
+        virtual FileRequestPtr ReadView(
+            AZStd::string_view relativePath,
+            IStreamerTypes::RequestMemoryAllocator& allocator,
+            size_t size,
+            AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
+            size_t offset = 0) = 0;
+
+        //! Sets a request to the read command that can be served as a read-only view into the file instead of a copy.
+        //! See the other version of ReadView for details.
+        //! @param request The request that will store the read command.
+        //! @param relativePath Relative path to the file to load. This can include aliases such as @assets@.
+        //! @param allocator The allocator used to reserve and release memory if no view could be provided.
+        //!         The allocator needs to live at least as long as the FileRequestPtr is in use.
+        //! @param size The number of bytes to read from the file at the relative path.
+        //! @param deadline The amount of time from calling Read that the request should complete. Is FileRequest::s_noDeadline
+        //!         if the request doesn't need to be completed before a specific time.
+        //! @param priority The priority used to order requests if multiple requests are at risk of missing their deadline.
+        //! @param offset The offset into the file where reading begins.
+        //! @return A reference to the provided request.
+        virtual FileRequestPtr& ReadView(
+            FileRequestPtr& request,
+            AZStd::string_view relativePath,
+            IStreamerTypes::RequestMemoryAllocator& allocator,
+            size_t size,
+            AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium,
+            size_t offset = 0) = 0;
+
         //! Creates a request to cancel a previously queued request.
         //! When this request completes it's not guaranteed to have canceled the target request. Not all requests can be canceled and requests
         //! that already processing may complete. It's recommended to let the target request handle the completion of the request as normal
@@ -78,7 +78,8 @@ namespace AZ::IO::IStreamerTypes
     enum class MemoryType : u8
     {
         ReadWrite, //!< General purpose memory.
-        WriteCombined //!< Reading back from memory with this flag will be avoided. This may require additional temporary buffers.
+        WriteCombined, //!< Reading back from memory with this flag will be avoided. This may require additional temporary buffers.
+        ReadOnlyView //!< Read-only view into a memory mapped file. The view is owned by the request and can't be claimed.
     };
 
     enum class ClaimMemory : bool
@@ -38,10 +38,12 @@ namespace AZ
             , m_size(size)
             , m_priority(priority)
             , m_memoryType(IStreamerTypes::MemoryType::ReadWrite) // Only generic memory can be assigned externally.
+            , m_allowReadOnlyView(false)
         {}
 
         FileRequest::ReadRequestData::ReadRequestData(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator,
-            u64 offset, u64 size, AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority)
+            u64 offset, u64 size, AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority,
+            bool allowReadOnlyView)
             : m_path(AZStd::move(path))
             , m_allocator(allocator)
             , m_deadline(deadline)
@@ -51,13 +53,15 @@ namespace AZ
             , m_size(size)
             , m_priority(priority)
             , m_memoryType(IStreamerTypes::MemoryType::ReadWrite) // Only generic memory can be assigned externally.
+            , m_allowReadOnlyView(allowReadOnlyView)
         {}
 
         FileRequest::ReadRequestData::~ReadRequestData()
         {
             if (m_allocator != nullptr)
             {
-                if (m_output != nullptr)
+                // Views aren't allocated from the allocator, they're released together with m_viewSource.
+                if (m_output != nullptr && m_memoryType != IStreamerTypes::MemoryType::ReadOnlyView)
                 {
                     m_allocator->Release(m_output);
                 }
@@ -166,11 +170,11 @@ namespace AZ
         }
 
         void FileRequest::CreateReadRequest(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator, u64 offset, u64 size,
-            AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority)
+            AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority, bool allowReadOnlyView)
         {
             AZ_Assert(AZStd::holds_alternative<AZStd::monostate>(m_command),
                 "Attempting to set FileRequest to 'ReadRequest', but another task was already assigned.");
-            m_command.emplace<ReadRequestData>(AZStd::move(path), allocator, offset, size, deadline, priority);
+            m_command.emplace<ReadRequestData>(AZStd::move(path), allocator, offset, size, deadline, priority, allowReadOnlyView);
         }
 
         void FileRequest::CreateRead(FileRequest* parent, void* output, u64 outputSize, const RequestPath& path,
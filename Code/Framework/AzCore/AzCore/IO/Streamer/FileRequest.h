@@ -74,7 +74,7 @@ namespace AZ
                 ReadRequestData(RequestPath path, void* output, u64 outputSize, u64 offset, u64 size,
                     AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
                 ReadRequestData(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator, u64 offset, u64 size,
-                    AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
+                    AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority, bool allowReadOnlyView = false);
                 ~ReadRequestData();
                 
                 RequestPath m_path; //!< Relative path to the target file.
@@ -86,6 +86,10 @@ namespace AZ
                 u64 m_size; //!< The number of bytes to read from the file.
                 IStreamerTypes::Priority m_priority; //!< Priority used for ordering requests. This is used when requests have the same deadline.
                 IStreamerTypes::MemoryType m_memoryType; //!< The type of memory provided by the allocator if used.
+                //! If true the stack is allowed to provide a read-only view into the file instead of reading into memory from the allocator.
+                bool m_allowReadOnlyView;
+                //! Keeps the memory that backs a read-only view alive for as long as the request exists.
+                AZStd::shared_ptr<void> m_viewSource;
             };
 
             //! Request to read data. This is a translated request and holds an absolute path and has been
@@ -264,7 +268,7 @@ namespace AZ
             void CreateReadRequest(RequestPath path, void* output, u64 outputSize, u64 offset, u64 size,
                 AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
             void CreateReadRequest(RequestPath path, IStreamerTypes::RequestMemoryAllocator* allocator, u64 offset, u64 size,
-                AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority);
+                AZStd::chrono::system_clock::time_point deadline, IStreamerTypes::Priority priority, bool allowReadOnlyView = false);
             void CreateRead(FileRequest* parent, void* output, u64 outputSize, const RequestPath& path, u64 offset, u64 size, bool sharedRead = false);
             void CreateCompressedRead(FileRequest* parent, const CompressionInfo& compressionInfo, void* output,
                 u64 readOffset, u64 readSize);
@@ -27,7 +27,7 @@ namespace AZ
             const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
         {
             auto stackEntry = AZStd::make_shared<FullFileDecompressor>(
-                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize));
+                m_maxNumReads, m_maxNumJobs, aznumeric_caster(hardware.m_maxPhysicalSectorSize), m_useSharedJobPool);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -37,50 +37,93 @@ namespace AZ
             if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
             {
                 serializeContext->Class<FullFileDecompressorConfig, IStreamerStackConfig>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("MaxNumReads", &FullFileDecompressorConfig::m_maxNumReads)
-                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs);
+                    ->Field("MaxNumJobs", &FullFileDecompressorConfig::m_maxNumJobs)
+                    ->Field("UseSharedJobPool", &FullFileDecompressorConfig::m_useSharedJobPool);
             }
         }
 
         static constexpr char DecompBoundName[] = "Decompression bound";
         static constexpr char ReadBoundName[] = "Read bound";
+        //! Unused buffers larger than this are released instead of being kept for reuse, so a single large file doesn't
+        //! permanently hold on to a large amount of memory.
+        static constexpr size_t MaxRetainedBufferSize = 8_mib;
 
         bool FullFileDecompressor::DecompressionInformation::IsProcessing() const
         {
             return !!m_compressedData;
         }
         
-        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment)
+        FullFileDecompressor::FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, bool useSharedJobPool)
             : StreamStackEntry("Full file decompressor")
             , m_maxNumReads(maxNumReads)
             , m_maxNumJobs(maxNumJobs)
             , m_alignment(alignment)
         {
-            JobManagerDesc jobDesc;
-            u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
-            for (u32 i = 0; i < numThreads; ++i)
+            JobContext* globalContext = useSharedJobPool ? JobContext::GetGlobalContext() : nullptr;
+            if (globalContext)
             {
-                jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+                m_decompressionjobContext = AZStd::make_unique<JobContext>(globalContext->GetJobManager());
+                // Decompression can take several frames so keep it from delaying the work the current frame is waiting on.
+                m_decompressionjobContext->SetLane(JobLane::Background);
+            }
+            else
+            {
+                AZ_Warning("Streamer", !useSharedJobPool,
+                    "FullFileDecompressor was configured to use the shared job pool, but there's no global job context. "
+                    "Falling back to dedicated decompression threads.");
+
+                JobManagerDesc jobDesc;
+                u32 numThreads = AZ::GetMin(maxNumJobs, AZStd::thread::hardware_concurrency());
+                for (u32 i = 0; i < numThreads; ++i)
+                {
+                    jobDesc.m_workerThreads.push_back(JobManagerThreadDesc());
+                }
+                m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
+                m_decompressionjobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
             }
-            m_decompressionJobManager = AZStd::make_unique<JobManager>(jobDesc);
-            m_decompressionjobContext = AZStd::make_unique<JobContext>(*m_decompressionJobManager);
 
             m_processingJobs = AZStd::make_unique<DecompressionInformation[]>(maxNumJobs);
 
             m_readBuffers = AZStd::make_unique<Buffer[]>(maxNumReads);
+            m_readBufferSizes = AZStd::make_unique<size_t[]>(maxNumReads);
             m_readRequests = AZStd::make_unique<FileRequest*[]>(maxNumReads);
             m_readBufferStatus = AZStd::make_unique<ReadBufferStatus[]>(maxNumReads);
             for (u32 i = 0; i < maxNumReads; ++i)
             {
+                m_readBufferSizes[i] = 0;
                 m_readBufferStatus[i] = ReadBufferStatus::Unused;
             }
+            m_bufferPool.reserve(maxNumReads);
 
             // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
             m_bytesDecompressed.PushEntry(1);
             m_decompressionDurationMicroSec.PushEntry(1);
         }
 
+        FullFileDecompressor::~FullFileDecompressor()
+        {
+            // Jobs on the shared job pool outlive this entry, so wait for them to stop using their slot before releasing the memory.
+            while (m_numActiveJobs.load(AZStd::memory_order_acquire) > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
+            if (m_processingJobs)
+            {
+                for (u32 i = 0; i < m_maxNumJobs; ++i)
+                {
+                    ReleaseScratch(m_processingJobs[i]);
+                }
+            }
+            for (PooledBuffer& pooled : m_bufferPool)
+            {
+                DeallocateBuffer(pooled.m_buffer, pooled.m_size);
+            }
+            m_bufferPool.clear();
+        }
+
         void FullFileDecompressor::PrepareRequest(FileRequest* request)
         {
             AZ_Assert(request, "PrepareRequest was provided a null request.");
@@ -321,6 +364,22 @@ namespace AZ
                 double totalDecompressionTimeSec = m_decompressionDurationMicroSec.GetTotal() * usToSec;
                 statistics.push_back(Statistic::CreateFloat(m_name, "Decompression Speed per job (avg. mbps)", totalBytesDecompressedMB / totalDecompressionTimeSec));
 
+                // Throughput over the time any job was running, which includes the gains from running jobs in parallel.
+                AZStd::chrono::microseconds busyDuration = m_busyDuration;
+                if (m_numRunningJobs > 0)
+                {
+                    busyDuration += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                        AZStd::chrono::high_resolution_clock::now() - m_busyStartTime);
+                }
+                if (busyDuration.count() > 0)
+                {
+                    double busyTimeSec = aznumeric_cast<double>(busyDuration.count()) * usToSec;
+                    statistics.push_back(Statistic::CreateFloat(m_name, "Decompression throughput (avg. mbps)",
+                        (m_totalBytesDecompressed * bytesToMB) / busyTimeSec));
+                }
+                statistics.push_back(Statistic::CreateFloat(m_name, "Pooled buffer memory (MB)", m_pooledMemory * bytesToMB));
+                statistics.push_back(Statistic::CreatePercentage(m_name, "Reused read buffers", m_bufferReuseStat.GetAverage()));
+
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
                 statistics.push_back(Statistic::CreatePercentage(m_name, DecompBoundName, m_decompressionBoundStat.GetAverage()));
                 statistics.push_back(Statistic::CreatePercentage(m_name, ReadBoundName, m_readBoundStat.GetAverage()));
@@ -497,9 +556,8 @@ namespace AZ
                     // the BlockCache's prolog and epilog are read into aligned buffers.
                     size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
                     size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
-                    m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
-                        bufferSize, m_alignment, 0, "AZ::IO::Streamer FullFileDecompressor", __FILE__, __LINE__));
-                    m_memoryUsage += bufferSize;
+                    m_readBuffers[i] = AcquireBuffer(bufferSize, m_readBufferSizes[i]);
+                    m_memoryUsage += m_readBufferSizes[i];
 
                     FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
                     archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
@@ -546,18 +604,13 @@ namespace AZ
             }
             else
             {
-                auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
-                AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-                CompressionInfo& info = data->m_compressionInfo;
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
-                m_memoryUsage -= bufferSize;
-
+                m_memoryUsage -= m_readBufferSizes[readSlot];
                 if (m_readBuffers[readSlot] != nullptr)
                 {
-                    AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(m_readBuffers[readSlot], bufferSize, m_alignment);
+                    ReleaseBuffer(m_readBuffers[readSlot], m_readBufferSizes[readSlot]);
                     m_readBuffers[readSlot] = nullptr;
                 }
+                m_readBufferSizes[readSlot] = 0;
                 m_readRequests[readSlot] = nullptr;
                 m_readBufferStatus[readSlot] = ReadBufferStatus::Unused;
                 AZ_Assert(m_numInFlightReads > 0,
@@ -604,7 +657,9 @@ namespace AZ
                     info.m_queueStartTime = AZStd::chrono::high_resolution_clock::now();
                     info.m_jobStartTime = info.m_queueStartTime; // Set these to the same in case the scheduler requests an update before the job has started.
                     info.m_compressedData = m_readBuffers[readSlot]; // Transfer ownership of the pointer.
+                    info.m_compressedDataSize = m_readBufferSizes[readSlot];
                     m_readBuffers[readSlot] = nullptr;
+                    m_readBufferSizes[readSlot] = 0;
 
                     AZ::Job* decompressionJob;
                     auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
@@ -619,20 +674,27 @@ namespace AZ
                         auto job = [this, &info]()
                         {
                             FullDecompression(m_context, info);
+                            m_numActiveJobs.fetch_sub(1, AZStd::memory_order_release);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
                     else
                     {
-                        m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
+                        ReserveScratch(info, data->m_compressionInfo.m_uncompressedSize);
                         auto job = [this, &info]()
                         {
                             PartialDecompression(m_context, info);
+                            m_numActiveJobs.fetch_sub(1, AZStd::memory_order_release);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
                     --m_numPendingDecompression;
+                    if (m_numRunningJobs == 0)
+                    {
+                        m_busyStartTime = info.m_queueStartTime;
+                    }
                     ++m_numRunningJobs;
+                    m_numActiveJobs.fetch_add(1, AZStd::memory_order_relaxed);
                     decompressionJob->Start();
 
                     m_readRequests[readSlot] = nullptr;
@@ -663,28 +725,134 @@ namespace AZ
             AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
             auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
-            m_memoryUsage -= bufferSize;
-            if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
-            {
-                m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
-            }
+            m_memoryUsage -= jobInfo.m_compressedDataSize;
 
             m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
             m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 endTime - jobInfo.m_jobStartTime).count());
             m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+            m_totalBytesDecompressed += data->m_compressionInfo.m_uncompressedSize;
 
-            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
+            ReleaseBuffer(jobInfo.m_compressedData, jobInfo.m_compressedDataSize);
             jobInfo.m_compressedData = nullptr;
+            jobInfo.m_compressedDataSize = 0;
+            if (jobInfo.m_scratchSize > MaxRetainedBufferSize)
+            {
+                ReleaseScratch(jobInfo);
+            }
             AZ_Assert(m_numRunningJobs > 0, "About to complete a decompression job, but the internal count doesn't see a running job.");
             --m_numRunningJobs;
+            if (m_numRunningJobs == 0)
+            {
+                m_busyDuration += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(endTime - m_busyStartTime);
+            }
             return;
         }
 
+        auto FullFileDecompressor::AcquireBuffer(size_t size, size_t& acquiredSize) -> Buffer
+        {
+            // Use the smallest unused buffer that's large enough.
+            auto best = m_bufferPool.end();
+            for (auto it = m_bufferPool.begin(); it != m_bufferPool.end(); ++it)
+            {
+                if (it->m_size >= size && (best == m_bufferPool.end() || it->m_size < best->m_size))
+                {
+                    best = it;
+                }
+            }
+
+            if (best != m_bufferPool.end())
+            {
+                Buffer result = best->m_buffer;
+                acquiredSize = best->m_size;
+                m_pooledMemory -= best->m_size;
+                *best = m_bufferPool.back();
+                m_bufferPool.pop_back();
+                m_bufferReuseStat.PushSample(1.0);
+                return result;
+            }
+
+            m_bufferReuseStat.PushSample(0.0);
+            acquiredSize = size;
+            return AllocateBuffer(size);
+        }
+
+        void FullFileDecompressor::ReleaseBuffer(Buffer buffer, size_t size)
+        {
+            if (size > MaxRetainedBufferSize)
+            {
+                DeallocateBuffer(buffer, size);
+                return;
+            }
+
+            if (m_bufferPool.size() < m_maxNumReads)
+            {
+                m_bufferPool.push_back(PooledBuffer{ buffer, size });
+                m_pooledMemory += size;
+                return;
+            }
+
+            // The pool is full, so keep the larger buffers as they can serve more reads.
+            if (m_bufferPool.empty())
+            {
+                DeallocateBuffer(buffer, size);
+                return;
+            }
+            auto smallest = m_bufferPool.begin();
+            for (auto it = m_bufferPool.begin() + 1; it != m_bufferPool.end(); ++it)
+            {
+                if (it->m_size < smallest->m_size)
+                {
+                    smallest = it;
+                }
+            }
+            if (smallest->m_size < size)
+            {
+                DeallocateBuffer(smallest->m_buffer, smallest->m_size);
+                m_pooledMemory -= smallest->m_size;
+                *smallest = PooledBuffer{ buffer, size };
+                m_pooledMemory += size;
+            }
+            else
+            {
+                DeallocateBuffer(buffer, size);
+            }
+        }
+
+        void FullFileDecompressor::ReserveScratch(DecompressionInformation& info, size_t size)
+        {
+            if (info.m_scratchSize < size)
+            {
+                ReleaseScratch(info);
+                info.m_scratch = AllocateBuffer(size);
+                info.m_scratchSize = size;
+                m_pooledMemory += size;
+            }
+        }
+
+        void FullFileDecompressor::ReleaseScratch(DecompressionInformation& info)
+        {
+            if (info.m_scratch)
+            {
+                DeallocateBuffer(info.m_scratch, info.m_scratchSize);
+                m_pooledMemory -= info.m_scratchSize;
+                info.m_scratch = nullptr;
+                info.m_scratchSize = 0;
+            }
+        }
+
+        auto FullFileDecompressor::AllocateBuffer(size_t size) -> Buffer
+        {
+            return reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+                size, m_alignment, 0, "AZ::IO::Streamer FullFileDecompressor", __FILE__, __LINE__));
+        }
+
+        void FullFileDecompressor::DeallocateBuffer(Buffer buffer, size_t size)
+        {
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, size, m_alignment);
+        }
+
         void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
@@ -721,12 +889,14 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
+            AZ_Assert(info.m_scratchSize >= compressionInfo.m_uncompressedSize,
+                "The scratch buffer for partial decompression (%zu) is smaller than the decompressed size (%zu).",
+                info.m_scratchSize, compressionInfo.m_uncompressedSize);
             bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+                compressionInfo.m_compressedSize, info.m_scratch, compressionInfo.m_uncompressedSize);
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
-            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+            memcpy(request->m_output, info.m_scratch + request->m_readOffset, request->m_readSize);
 
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
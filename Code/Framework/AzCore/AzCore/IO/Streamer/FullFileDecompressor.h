@@ -14,7 +14,9 @@
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Statistics/RunningStatistic.h>
 
@@ -37,6 +39,8 @@ namespace AZ
             u32 m_maxNumReads{ 2 };
             //! Maximum number of decompression jobs that can run simultaneously.
             u32 m_maxNumJobs{ 2 };
+            //! If true, decompression jobs run on the background lane of the global job manager instead of on dedicated threads.
+            bool m_useSharedJobPool{ false };
         };
 
         //! Entry in the streaming stack that decompresses files from an archive that are stored
@@ -46,14 +50,18 @@ namespace AZ
         //! also means that there's no upper limit to the memory so every decompression job will
         //! need to allocate memory as a temporary buffer (in-place decompression is not supported).
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
-        //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
-        //! the main job system from working.
+        //! can vary largely so by default a dedicated job system is used to decompress on to avoid blocking
+        //! the main job system from working. Alternatively the jobs can be run on the background lane of the
+        //! global job manager, which lets decompression scale with the available worker threads without
+        //! getting in the way of frame work.
+        //! Buffers for the compressed data and the temporary buffers for partial decompression are kept
+        //! around and reused between requests to avoid allocating memory for every read.
         class FullFileDecompressor
             : public StreamStackEntry
         {
         public:
-            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment);
-            ~FullFileDecompressor() override = default;
+            FullFileDecompressor(u32 maxNumReads, u32 maxNumJobs, u32 alignment, bool useSharedJobPool = false);
+            ~FullFileDecompressor() override;
 
             void PrepareRequest(FileRequest* request) override;
             void QueueRequest(FileRequest* request) override;
@@ -82,10 +90,20 @@ namespace AZ
                 AZStd::chrono::high_resolution_clock::time_point m_queueStartTime;
                 AZStd::chrono::high_resolution_clock::time_point m_jobStartTime;
                 Buffer m_compressedData{ nullptr };
+                size_t m_compressedDataSize{ 0 };
+                //! Temporary buffer for partial decompression. This is owned by the job slot and reused by the jobs running in it.
+                Buffer m_scratch{ nullptr };
+                size_t m_scratchSize{ 0 };
                 FileRequest* m_waitRequest{ nullptr };
                 u32 m_alignmentOffset{ 0 };
             };
 
+            struct PooledBuffer
+            {
+                Buffer m_buffer{ nullptr };
+                size_t m_size{ 0 };
+            };
+
             bool IsIdle() const;
 
             void PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data);
@@ -100,6 +118,13 @@ namespace AZ
             bool StartDecompressions();
             void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
             
+            Buffer AcquireBuffer(size_t size, size_t& acquiredSize);
+            void ReleaseBuffer(Buffer buffer, size_t size);
+            void ReserveScratch(DecompressionInformation& info, size_t size);
+            void ReleaseScratch(DecompressionInformation& info);
+            Buffer AllocateBuffer(size_t size);
+            void DeallocateBuffer(Buffer buffer, size_t size);
+
             static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
             static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
 
@@ -114,7 +139,16 @@ namespace AZ
             AZ::Statistics::RunningStatistic m_readBoundStat;
 #endif
 
+            AZ::Statistics::RunningStatistic m_bufferReuseStat;
+            //! Accumulated wall clock time during which at least one decompression job was running.
+            AZStd::chrono::microseconds m_busyDuration{ 0 };
+            AZStd::chrono::high_resolution_clock::time_point m_busyStartTime;
+            u64 m_totalBytesDecompressed{ 0 };
+
+            //! Unused buffers that can be reused for archive reads.
+            AZStd::vector<PooledBuffer> m_bufferPool;
             AZStd::unique_ptr<Buffer[]> m_readBuffers;
+            AZStd::unique_ptr<size_t[]> m_readBufferSizes;
             // Nullptr if not reading, the read request if reading the file and the wait request for decompression when waiting on decompression.
             AZStd::unique_ptr<FileRequest*[]> m_readRequests;
             AZStd::unique_ptr<ReadBufferStatus[]> m_readBufferStatus;
@@ -124,11 +158,14 @@ namespace AZ
             AZStd::unique_ptr<JobContext> m_decompressionjobContext;
 
             size_t m_memoryUsage{ 0 }; //!< Amount of memory used for buffers by the decompressor.
+            size_t m_pooledMemory{ 0 }; //!< Amount of memory held by unused buffers kept for reuse.
             u32 m_maxNumReads{ 2 };
             u32 m_numInFlightReads{ 0 };
             u32 m_numPendingDecompression{ 0 };
             u32 m_maxNumJobs{ 1 };
             u32 m_numRunningJobs{ 0 };
+            //! Number of jobs that are still using their slot. Unlike m_numRunningJobs this is updated from the job threads.
+            AZStd::atomic<u32> m_numActiveJobs{ 0 };
             u32 m_alignment{ 0 };
         };
     } // namespace IO
@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+
+namespace AZ::IO
+{
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        Unmap();
+    }
+
+    bool MemoryMappedFile::IsMapped() const
+    {
+        return m_data != nullptr;
+    }
+
+    const u8* MemoryMappedFile::GetData() const
+    {
+        return m_data;
+    }
+
+    u64 MemoryMappedFile::GetSize() const
+    {
+        return m_size;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ::IO
+{
+    //! Read-only memory mapping of an entire file. The file handle is only needed while creating the mapping, so the mapping
+    //! doesn't hold on to any file handles. Mapping and unmapping are implemented per platform.
+    class MemoryMappedFile final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MemoryMappedFile, SystemAllocator, 0);
+
+        MemoryMappedFile() = default;
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        //! Maps the file at the provided absolute path into memory.
+        //! @return True if the file was mapped. Empty files can't be mapped and will return false.
+        bool Map(const char* absolutePath);
+        void Unmap();
+
+        bool IsMapped() const;
+        const u8* GetData() const;
+        u64 GetSize() const;
+
+    private:
+        const u8* m_data{ nullptr };
+        u64 m_size{ 0 };
+    };
+} // namespace AZ::IO
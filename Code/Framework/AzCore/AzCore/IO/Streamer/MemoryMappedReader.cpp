@@ -0,0 +1,268 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> MemoryMappedReaderConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<MemoryMappedReader>(
+            m_maxMappedFiles, hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void MemoryMappedReaderConfig::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<MemoryMappedReaderConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxMappedFiles", &MemoryMappedReaderConfig::m_maxMappedFiles);
+        }
+    }
+
+
+
+    //
+    // MemoryMappedReader
+    //
+
+    MemoryMappedReader::MemoryMappedReader(u32 maxMappedFiles, u64 memoryAlignment, u64 sizeAlignment)
+        : StreamStackEntry("Memory mapped reader")
+        , m_maxMappedFiles(AZStd::max(maxMappedFiles, 1u))
+    {
+        m_recommendations.m_memoryAlignment = memoryAlignment;
+        m_recommendations.m_sizeAlignment = sizeAlignment;
+
+        m_mappedFiles_paths.reserve(m_maxMappedFiles);
+        m_mappedFiles_files.reserve(m_maxMappedFiles);
+        m_mappedFiles_lastTimeUsed.reserve(m_maxMappedFiles);
+    }
+
+    void MemoryMappedReader::SetContext(StreamerContext& context)
+    {
+        StreamStackEntry::SetContext(context);
+        context.EnableReadOnlyViews();
+    }
+
+    void MemoryMappedReader::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                ReadFile(request, args);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    void MemoryMappedReader::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        statistics.push_back(Statistic::CreatePercentage(m_name, "Reads served as views", m_viewPercentageStat.GetAverage()));
+        statistics.push_back(Statistic::CreateFloat(m_name, "Bytes served as views (mib)", aznumeric_cast<double>(m_viewBytes) / 1_mib));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Num mapped files", aznumeric_caster(m_mappedFiles_paths.size())));
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void MemoryMappedReader::ReadFile(FileRequest* request, FileRequest::ReadData& data)
+    {
+        FileRequest::ReadRequestData* readRequest = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+        // Only reads that accept a view have their memory allocation deferred by the scheduler. Everything else already has
+        // an output buffer and is passed on as is.
+        if (readRequest && readRequest->m_allowReadOnlyView && readRequest->m_output == nullptr)
+        {
+            // Reads from loose files aren't mapped as they may still be written to.
+            if (IsRedirectedToArchive(request) && ProvideView(request, data, *readRequest))
+            {
+                m_viewPercentageStat.PushSample(1.0);
+                return;
+            }
+
+            m_viewPercentageStat.PushSample(0.0);
+            if (!AllocateOutput(request, data, *readRequest))
+            {
+                return;
+            }
+        }
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    bool MemoryMappedReader::IsRedirectedToArchive(const FileRequest* request)
+    {
+        // Reads from archives store the archive path in a request between the read and the original read request.
+        for (const FileRequest* parent = request->GetParent(); parent != nullptr; parent = parent->GetParent())
+        {
+            if (AZStd::holds_alternative<FileRequest::RequestPathStoreData>(parent->GetCommand()))
+            {
+                return true;
+            }
+            if (AZStd::holds_alternative<FileRequest::ReadRequestData>(parent->GetCommand()))
+            {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool MemoryMappedReader::ProvideView(FileRequest* request, FileRequest::ReadData& data, FileRequest::ReadRequestData& readRequest)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        AZStd::shared_ptr<MemoryMappedFile> file = GetMappedFile(data.m_path);
+        if (!file || data.m_offset + data.m_size > file->GetSize())
+        {
+            return false;
+        }
+
+        // The view points directly into the mapped file. Writing to it isn't possible as the mapping is read-only, which is why
+        // the memory type is marked as a view.
+        void* view = const_cast<u8*>(file->GetData() + data.m_offset);
+        readRequest.m_output = view;
+        readRequest.m_outputSize = data.m_size;
+        readRequest.m_memoryType = IStreamerTypes::MemoryType::ReadOnlyView;
+        readRequest.m_viewSource = AZStd::move(file);
+        data.m_output = view;
+        data.m_outputSize = data.m_size;
+        m_viewBytes += data.m_size;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+        return true;
+    }
+
+    bool MemoryMappedReader::AllocateOutput(FileRequest* request, FileRequest::ReadData& data, FileRequest::ReadRequestData& readRequest)
+    {
+        AZ_Assert(readRequest.m_allocator,
+            "The read request was issued without a memory allocator or valid output address.");
+
+        u64 recommendedSize = m_recommendations.CalculateRecommendedMemorySize(readRequest.m_size, readRequest.m_offset);
+        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+            readRequest.m_allocator->Allocate(readRequest.m_size, recommendedSize, m_recommendations.m_memoryAlignment);
+        if (allocation.m_address == nullptr || allocation.m_size < readRequest.m_size)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return false;
+        }
+        readRequest.m_output = allocation.m_address;
+        readRequest.m_outputSize = allocation.m_size;
+        readRequest.m_memoryType = allocation.m_type;
+        data.m_output = allocation.m_address;
+        data.m_outputSize = allocation.m_size;
+        return true;
+    }
+
+    AZStd::shared_ptr<MemoryMappedFile> MemoryMappedReader::GetMappedFile(const RequestPath& filePath)
+    {
+        AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
+        size_t index = FindMappedFile(filePath);
+        if (index != s_fileNotFound)
+        {
+            m_mappedFiles_lastTimeUsed[index] = now;
+            return m_mappedFiles_files[index];
+        }
+
+        AZStd::shared_ptr<MemoryMappedFile> file = AZStd::make_shared<MemoryMappedFile>();
+        if (!file->Map(filePath.GetAbsolutePath()))
+        {
+            file.reset();
+        }
+
+        index = FindAvailableMappedFileIndex();
+        if (index == s_fileNotFound)
+        {
+            m_mappedFiles_paths.push_back(filePath);
+            m_mappedFiles_files.push_back(file);
+            m_mappedFiles_lastTimeUsed.push_back(now);
+        }
+        else
+        {
+            // Views that are still in use hold on to their own reference, so replacing the entry doesn't unmap their memory.
+            m_mappedFiles_paths[index] = filePath;
+            m_mappedFiles_files[index] = file;
+            m_mappedFiles_lastTimeUsed[index] = now;
+        }
+        return file;
+    }
+
+    size_t MemoryMappedReader::FindMappedFile(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_mappedFiles_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_mappedFiles_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return s_fileNotFound;
+    }
+
+    size_t MemoryMappedReader::FindAvailableMappedFileIndex() const
+    {
+        size_t numFiles = m_mappedFiles_paths.size();
+        if (numFiles < m_maxMappedFiles)
+        {
+            return s_fileNotFound;
+        }
+
+        size_t oldestIndex = 0;
+        for (size_t i = 1; i < numFiles; ++i)
+        {
+            if (m_mappedFiles_lastTimeUsed[i] < m_mappedFiles_lastTimeUsed[oldestIndex])
+            {
+                oldestIndex = i;
+            }
+        }
+        return oldestIndex;
+    }
+
+    void MemoryMappedReader::FlushCache(const RequestPath& filePath)
+    {
+        size_t index = FindMappedFile(filePath);
+        if (index != s_fileNotFound)
+        {
+            m_mappedFiles_paths.erase(m_mappedFiles_paths.begin() + index);
+            m_mappedFiles_files.erase(m_mappedFiles_files.begin() + index);
+            m_mappedFiles_lastTimeUsed.erase(m_mappedFiles_lastTimeUsed.begin() + index);
+        }
+    }
+
+    void MemoryMappedReader::FlushEntireCache()
+    {
+        m_mappedFiles_paths.clear();
+        m_mappedFiles_files.clear();
+        m_mappedFiles_lastTimeUsed.clear();
+    }
+} // namespace AZ::IO
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ::IO
+{
+    class MemoryMappedFile;
+
+    struct MemoryMappedReaderConfig final :
+        public IStreamerStackConfig
+    {
+        AZ_RTTI(AZ::IO::MemoryMappedReaderConfig, "{E9E4BB74-970B-4B02-8E9C-62438AC4F229}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(MemoryMappedReaderConfig, AZ::SystemAllocator, 0);
+
+        ~MemoryMappedReaderConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(AZ::ReflectContext* context);
+
+        //! The maximum number of archives that are kept mapped. Views that are still in use keep their archive mapped even if
+        //! it's no longer tracked by the reader.
+        u32 m_maxMappedFiles{ 16 };
+    };
+
+    //! Provides read-only views into memory mapped archives for read requests that allow it, instead of copying the data into
+    //! a buffer. This avoids a full copy of the data as well as having the data held in caches such as the BlockCache. The
+    //! view is kept alive by the request, so the memory stays available until the last reference to the request is released.
+    //! Only uncompressed reads from archives are served as views. All other reads, including reads from loose files which may
+    //! still change while the view is in use, are passed on to the next entry in the stack. This entry needs to be placed
+    //! above any caches, typically directly below the FullFileDecompressor.
+    class MemoryMappedReader
+        : public StreamStackEntry
+    {
+    public:
+        MemoryMappedReader(u32 maxMappedFiles, u64 memoryAlignment, u64 sizeAlignment);
+
+        void SetContext(StreamerContext& context) override;
+
+        void QueueRequest(FileRequest* request) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    private:
+        void ReadFile(FileRequest* request, FileRequest::ReadData& data);
+        static bool IsRedirectedToArchive(const FileRequest* request);
+        bool ProvideView(FileRequest* request, FileRequest::ReadData& data, FileRequest::ReadRequestData& readRequest);
+        bool AllocateOutput(FileRequest* request, FileRequest::ReadData& data, FileRequest::ReadRequestData& readRequest);
+
+        //! Returns the mapping for the file, mapping the file if needed. Returns null if the file can't be mapped.
+        AZStd::shared_ptr<MemoryMappedFile> GetMappedFile(const RequestPath& filePath);
+        size_t FindMappedFile(const RequestPath& filePath) const;
+        size_t FindAvailableMappedFileIndex() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        //! Recommendations used to allocate memory for reads that can't be served as a view.
+        IStreamerTypes::Recommendations m_recommendations;
+
+        AZStd::vector<RequestPath> m_mappedFiles_paths;
+        //! Mapped files. A null entry means that the file couldn't be mapped, which is remembered to avoid trying again on every read.
+        AZStd::vector<AZStd::shared_ptr<MemoryMappedFile>> m_mappedFiles_files;
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_mappedFiles_lastTimeUsed;
+
+        AZ::Statistics::RunningStatistic m_viewPercentageStat;
+        u64 m_viewBytes{ 0 };
+
+        u32 m_maxMappedFiles;
+    };
+} // namespace AZ::IO
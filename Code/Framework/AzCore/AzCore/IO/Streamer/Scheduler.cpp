@@ -129,6 +129,16 @@ namespace AZ::IO
         recommendations = m_recommendations;
     }
 
+    void Scheduler::StartTraceRecording()
+    {
+        m_traceRecorder.Start();
+    }
+
+    bool Scheduler::StopTraceRecording(StreamerTrace& trace)
+    {
+        return m_traceRecorder.Stop(trace);
+    }
+
     void Scheduler::Thread_MainLoop()
     {
         m_threadData.m_streamStack->SetContext(m_context);
@@ -223,7 +233,14 @@ namespace AZ::IO
                 AZ_Assert(parentReadRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
                 
                 size_t size = parentReadRequest->m_size;
-                if (parentReadRequest->m_output == nullptr)
+                bool deferAllocation = false;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+                {
+                    // A node in the stack may be able to provide a view into the file, in which case it will also take care of
+                    // allocating memory if it ends up not being able to.
+                    deferAllocation = parentReadRequest->m_allowReadOnlyView && m_context.AreReadOnlyViewsEnabled();
+                }
+                if (parentReadRequest->m_output == nullptr && !deferAllocation)
                 {
                     AZ_Assert(parentReadRequest->m_allocator,
                         "The read request was issued without a memory allocator or valid output address.");
@@ -356,11 +373,24 @@ namespace AZ::IO
         {
             AZStd::visit(visitor, request->m_request.GetCommand());
         }
+        bool isRecording = m_traceRecorder.IsRecording();
         for (auto& request : outstandingRequests)
         {
             // Add a link in front of the external request to keep a reference to the FileRequestPtr alive while it's being processed.
             FileRequest* requestPtr = &request->m_request;
             FileRequest* linkRequest = m_context.GetNewInternalRequest();
+            if (isRecording)
+            {
+                if (auto readRequest = AZStd::get_if<FileRequest::ReadRequestData>(&requestPtr->GetCommand()); readRequest != nullptr)
+                {
+                    // The link completes after the request it's linked to, so it can be used to record the completion.
+                    StreamerTraceRecorder::Ticket ticket = m_traceRecorder.RecordIssue(*readRequest);
+                    linkRequest->SetCompletionCallback([this, ticket](FileRequest& link)
+                        {
+                            m_traceRecorder.RecordCompletion(ticket, link.GetStatus());
+                        });
+                }
+            }
             linkRequest->CreateRequestLink(AZStd::move(request));
             requestPtr->SetStatus(IStreamerTypes::RequestStatus::Queued);
             m_threadData.m_streamStack->PrepareRequest(requestPtr);
@@ -11,6 +11,7 @@
 #include <AzCore/IO/Streamer/Statistics.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
@@ -52,6 +53,12 @@ namespace AZ::IO
 
         void GetRecommendations(IStreamerTypes::Recommendations& recommendations) const;
 
+        //! Starts recording all read requests that are picked up by the scheduler. Any previous recording is discarded.
+        void StartTraceRecording();
+        //! Stops recording read requests and moves the recorded requests into the provided trace.
+        //! @return False if no recording was in progress.
+        bool StopTraceRecording(StreamerTrace& trace);
+
     private:
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
 
@@ -73,6 +80,9 @@ namespace AZ::IO
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
 
+        //! Declared before the stream stack so it's destroyed after it, stack entries can still complete requests on destruction.
+        StreamerContext m_context;
+
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
         {
@@ -84,7 +94,7 @@ namespace AZ::IO
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
         };
         ThreadData m_threadData;
-        StreamerContext m_context;
+        StreamerTraceRecorder m_traceRecorder;
 
         IStreamerTypes::Recommendations m_recommendations;
 
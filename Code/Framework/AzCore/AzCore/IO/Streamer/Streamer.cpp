@@ -54,6 +54,27 @@ namespace AZ::IO
         return request;
     }
 
+    FileRequestPtr Streamer::ReadView(AZStd::string_view relativePath, IStreamerTypes::RequestMemoryAllocator& allocator,
+        size_t size, AZStd::chrono::microseconds deadline, IStreamerTypes::Priority priority, size_t offset)
+    {
+        FileRequestPtr result = CreateRequest();
+        ReadView(result, relativePath, allocator, size, deadline, priority, offset);
+        return result;
+    }
+
+    FileRequestPtr& Streamer::ReadView(FileRequestPtr& request, AZStd::string_view relativePath,
+        IStreamerTypes::RequestMemoryAllocator& allocator, size_t size, AZStd::chrono::microseconds deadline,
+        IStreamerTypes::Priority priority, size_t offset)
+    {
+        RequestPath path;
+        path.InitFromRelativePath(relativePath);
+        AZStd::chrono::system_clock::time_point deadlineTimePoint = (deadline == IStreamerTypes::s_noDeadline)
+            ? FileRequest::s_noDeadlineTime
+            : AZStd::chrono::system_clock::now() + deadline;
+        request->m_request.CreateReadRequest(AZStd::move(path), &allocator, offset, size, deadlineTimePoint, priority, true);
+        return request;
+    }
+
     FileRequestPtr Streamer::Cancel(FileRequestPtr target)
     {
         FileRequestPtr result = CreateRequest();
@@ -215,6 +236,15 @@ namespace AZ::IO
             numBytesRead = readRequest->m_size;
             if (claimMemory == IStreamerTypes::ClaimMemory::Yes)
             {
+                if (readRequest->m_allowReadOnlyView)
+                {
+                    // The buffer may be a view into a mapped file, so ownership stays with the request.
+                    AZ_Error("Streamer", false, "Memory for a read request that allows read-only views can't be claimed as it may not be "
+                        "owned by the allocator. Copy the data instead if it needs to outlive the request.");
+                    buffer = nullptr;
+                    numBytesRead = 0;
+                    return false;
+                }
                 AZ_Assert(HasRequestCompleted(request), "Claiming memory from a read request that's still in progress. "
                     "This can lead to crashing if data is still being streamed to the request's buffer.");
                 // The caller has claimed the buffer and is now responsible for clearing it. 
@@ -292,6 +322,23 @@ namespace AZ::IO
         return request;
     }
     
+    void Streamer::StartTraceRecording()
+    {
+        m_streamStack->StartTraceRecording();
+    }
+
+    bool Streamer::StopTraceRecording(const char* filePath)
+    {
+        StreamerTrace trace;
+        if (!m_streamStack->StopTraceRecording(trace))
+        {
+            AZ_Warning("Streamer", false, "Unable to store Streamer trace because no trace was being recorded.");
+            return false;
+        }
+        AZ_TracePrintf("Streamer", "Storing %zu recorded read requests to '%s'.\n", trace.GetRecords().size(), filePath);
+        return trace.Save(filePath);
+    }
+
     Streamer::Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack)
         : m_streamStack(AZStd::move(streamStack))
     {
@@ -58,6 +58,16 @@ namespace AZ::IO
             size_t size, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
             IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium, size_t offset = 0) override;
 
+        //! Creates a request to read a file that can be served as a read-only view into the file.
+        FileRequestPtr ReadView(AZStd::string_view relativePath, IStreamerTypes::RequestMemoryAllocator& allocator,
+            size_t size, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium, size_t offset = 0) override;
+
+        //! Sets a request to the read command that can be served as a read-only view into the file.
+        FileRequestPtr& ReadView(FileRequestPtr& request, AZStd::string_view relativePath, IStreamerTypes::RequestMemoryAllocator& allocator,
+            size_t size, AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline,
+            IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium, size_t offset = 0) override;
+
 
         //! Creates a request to cancel a previously queued request.
         FileRequestPtr Cancel(FileRequestPtr target) override;
@@ -188,6 +198,13 @@ namespace AZ::IO
         //! Tells AZ::IO::Streamer the report the information for the report to the output.
         FileRequestPtr& Report(FileRequestPtr& request, FileRequest::ReportData::ReportType reportType);
 
+        //! Starts recording all read requests to a trace that can be replayed later to benchmark stream stack configurations.
+        //! Any previous recording that wasn't stopped is discarded.
+        void StartTraceRecording();
+        //! Stops recording read requests and stores the trace at the provided absolute path.
+        //! @return True if a recording was in progress and the trace was successfully stored, otherwise false.
+        bool StopTraceRecording(const char* filePath);
+
 
         Streamer(const AZStd::thread_desc& threadDesc, AZStd::unique_ptr<Scheduler> streamStack);
         ~Streamer() override;
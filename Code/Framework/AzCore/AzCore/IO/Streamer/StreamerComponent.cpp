@@ -9,10 +9,13 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/ProfilerBus.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IStreamer.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/BlockCache.h>
 #include <AzCore/IO/Streamer/DedicatedCache.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
@@ -173,8 +176,10 @@ namespace AZ
         incompatible.push_back(AZ_CRC_CE("DataStreamingService"));
     }
 
-    void StreamerComponent::GetDependentServices([[maybe_unused]] ComponentDescriptor::DependencyArrayType& dependent)
+    void StreamerComponent::GetDependentServices(ComponentDescriptor::DependencyArrayType& dependent)
     {
+        // The decompressor can run its jobs on the global job manager, so activate after it if it's available.
+        dependent.push_back(AZ_CRC_CE("JobsService"));
     }
 
     //=========================================================================
@@ -193,6 +198,7 @@ namespace AZ
         DedicatedCacheConfig::Reflect(context);
         IStreamerStackConfig::Reflect(context);
         FullFileDecompressorConfig::Reflect(context);
+        MemoryMappedReaderConfig::Reflect(context);
         ReadSplitterConfig::Reflect(context);
         StorageDriveConfig::Reflect(context);
         StreamerConfig::Reflect(context);
@@ -214,4 +220,26 @@ namespace AZ
             m_streamer->QueueRequest(m_streamer->FlushCaches());
         }
     }
+
+    void StreamerComponent::StartTraceRecording(const AZ::ConsoleCommandContainer&)
+    {
+        if (m_streamer)
+        {
+            m_streamer->StartTraceRecording();
+        }
+    }
+
+    void StreamerComponent::StopTraceRecording(const AZ::ConsoleCommandContainer& someStrings)
+    {
+        if (m_streamer)
+        {
+            AZ::IO::PathView tracePath = someStrings.empty() ? AZ::IO::PathView("@user@/Streamer/Trace.azstrace") : someStrings.front();
+            AZ::IO::FixedMaxPath resolvedPath(tracePath);
+            if (auto fileIO = AZ::IO::FileIOBase::GetInstance(); fileIO != nullptr)
+            {
+                fileIO->ResolvePath(resolvedPath, tracePath);
+            }
+            m_streamer->StopTraceRecording(resolvedPath.c_str());
+        }
+    }
 } // namespace AZ
@@ -55,11 +55,18 @@ namespace AZ
 
         void ReportFileLocks(const AZ::ConsoleCommandContainer& someStrings);
         void FlushCaches(const AZ::ConsoleCommandContainer& someStrings);
+        void StartTraceRecording(const AZ::ConsoleCommandContainer& someStrings);
+        void StopTraceRecording(const AZ::ConsoleCommandContainer& someStrings);
 
         AZ_CONSOLEFUNC(StreamerComponent, ReportFileLocks, AZ::ConsoleFunctorFlags::Null,
             "Reports the files currently locked by AZ::IO::Streamer");
         AZ_CONSOLEFUNC(StreamerComponent, FlushCaches, AZ::ConsoleFunctorFlags::Null,
             "Flushes all caches used inside AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StartTraceRecording, AZ::ConsoleFunctorFlags::Null,
+            "Starts recording all read requests processed by AZ::IO::Streamer");
+        AZ_CONSOLEFUNC(StreamerComponent, StopTraceRecording, AZ::ConsoleFunctorFlags::Null,
+            "Stops recording read requests and stores the trace. Optionally takes the path to store the trace at, "
+            "which defaults to @user@/Streamer/Trace.azstrace");
         
         AZStd::unique_ptr<AZ::IO::Streamer> m_streamer;
         int m_deviceThreadCpuId;
@@ -262,6 +262,16 @@ namespace AZ
             return m_threadSync;
         }
 
+        void StreamerContext::EnableReadOnlyViews()
+        {
+            m_readOnlyViewsEnabled = true;
+        }
+
+        bool StreamerContext::AreReadOnlyViewsEnabled() const
+        {
+            return m_readOnlyViewsEnabled;
+        }
+
         void StreamerContext::CollectStatistics(AZStd::vector<Statistic>& statistics)
         {
             statistics.push_back(
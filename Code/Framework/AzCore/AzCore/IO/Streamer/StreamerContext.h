@@ -85,6 +85,12 @@ namespace AZ
             //! Returns the native primitive(s) used to suspend and wake up the scheduling thread and possibly other threads.
             AZ::Platform::StreamerContextThreadSync& GetStreamerThreadSynchronizer();
 
+            //! Called by a node in the stack that can provide read-only views into files. When set, the scheduler leaves the allocation
+            //! of memory for reads that accept a view to the stack.
+            void EnableReadOnlyViews();
+            //! Whether or not a node in the stack can provide read-only views into files.
+            bool AreReadOnlyViewsEnabled() const;
+
             //! Collects statistics recorded during processing. This will only return statistics for the
             //! context. Use the CollectStatistics on AZ::IO::Streamer to get all statistics.
             void CollectStatistics(AZStd::vector<Statistic>& statistics);
@@ -126,6 +132,7 @@ namespace AZ
             AZ::Platform::StreamerContextThreadSync m_threadSync;
 
             size_t m_pendingIdCounter{ 0 };
+            bool m_readOnlyViewsEnabled{ false };
         };
     } // namespace IO
 } // namespace AZ
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+
+namespace AZ::IO
+{
+    namespace StreamerTraceInternal
+    {
+        struct FileHeader
+        {
+            u32 m_identifier;
+            u32 m_version;
+            u64 m_numRecords;
+            u32 m_numPaths;
+            u32 m_padding;
+        };
+    } // namespace StreamerTraceInternal
+
+    //
+    // StreamerTrace
+    //
+
+    u32 StreamerTrace::AddPath(AZStd::string_view path)
+    {
+        AZStd::string key(path);
+        auto it = m_pathLookup.find(key);
+        if (it != m_pathLookup.end())
+        {
+            return it->second;
+        }
+
+        u32 index = aznumeric_caster(m_paths.size());
+        m_paths.push_back(key);
+        m_pathLookup.emplace(AZStd::move(key), index);
+        return index;
+    }
+
+    const AZStd::string& StreamerTrace::GetPath(u32 index) const
+    {
+        AZ_Assert(index < m_paths.size(), "Path index %u is out of range for the %zu paths in the Streamer trace.", index, m_paths.size());
+        return m_paths[index];
+    }
+
+    const AZStd::vector<AZStd::string>& StreamerTrace::GetPaths() const
+    {
+        return m_paths;
+    }
+
+    void StreamerTrace::AddRecord(const StreamerTraceRecord& record)
+    {
+        m_records.push_back(record);
+    }
+
+    AZStd::vector<StreamerTraceRecord>& StreamerTrace::GetRecords()
+    {
+        return m_records;
+    }
+
+    const AZStd::vector<StreamerTraceRecord>& StreamerTrace::GetRecords() const
+    {
+        return m_records;
+    }
+
+    void StreamerTrace::Clear()
+    {
+        m_paths.clear();
+        m_pathLookup.clear();
+        m_records.clear();
+    }
+
+    bool StreamerTrace::Save(const char* filePath) const
+    {
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to open '%s' to store the Streamer trace.", filePath);
+            return false;
+        }
+
+        StreamerTraceInternal::FileHeader header;
+        header.m_identifier = s_fileIdentifier;
+        header.m_version = s_fileVersion;
+        header.m_numRecords = m_records.size();
+        header.m_numPaths = aznumeric_caster(m_paths.size());
+        header.m_padding = 0;
+        if (file.Write(&header, sizeof(header)) != sizeof(header))
+        {
+            return false;
+        }
+
+        for (const AZStd::string& path : m_paths)
+        {
+            u32 length = aznumeric_caster(path.length());
+            if (file.Write(&length, sizeof(length)) != sizeof(length) ||
+                file.Write(path.data(), length) != length)
+            {
+                return false;
+            }
+        }
+
+        SystemFile::SizeType recordsSize = m_records.size() * sizeof(StreamerTraceRecord);
+        return file.Write(m_records.data(), recordsSize) == recordsSize;
+    }
+
+    bool StreamerTrace::Load(const char* filePath)
+    {
+        Clear();
+
+        SystemFile file;
+        if (!file.Open(filePath, SystemFile::SF_OPEN_READ_ONLY))
+        {
+            AZ_Warning("Streamer", false, "Unable to open Streamer trace '%s'.", filePath);
+            return false;
+        }
+
+        StreamerTraceInternal::FileHeader header;
+        if (file.Read(sizeof(header), &header) != sizeof(header) ||
+            header.m_identifier != s_fileIdentifier)
+        {
+            AZ_Warning("Streamer", false, "'%s' is not a Streamer trace.", filePath);
+            return false;
+        }
+        if (header.m_version != s_fileVersion)
+        {
+            AZ_Warning("Streamer", false, "Streamer trace '%s' has version %u, but only version %u is supported.",
+                filePath, header.m_version, s_fileVersion);
+            return false;
+        }
+
+        m_paths.reserve(header.m_numPaths);
+        for (u32 i = 0; i < header.m_numPaths; ++i)
+        {
+            u32 length = 0;
+            if (file.Read(sizeof(length), &length) != sizeof(length))
+            {
+                Clear();
+                return false;
+            }
+            AZStd::string path;
+            path.resize_no_construct(length);
+            if (file.Read(length, path.data()) != length)
+            {
+                Clear();
+                return false;
+            }
+            AddPath(path);
+        }
+
+        m_records.resize_no_construct(header.m_numRecords);
+        SystemFile::SizeType recordsSize = m_records.size() * sizeof(StreamerTraceRecord);
+        if (file.Read(recordsSize, m_records.data()) != recordsSize)
+        {
+            Clear();
+            return false;
+        }
+
+        for (const StreamerTraceRecord& record : m_records)
+        {
+            if (record.m_pathIndex >= m_paths.size())
+            {
+                AZ_Warning("Streamer", false, "Streamer trace '%s' contains a record that references an unknown path.", filePath);
+                Clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //
+    // StreamerTraceRecorder
+    //
+
+    void StreamerTraceRecorder::Start()
+    {
+        AZStd::scoped_lock lock(m_lock);
+        m_trace.Clear();
+        m_startTime = AZStd::chrono::system_clock::now();
+        ++m_session;
+        m_isRecording = true;
+    }
+
+    bool StreamerTraceRecorder::Stop(StreamerTrace& trace)
+    {
+        AZStd::scoped_lock lock(m_lock);
+        if (!m_isRecording)
+        {
+            return false;
+        }
+        m_isRecording = false;
+        trace = AZStd::move(m_trace);
+        m_trace.Clear();
+        return true;
+    }
+
+    bool StreamerTraceRecorder::IsRecording() const
+    {
+        return m_isRecording;
+    }
+
+    auto StreamerTraceRecorder::RecordIssue(const FileRequest::ReadRequestData& request) -> Ticket
+    {
+        auto now = AZStd::chrono::system_clock::now();
+
+        AZStd::scoped_lock lock(m_lock);
+        Ticket ticket;
+        ticket.m_session = m_session;
+        ticket.m_index = aznumeric_caster(m_trace.GetRecords().size());
+
+        StreamerTraceRecord record;
+        record.m_issueTimeUs = aznumeric_caster(AZStd::chrono::microseconds(now - m_startTime).count());
+        record.m_offset = request.m_offset;
+        record.m_size = request.m_size;
+        record.m_deadlineUs = (request.m_deadline == FileRequest::s_noDeadlineTime)
+            ? StreamerTraceRecord::s_noDeadline
+            : aznumeric_cast<s64>(AZStd::chrono::microseconds(request.m_deadline - now).count());
+        record.m_pathIndex = m_trace.AddPath(request.m_path.GetRelativePath());
+        record.m_priority = request.m_priority;
+        record.m_status = aznumeric_caster(static_cast<int>(IStreamerTypes::RequestStatus::Pending));
+        record.m_flags = request.m_allowReadOnlyView ? StreamerTraceRecord::s_flagAllowReadOnlyView : 0;
+        m_trace.AddRecord(record);
+
+        return ticket;
+    }
+
+    void StreamerTraceRecorder::RecordCompletion(Ticket ticket, IStreamerTypes::RequestStatus status)
+    {
+        auto now = AZStd::chrono::system_clock::now();
+
+        AZStd::scoped_lock lock(m_lock);
+        AZStd::vector<StreamerTraceRecord>& records = m_trace.GetRecords();
+        if (m_isRecording && ticket.m_session == m_session && ticket.m_index < records.size())
+        {
+            StreamerTraceRecord& record = records[ticket.m_index];
+            record.m_completionTimeUs = aznumeric_caster(AZStd::chrono::microseconds(now - m_startTime).count());
+            record.m_status = aznumeric_caster(static_cast<int>(status));
+            record.m_flags |= StreamerTraceRecord::s_flagCompleted;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::IO
+{
+    //! A single read request recorded in a StreamerTrace.
+    struct StreamerTraceRecord
+    {
+        inline static constexpr s64 s_noDeadline = AZStd::numeric_limits<s64>::max();
+        //! The request allowed a read-only view into the file to be returned.
+        inline static constexpr u8 s_flagAllowReadOnlyView = 1 << 0;
+        //! The request completed while the trace was being recorded.
+        inline static constexpr u8 s_flagCompleted = 1 << 1;
+
+        u64 m_issueTimeUs{ 0 }; //!< Time since the start of the recording at which the request was picked up by the scheduler.
+        u64 m_completionTimeUs{ 0 }; //!< Time since the start of the recording at which the request completed.
+        u64 m_offset{ 0 }; //!< The offset in bytes into the file.
+        u64 m_size{ 0 }; //!< The number of bytes read from the file.
+        //! Deadline relative to the issue time. This can be negative if the deadline had already passed when the request was issued.
+        s64 m_deadlineUs{ s_noDeadline };
+        //! Index into the path table of the trace. Paths are stored without their alias so traces can be replayed from other locations.
+        u32 m_pathIndex{ 0 };
+        IStreamerTypes::Priority m_priority{ IStreamerTypes::s_priorityMedium };
+        u8 m_status{ 0 }; //!< The IStreamerTypes::RequestStatus the request completed with.
+        u8 m_flags{ 0 };
+        u8 m_padding{ 0 };
+    };
+    static_assert(sizeof(StreamerTraceRecord) == 48, "StreamerTraceRecord is written directly to disk and changing its size breaks the file format.");
+
+    //! A recording of read requests processed by AZ::IO::Streamer. Traces can be stored in a compact binary format so they
+    //! can be replayed later against different stream stack configurations.
+    class StreamerTrace
+    {
+    public:
+        inline static constexpr u32 s_fileIdentifier = 0x5453'5A41; // "AZST"
+        inline static constexpr u32 s_fileVersion = 1;
+
+        //! Adds a path to the path table if it's not already in there and returns its index.
+        u32 AddPath(AZStd::string_view path);
+        const AZStd::string& GetPath(u32 index) const;
+        const AZStd::vector<AZStd::string>& GetPaths() const;
+
+        void AddRecord(const StreamerTraceRecord& record);
+        AZStd::vector<StreamerTraceRecord>& GetRecords();
+        const AZStd::vector<StreamerTraceRecord>& GetRecords() const;
+
+        void Clear();
+
+        //! Writes the trace to the file at the given absolute path. The data is stored in the native byte order.
+        bool Save(const char* filePath) const;
+        //! Reads a trace from the file at the given absolute path, replacing the current content.
+        bool Load(const char* filePath);
+
+    private:
+        AZStd::vector<AZStd::string> m_paths;
+        AZStd::unordered_map<AZStd::string, u32> m_pathLookup;
+        AZStd::vector<StreamerTraceRecord> m_records;
+    };
+
+    //! Records the read requests handled by the scheduler into a StreamerTrace. Recording can be started and stopped from any
+    //! thread, while the requests are recorded on the scheduler's thread.
+    class StreamerTraceRecorder
+    {
+    public:
+        //! Identifies a recorded request so its completion can be added later.
+        struct Ticket
+        {
+            u32 m_session{ 0 };
+            u32 m_index{ 0 };
+        };
+
+        void Start();
+        //! Stops the recording and moves the recorded requests into the provided trace.
+        //! @return False if no recording was in progress.
+        bool Stop(StreamerTrace& trace);
+        bool IsRecording() const;
+
+        //! Records a request that was picked up by the scheduler.
+        Ticket RecordIssue(const FileRequest::ReadRequestData& request);
+        //! Records the completion of a previously recorded request. Completions for requests that were issued in a
+        //! previous recording session are ignored.
+        void RecordCompletion(Ticket ticket, IStreamerTypes::RequestStatus status);
+
+    private:
+        AZStd::mutex m_lock;
+        StreamerTrace m_trace;
+        AZStd::chrono::system_clock::time_point m_startTime;
+        u32 m_session{ 0 };
+        AZStd::atomic_bool m_isRecording{ false };
+    };
+} // namespace AZ::IO
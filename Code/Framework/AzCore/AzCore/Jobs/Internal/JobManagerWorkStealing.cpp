@@ -12,13 +12,11 @@
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/exponential_backoff.h>
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
 
-#ifdef JOBMANAGER_ENABLE_STATS
-#   include <stdio.h>
-#endif
 
 using namespace AZ;
 using namespace AZ::Internal;
@@ -30,51 +28,102 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
 
 void WorkQueue::LocalInsert(Job* job)
 {
-    LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
-                                                                                   job->GetPriority(),
+    const AZ::s8 priority = job->GetPriority();
+    if (priority == 0)
+    {
+        m_defaultPriorityJobs.Push(job);
+        return;
+    }
+
+    LockGuard lock(m_prioritizedJobsLock);
+    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_prioritizedJobs.begin(),
+                                                                                   m_prioritizedJobs.end(),
+                                                                                   priority,
                                                                                    CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    m_prioritizedJobs.insert(locationToinsert, job);
+    AZStd::atomic_uint& counter = priority > 0 ? m_numHigherPriorityJobs : m_numLowerPriorityJobs;
+    counter.fetch_add(1, AZStd::memory_order_release);
 }
 
 Job* WorkQueue::LocalPopFront()
 {
-    LockGuard lock(m_lock);
-
     Job* result = nullptr;
-    if (!m_queue.empty())
+    if (m_numHigherPriorityJobs.load(AZStd::memory_order_acquire) > 0)
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        result = PopPrioritizedJob(true);
+    }
+    if (!result && !m_defaultPriorityJobs.Steal(result) && m_numLowerPriorityJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = PopPrioritizedJob(true);
     }
-
     return result;
 }
 
 Job* WorkQueue::TryStealFront()
 {
-    AZStd::exponential_backoff backoff;
-    for (unsigned attempCount = 0; attempCount < TryStealSpinAttemps; ++attempCount)
+    Job* result = nullptr;
+    if (m_numHigherPriorityJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = PopPrioritizedJob(false);
+    }
+    if (!result && !m_defaultPriorityJobs.Steal(result) && m_numLowerPriorityJobs.load(AZStd::memory_order_acquire) > 0)
+    {
+        result = PopPrioritizedJob(false);
+    }
+    return result;
+}
+
+AZ::u64 WorkQueue::GetApproximateSize() const
+{
+    return m_defaultPriorityJobs.GetApproximateSize() +
+        m_numHigherPriorityJobs.load(AZStd::memory_order_relaxed) +
+        m_numLowerPriorityJobs.load(AZStd::memory_order_relaxed);
+}
+
+bool WorkQueue::IsEmpty() const
+{
+    return m_defaultPriorityJobs.IsEmpty() &&
+        m_numHigherPriorityJobs.load(AZStd::memory_order_acquire) == 0 &&
+        m_numLowerPriorityJobs.load(AZStd::memory_order_acquire) == 0;
+}
+
+void WorkQueue::CollectGarbage()
+{
+    m_defaultPriorityJobs.CollectGarbage();
+}
+
+Job* WorkQueue::PopPrioritizedJob(bool isOwner)
+{
+    if (isOwner)
+    {
+        m_prioritizedJobsLock.lock();
+    }
+    else
     {
-        // Do a bounded spin with backoff to acquire the lock
-        if (m_lock.try_lock())
+        // Do a bounded spin with backoff to acquire the lock, thieves should never block
+        AZStd::exponential_backoff backoff;
+        unsigned attempCount = 0;
+        while (!m_prioritizedJobsLock.try_lock())
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
+            if (++attempCount >= TryStealSpinAttemps)
             {
-                result = m_queue.front();
-                m_queue.pop_front();
+                return nullptr;
             }
-
-            m_lock.unlock();
-            return result;
+            backoff.wait();
         }
+    }
 
-        backoff.wait();
+    Job* result = nullptr;
+    if (!m_prioritizedJobs.empty())
+    {
+        result = m_prioritizedJobs.front();
+        m_prioritizedJobs.pop_front();
+        AZStd::atomic_uint& counter = result->GetPriority() > 0 ? m_numHigherPriorityJobs : m_numLowerPriorityJobs;
+        counter.fetch_sub(1, AZStd::memory_order_release);
     }
 
-    return nullptr;
+    m_prioritizedJobsLock.unlock();
+    return result;
 }
 
 
@@ -83,7 +132,16 @@ AZ_THREAD_LOCAL JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::m_cu
 JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
+    , m_globalJobQueues(AZStd::move(CreateGlobalQueueShards(desc.m_workerThreads.size())))
 {
+    m_ticksPerMicrosecond = AZStd::max<AZStd::sys_time_t>(AZStd::GetTimeTicksPerSecond() / 1000000, 1);
+    m_maxSpinTime = static_cast<AZStd::sys_time_t>(desc.m_workerSpinTimeMicroseconds) * AZStd::GetTimeTicksPerSecond() / 1000000;
+    m_backgroundStarvationLimit = desc.m_backgroundLaneStarvationLimit;
+    for (ThreadInfo* info : m_workerThreads)
+    {
+        info->m_spinTime = m_maxSpinTime;
+    }
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -107,6 +165,11 @@ JobManagerWorkStealing::~JobManagerWorkStealing()
     {
         delete thread;
     }
+
+    for (GlobalQueueShard* shard : m_globalJobQueues)
+    {
+        delete shard;
+    }
 }
 
 void JobManagerWorkStealing::AddPendingJob(Job* job)
@@ -136,47 +199,35 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         if (info)
         {
             info->m_currentJob = currentJob;
-#ifdef JOBMANAGER_ENABLE_STATS
-            ++info->m_jobsDone;
-#endif
+            AddTelemetry(info->m_telemetry.m_jobsDone);
         }
     }
     else if (info && info->m_isWorker && (info->m_owningManager == this))
     {
-        //current thread is a worker, insert into the local queue based on the job's priority
-        info->m_pendingJobs.LocalInsert(job);
-#ifdef JOBMANAGER_ENABLE_STATS
-        ++info->m_jobsForked;
-#endif
+        //current thread is a worker, insert into the local queue of the job's lane based on the job's priority
+        info->m_pendingJobs[static_cast<size_t>(job->GetLane())].LocalInsert(job);
+        AddTelemetry(info->m_telemetry.m_jobsForked);
+        const AZ::u64 localQueueDepth = GetLocalQueueDepth(info);
+        if (localQueueDepth > info->m_telemetry.m_maxLocalQueueDepth.load(AZStd::memory_order_relaxed))
+        {
+            info->m_telemetry.m_maxLocalQueueDepth.store(localQueueDepth, AZStd::memory_order_relaxed);
+        }
+        // the local queue publishes with relaxed stores, make the job visible before checking for spinning or available workers
+        AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
         // if there are threads asleep wake one up
         ActivateWorker();
     }
     else
     {
         //current thread is not a worker thread, insert into the global queue based on the job's priority
+        PushGlobalJob(job);
         if (IsAsynchronous())
         {
-            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
-
-            //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
+            //the job is published before checking worker availability, see ProcessJobsInternal for the other half of this handshake
             ActivateWorker();
         }
         else
         {
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                           m_globalJobQueue.end(),
-                                                                                           job->GetPriority(),
-                                                                                           CompareJobPriorities);
-                m_globalJobQueue.insert(locationToinsert, job);
-            }
-
             //no workers, so must process the jobs right now
             if (!info)  //unless we're already processing
             {
@@ -233,40 +284,128 @@ void JobManagerWorkStealing::StartJobAndAssistUntilComplete(Job* job)
     AZ_Assert(notifyFlag.load(AZStd::memory_order_acquire), "");
 }
 
+void JobManagerWorkStealing::CollectGarbage()
+{
+    for (ThreadInfo* info : m_workerThreads)
+    {
+        for (WorkQueue& pendingJobs : info->m_pendingJobs)
+        {
+            pendingJobs.CollectGarbage();
+        }
+    }
+}
+
 void JobManagerWorkStealing::ClearStats()
 {
-#ifdef JOBMANAGER_ENABLE_STATS
-    for (unsigned int i = 0; i < m_threads.size(); ++i)
+    AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+    for (ThreadInfo* info : m_threads)
     {
-        ThreadInfo* info = m_threads[i];
-        info->m_globalJobs = 0;
-        info->m_jobsForked = 0;
-        info->m_jobsDone = 0;
-        info->m_jobsStolen = 0;
-        info->m_jobTime = 0;
-        info->m_stealTime = 0;
+        info->m_telemetry.Reset();
     }
-#endif
 }
 
 void JobManagerWorkStealing::PrintStats()
 {
-#ifdef JOBMANAGER_ENABLE_STATS
-    char str[256];
-    printf("===================================================\n");
-    printf("Job System Stats:\n");
-    printf("Thread   Global jobs    Forks/dependents   Jobs done   Jobs stolen    Job time (ms)  Steal time (ms)  Total time (ms)\n");
-    printf("------   -------------  -----------------  ----------  ------------   -------------  ---------------  ---------------\n");
-    for (unsigned int i = 0; i < m_threads.size(); ++i)
-    {
-        ThreadInfo* info = m_threads[i];
-        double jobTime = 1000.0f * static_cast<double>(info->m_jobTime) / AZStd::GetTimeTicksPerSecond();
-        double stealTime = 1000.0f * static_cast<double>(info->m_stealTime) / AZStd::GetTimeTicksPerSecond();
-        azsnprintf(str, AZ_ARRAY_SIZE(str),  " %d:        %5d          %5d           %5d         %5d            %3.2f           %3.2f         %3.2f\n",
-            i, info->m_globalJobs, info->m_jobsForked, info->m_jobsDone, info->m_jobsStolen, jobTime, stealTime, jobTime + stealTime);
-        printf(str);
+    const JobManagerTelemetry telemetry = GetTelemetry();
+
+    AZ_Printf("JobManager", "===================================================\n");
+    AZ_Printf("JobManager", "Job System Stats:\n");
+    AZ_Printf("JobManager", "Thread   Global jobs    Forks/dependents   Jobs done   Steals/attempts    Job time (ms)  Steal time (ms)  Total time (ms)\n");
+    AZ_Printf("JobManager", "------   -------------  -----------------  ----------  ----------------   -------------  ---------------  ---------------\n");
+    for (size_t i = 0; i < telemetry.m_threads.size(); ++i)
+    {
+        const JobManagerThreadTelemetry& thread = telemetry.m_threads[i];
+        const double jobTime = static_cast<double>(thread.m_jobTimeMicroseconds) / 1000.0;
+        const double stealTime = static_cast<double>(thread.m_stealTimeMicroseconds) / 1000.0;
+        AZ_Printf("JobManager", " %zu:        %5llu          %5llu           %5llu      %5llu/%-5llu          %3.2f           %3.2f         %3.2f\n",
+            i, thread.m_globalJobs, thread.m_jobsForked, thread.m_jobsDone, thread.m_jobsStolen, thread.m_stealAttempts,
+            jobTime, stealTime, jobTime + stealTime);
+    }
+
+    AZ_Printf("JobManager", "\n");
+    AZ_Printf("JobManager", "Thread   Wakeups   Futile wakeups   Spin hits   Avg wake latency (us)   Local queue depth (now/max)\n");
+    AZ_Printf("JobManager", "------   -------   --------------   ---------   ---------------------   ---------------------------\n");
+    for (size_t i = 0; i < telemetry.m_threads.size(); ++i)
+    {
+        const JobManagerThreadTelemetry& thread = telemetry.m_threads[i];
+        const double wakeLatency = thread.m_wakeups ? static_cast<double>(thread.m_wakeLatencyMicroseconds) / thread.m_wakeups : 0.0;
+        AZ_Printf("JobManager", " %zu:      %5llu        %5llu            %5llu          %3.2f                  %5llu/%-5llu\n",
+            i, thread.m_wakeups, thread.m_futileWakeups, thread.m_spinHits, wakeLatency, thread.m_localQueueDepth, thread.m_maxLocalQueueDepth);
+    }
+
+    const JobManagerThreadTelemetry totals = telemetry.GetTotals();
+    AZ_Printf("JobManager", "\n");
+    AZ_Printf("JobManager", "Global queue depth: %llu, sleeping workers: %u, spinning workers: %u, steal success rate: %.1f%%\n",
+        telemetry.m_globalQueueDepth, telemetry.m_numSleepingWorkers, telemetry.m_numSpinningWorkers, totals.GetStealSuccessRate() * 100.0f);
+    AZ_Printf("JobManager", "Job durations:\n");
+    for (size_t bucket = 0; bucket < JobManagerThreadTelemetry::NumJobDurationBuckets; ++bucket)
+    {
+        if (totals.m_jobDurations[bucket] > 0)
+        {
+            AZ_Printf("JobManager", "  < %8llu us: %llu\n", JobManagerThreadTelemetry::GetJobDurationBucketUpperBound(bucket), totals.m_jobDurations[bucket]);
+        }
+    }
+}
+
+JobManagerTelemetry JobManagerWorkStealing::GetTelemetry() const
+{
+    JobManagerTelemetry telemetry;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadsMutex);
+        telemetry.m_threads.reserve(m_threads.size());
+        for (const ThreadInfo* info : m_threads)
+        {
+            JobManagerThreadTelemetry& thread = telemetry.m_threads.emplace_back();
+            thread.m_workerId = info->m_workerId;
+            thread.m_isWorker = info->m_isWorker;
+            info->m_telemetry.Gather(thread, m_ticksPerMicrosecond);
+            if (info->m_isWorker)
+            {
+                thread.m_localQueueDepth = GetLocalQueueDepth(info);
+            }
+        }
+    }
+
+    for (const AZStd::atomic_uint& numGlobalJobs : m_numGlobalJobs)
+    {
+        telemetry.m_globalQueueDepth += numGlobalJobs.load(AZStd::memory_order_relaxed);
+    }
+    telemetry.m_numSleepingWorkers = m_numAvailableWorkers.load(AZStd::memory_order_relaxed);
+    telemetry.m_numSpinningWorkers = m_numSpinningWorkers.load(AZStd::memory_order_relaxed);
+    return telemetry;
+}
+
+void JobManagerWorkStealing::ThreadTelemetry::Reset()
+{
+    for (AZStd::atomic<AZ::u64>* counter : { &m_globalJobs, &m_jobsForked, &m_jobsDone, &m_stealAttempts, &m_jobsStolen, &m_wakeups,
+        &m_futileWakeups, &m_spinHits, &m_jobTime, &m_stealTime, &m_wakeLatency, &m_maxLocalQueueDepth })
+    {
+        counter->store(0, AZStd::memory_order_relaxed);
+    }
+    for (AZStd::atomic<AZ::u64>& bucket : m_jobDurations)
+    {
+        bucket.store(0, AZStd::memory_order_relaxed);
+    }
+}
+
+void JobManagerWorkStealing::ThreadTelemetry::Gather(JobManagerThreadTelemetry& telemetry, AZStd::sys_time_t ticksPerMicrosecond) const
+{
+    telemetry.m_globalJobs = m_globalJobs.load(AZStd::memory_order_relaxed);
+    telemetry.m_jobsForked = m_jobsForked.load(AZStd::memory_order_relaxed);
+    telemetry.m_jobsDone = m_jobsDone.load(AZStd::memory_order_relaxed);
+    telemetry.m_stealAttempts = m_stealAttempts.load(AZStd::memory_order_relaxed);
+    telemetry.m_jobsStolen = m_jobsStolen.load(AZStd::memory_order_relaxed);
+    telemetry.m_wakeups = m_wakeups.load(AZStd::memory_order_relaxed);
+    telemetry.m_futileWakeups = m_futileWakeups.load(AZStd::memory_order_relaxed);
+    telemetry.m_spinHits = m_spinHits.load(AZStd::memory_order_relaxed);
+    telemetry.m_jobTimeMicroseconds = m_jobTime.load(AZStd::memory_order_relaxed) / ticksPerMicrosecond;
+    telemetry.m_stealTimeMicroseconds = m_stealTime.load(AZStd::memory_order_relaxed) / ticksPerMicrosecond;
+    telemetry.m_wakeLatencyMicroseconds = m_wakeLatency.load(AZStd::memory_order_relaxed) / ticksPerMicrosecond;
+    telemetry.m_maxLocalQueueDepth = m_maxLocalQueueDepth.load(AZStd::memory_order_relaxed);
+    for (size_t i = 0; i < JobManagerThreadTelemetry::NumJobDurationBuckets; ++i)
+    {
+        telemetry.m_jobDurations[i] = m_jobDurations[i].load(AZStd::memory_order_relaxed);
     }
-#endif
 }
 
 
@@ -324,8 +463,6 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 {
     AZ_Assert(IsAsynchronous(), "ProcessJobs is only to be used when we have worker threads (can be called on non-workers too though)");
 
-    //get thread local job queue
-    WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
     while (true)
@@ -349,29 +486,50 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 }
 
                 bool shouldSleep = false;
+                if (!HasGlobalJobs() && !SpinUntilWorkIsAvailable(info))
                 {
-                    //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
-                    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    shouldSleep = true;
+                    StopSpinning(info, false);
+
+                    //going to sleep, increment the sleep counter.
+                    const AZ::u32 priorAvailible = m_numAvailableWorkers.fetch_add(1, AZStd::memory_order_seq_cst);
+                    (void)priorAvailible;
+                    AZ_Assert(priorAvailible < m_workerThreads.size(), "invalid number of availible job workers");
+
+                    const bool wasAvailable = info->m_isAvailable.exchange(true, AZStd::memory_order_seq_cst);
+                    AZ_Verify(!wasAvailable, "available flag should have been false as we are processing jobs!");
+
+                    //a job may have been queued after the first check but before this worker was marked available, in which
+                    //case the producer may not have seen this worker. Producers publish the job before checking availability
+                    //and we publish availability before checking the queues (all sequentially consistent), so one of us
+                    //will always see the other. This also covers jobs queued after the spin timed out but before
+                    //StopSpinning decremented the spinner count, the producer saw this worker spinning and woke nobody.
+                    //The stealable queues are published with relaxed stores, the fence pairs with the one in AddPendingJob.
+                    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                    if ((HasGlobalJobs() || HasStealableJobs()) && info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel))
                     {
-                        shouldSleep = true;
-
-                        //going to sleep, increment the sleep counter.
-                        const AZ::u32 priorAvailible = m_numAvailableWorkers.fetch_add(1, AZStd::memory_order_acq_rel);
-                        (void)priorAvailible;
-                        AZ_Assert(priorAvailible < m_workerThreads.size(), "invalid number of availible job workers");
-
-                        const bool wasAvailable = info->m_isAvailable.exchange(true, AZStd::memory_order_acq_rel);
-                        AZ_Verify(!wasAvailable, "available flag should have been false as we are processing jobs!");
+                        //withdrew before anyone claimed this worker, keep processing
+                        m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+                        shouldSleep = false;
                     }
                 }
 
                 if (shouldSleep)
                 {
+                    if (!info->m_hasRunJobSinceWakeup)
+                    {
+                        AddTelemetry(info->m_telemetry.m_futileWakeups);
+                    }
                     //no available work, so go to sleep (or we have already been signaled by another thread and will acquire the semaphore but not actually sleep)
                     info->m_waitEvent.acquire();
                     AZ_PROFILE_INTERVAL_END(AZ::Debug::ProfileCategory::JobManagerDetailed, info);
 
+                    //the waking thread accounted for us as spinning, so it doesn't wake anybody else until we found a job
+                    info->m_isSpinning = true;
+                    AddTelemetry(info->m_telemetry.m_wakeups);
+                    AddTelemetry(info->m_telemetry.m_wakeLatency, AZStd::GetTimeNowTicks() - info->m_wakeRequestTime);
+                    info->m_hasRunJobSinceWakeup = false;
+
                     if (m_quitRequested)
                     {
                         return;
@@ -386,42 +544,29 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
-            {
-                AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
-#ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
-            }
+            job = PopNextJob(info);
         }
 
-        if (!job && pendingJobs)
+        if (job)
         {
-            //nothing on the global queue, try to pop from the local queue
-            job = pendingJobs->LocalPopFront();
+            StopSpinning(info, true);
         }
 
         bool isTerminated = false;
         while (!isTerminated)
         {
-#ifdef JOBMANAGER_ENABLE_STATS
-            AZStd::sys_time_t jobStartTime = AZStd::GetTimeNowTicks();
-#endif
-            //run current job and jobs from the local queue until it is empty
+            AZStd::sys_time_t jobEndTime = AZStd::GetTimeNowTicks();
+            //run current job and jobs from the local and global queues until they are empty
             while (job)
             {
+                const AZStd::sys_time_t jobStartTime = jobEndTime;
                 info->m_currentJob = job;
                 Process(job);
                 info->m_currentJob = nullptr;
 
                 //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
-#ifdef JOBMANAGER_ENABLE_STATS
-                ++info->m_jobsDone;
-#endif
+                jobEndTime = AZStd::GetTimeNowTicks();
+                RecordJobDone(info, jobEndTime - jobStartTime);
                 //check if our suspended job is ready, before we try running a new job
                 if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
                     (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
@@ -429,26 +574,16 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
-                if (pendingJobs)
-                {
-                    job = pendingJobs->LocalPopFront();
-                    if (job)
-                    {
-                        // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
-                        ActivateWorker();
-                    }
-                }
-                else
+                //pop a new job, looking at the higher lanes first so a job queued in a higher lane doesn't wait for
+                //the lower lane jobs this thread forked
+                job = PopNextJob(info);
+                if (job)
                 {
-                    job = nullptr;
+                    // not necessary, just an optimization - wakeup sleeping threads, there's work to be done
+                    ActivateWorker();
                 }
             }
 
-#ifdef JOBMANAGER_ENABLE_STATS
-            AZStd::sys_time_t jobEndTime = AZStd::GetTimeNowTicks();
-            info->m_jobTime += jobEndTime - jobStartTime;
-#endif
             if (m_workerThreads.size() < 2)
             {
                 isTerminated = true;
@@ -469,17 +604,14 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
-
-                    //attempt the steal
-                    job = victimQueue->TryStealFront();
+                    //select a victim thread, using the same victim as the previous successful steal if possible, and attempt the steal
+                    AddTelemetry(info->m_telemetry.m_stealAttempts);
+                    job = TryStealJob(info, m_workerThreads[victim]);
                     if (job)
                     {
                         //success, continue with the stolen job
-#ifdef JOBMANAGER_ENABLE_STATS
-                        ++info->m_jobsStolen;
-#endif
+                        StopSpinning(info, true);
+                        AddTelemetry(info->m_telemetry.m_jobsStolen);
                         break;
                     }
 
@@ -507,9 +639,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
                 }
             }
-#ifdef JOBMANAGER_ENABLE_STATS
-            info->m_stealTime += AZStd::GetTimeNowTicks() - jobEndTime;
-#endif
+            AddTelemetry(info->m_telemetry.m_stealTime, AZStd::GetTimeNowTicks() - jobEndTime);
         }
     }
 }
@@ -521,19 +651,15 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    while (Job* job = PopNextJob(info))
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop_front();
-
+        const AZStd::sys_time_t jobStartTime = AZStd::GetTimeNowTicks();
         info->m_currentJob = job;
         Process(job);
         info->m_currentJob = NULL;
 
         //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
-#ifdef JOBMANAGER_ENABLE_STATS
-        ++info->m_jobsDone;
-#endif
+        RecordJobDone(info, AZStd::GetTimeNowTicks() - jobStartTime);
 
         if ((suspendedJob && (suspendedJob->GetDependentCount() == 0)) ||
             (notifyFlag && notifyFlag->load(AZStd::memory_order_acquire)))
@@ -659,19 +785,251 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
+JobManagerWorkStealing::GlobalQueueShardList JobManagerWorkStealing::CreateGlobalQueueShards(size_t numWorkerThreads)
+{
+    //one shard per worker spreads the producers while keeping the number of shards a consumer may have to visit small
+    GlobalQueueShardList shards(AZStd::max<size_t>(numWorkerThreads, 1));
+    for (GlobalQueueShard*& shard : shards)
+    {
+        shard = aznew GlobalQueueShard;
+    }
+    return shards;
+}
+
+void JobManagerWorkStealing::PushGlobalJob(Job* job)
+{
+    //each producing thread sticks to one shard, so jobs it queues keep their relative order
+    static AZStd::atomic_uint s_nextProducerShard{0};
+    static AZ_THREAD_LOCAL AZ::u32 s_producerShard = ~0u;
+    if (s_producerShard == ~0u)
+    {
+        s_producerShard = s_nextProducerShard.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    const size_t lane = static_cast<size_t>(job->GetLane());
+    GlobalQueueShard* shard = m_globalJobQueues[s_producerShard % m_globalJobQueues.size()];
+    AZStd::lock_guard<GlobalQueueMutexType> lock(shard->m_mutex);
+    GlobalJobQueue& queue = shard->m_queues[lane];
+    const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(queue.begin(),
+                                                                               queue.end(),
+                                                                               job->GetPriority(),
+                                                                               CompareJobPriorities);
+    queue.insert(locationToinsert, job);
+    shard->m_numJobs[lane].fetch_add(1, AZStd::memory_order_relaxed);
+    m_numGlobalJobs[lane].fetch_add(1, AZStd::memory_order_seq_cst);
+}
+
+Job* JobManagerWorkStealing::PopGlobalJob(const ThreadInfo* info, size_t lane)
+{
+    if (m_numGlobalJobs[lane].load(AZStd::memory_order_acquire) == 0)
+    {
+        return nullptr;
+    }
+
+    //workers start with their own shard, user threads assisting with jobs start with the first one
+    const size_t numShards = m_globalJobQueues.size();
+    const size_t firstShard = info->m_isWorker ? info->m_workerId % numShards : 0;
+    for (size_t i = 0; i < numShards; ++i)
+    {
+        GlobalQueueShard* shard = m_globalJobQueues[(firstShard + i) % numShards];
+        if (shard->m_numJobs[lane].load(AZStd::memory_order_acquire) == 0)
+        {
+            continue;
+        }
+
+        AZStd::lock_guard<GlobalQueueMutexType> lock(shard->m_mutex);
+        GlobalJobQueue& queue = shard->m_queues[lane];
+        if (!queue.empty())
+        {
+            Job* job = queue.front();
+            queue.pop_front();
+            shard->m_numJobs[lane].fetch_sub(1, AZStd::memory_order_relaxed);
+            m_numGlobalJobs[lane].fetch_sub(1, AZStd::memory_order_release);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool JobManagerWorkStealing::HasGlobalJobs() const
+{
+    for (const AZStd::atomic_uint& numGlobalJobs : m_numGlobalJobs)
+    {
+        if (numGlobalJobs.load(AZStd::memory_order_seq_cst) > 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+JobManagerWorkStealing::LaneOrder JobManagerWorkStealing::GetLaneOrder(const ThreadInfo* info) const
+{
+    if (m_backgroundStarvationLimit > 0 && info->m_jobsSinceBackground >= m_backgroundStarvationLimit)
+    {
+        return LaneOrder{ { JobLane::Background, JobLane::Critical, JobLane::Frame } };
+    }
+    return LaneOrder{ { JobLane::Critical, JobLane::Frame, JobLane::Background } };
+}
+
+void JobManagerWorkStealing::OnJobTaken(ThreadInfo* info, JobLane lane) const
+{
+    if (lane == JobLane::Background)
+    {
+        info->m_jobsSinceBackground = 0;
+    }
+    else if (info->m_jobsSinceBackground < m_backgroundStarvationLimit)
+    {
+        ++info->m_jobsSinceBackground;
+    }
+}
+
+Job* JobManagerWorkStealing::PopNextJob(ThreadInfo* info)
+{
+    for (JobLane lane : GetLaneOrder(info))
+    {
+        const size_t laneIndex = static_cast<size_t>(lane);
+
+        //within a lane prefer the jobs this thread forked itself, they are likely to use data that is still in the cache
+        Job* job = info->m_isWorker ? info->m_pendingJobs[laneIndex].LocalPopFront() : nullptr;
+        if (!job)
+        {
+            job = PopGlobalJob(info, laneIndex);
+            if (job)
+            {
+                AddTelemetry(info->m_telemetry.m_globalJobs);
+            }
+        }
+
+        if (job)
+        {
+            OnJobTaken(info, lane);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+Job* JobManagerWorkStealing::TryStealJob(ThreadInfo* info, ThreadInfo* victim)
+{
+    for (JobLane lane : GetLaneOrder(info))
+    {
+        if (Job* job = victim->m_pendingJobs[static_cast<size_t>(lane)].TryStealFront())
+        {
+            OnJobTaken(info, lane);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+AZ::u64 JobManagerWorkStealing::GetLocalQueueDepth(const ThreadInfo* info)
+{
+    AZ::u64 depth = 0;
+    for (const WorkQueue& pendingJobs : info->m_pendingJobs)
+    {
+        depth += pendingJobs.GetApproximateSize();
+    }
+    return depth;
+}
+
+void JobManagerWorkStealing::RecordJobDone(ThreadInfo* info, AZStd::sys_time_t jobTime)
+{
+    AddTelemetry(info->m_telemetry.m_jobsDone);
+    AddTelemetry(info->m_telemetry.m_jobTime, jobTime);
+    const size_t bucket = JobManagerThreadTelemetry::GetJobDurationBucket(jobTime / m_ticksPerMicrosecond);
+    AddTelemetry(info->m_telemetry.m_jobDurations[bucket]);
+}
+
+bool JobManagerWorkStealing::HasStealableJobs() const
+{
+    for (const ThreadInfo* info : m_workerThreads)
+    {
+        for (const WorkQueue& pendingJobs : info->m_pendingJobs)
+        {
+            if (!pendingJobs.IsEmpty())
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool JobManagerWorkStealing::SpinUntilWorkIsAvailable(ThreadInfo* info)
+{
+    if (info->m_spinTime == 0)
+    {
+        return false;
+    }
+
+    if (!info->m_isSpinning)
+    {
+        info->m_isSpinning = true;
+        m_numSpinningWorkers.fetch_add(1, AZStd::memory_order_seq_cst);
+    }
+
+    const AZStd::sys_time_t spinEnd = AZStd::GetTimeNowTicks() + info->m_spinTime;
+    do
+    {
+        if (HasGlobalJobs() || HasStealableJobs())
+        {
+            //spinning paid off, allow the full spin time next time
+            info->m_spinTime = m_maxSpinTime;
+            AddTelemetry(info->m_telemetry.m_spinHits);
+            return true;
+        }
+        AZStd::this_thread::pause(SpinPauseLoops);
+    } while (!m_quitRequested && AZStd::GetTimeNowTicks() < spinEnd);
+
+    //nothing showed up, spin less next time
+    info->m_spinTime = AZStd::max(info->m_spinTime / 2, m_maxSpinTime / 8);
+    return false;
+}
+
+void JobManagerWorkStealing::StopSpinning(ThreadInfo* info, bool foundJob)
+{
+    if (!info->m_isSpinning)
+    {
+        return;
+    }
+
+    info->m_isSpinning = false;
+    const AZ::u32 priorSpinning = m_numSpinningWorkers.fetch_sub(1, AZStd::memory_order_seq_cst);
+    AZ_Assert(priorSpinning > 0, "invalid number of spinning job workers");
+
+    //jobs queued while we were spinning didn't wake anybody, if we were the last one looking and there is more work, pass it on
+    if (foundJob && priorSpinning == 1 && (HasGlobalJobs() || HasStealableJobs()))
+    {
+        ActivateWorker();
+    }
+    if (foundJob)
+    {
+        info->m_hasRunJobSinceWakeup = true;
+    }
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
+    // a spinning worker (or one that was just woken up) will pick up the new work, waking another would most likely be futile
+    if (m_numSpinningWorkers.load(AZStd::memory_order_seq_cst) > 0)
+    {
+        return;
+    }
+
     // find an available worker thread (we do it brute force because the number of threads is small)
-    while (m_numAvailableWorkers.load(AZStd::memory_order_acquire) > 0)
+    while (m_numAvailableWorkers.load(AZStd::memory_order_seq_cst) > 0)
     {
         for (size_t i = 0; i < m_workerThreads.size(); ++i)
         {
             ThreadInfo* info = m_workerThreads[i];
             if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
             {
-                // decrement number of available workers
+                // decrement number of available workers, the woken worker counts as spinning until it finds a job
+                m_numSpinningWorkers.fetch_add(1, AZStd::memory_order_seq_cst);
                 m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
                 // resume the thread execution
+                info->m_wakeRequestTime = AZStd::GetTimeNowTicks();
 
                 AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, info, "AzCore WakeJobThread %d", info->m_workerId);
                 info->m_waitEvent.release();
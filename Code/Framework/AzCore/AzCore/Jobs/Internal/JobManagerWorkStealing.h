@@ -10,15 +10,20 @@
 // Included directly from JobManager.h
 
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
+#include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
+#include <AzCore/Jobs/JobManagerTelemetry.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/queue.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -26,6 +31,12 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * Per worker job queue. Jobs with the default priority (the vast majority) go through a lock-free work stealing
+         * deque, the worker pushes to it without any atomic read-modify-write and thieves never block each other.
+         * Jobs with a non-default priority are kept sorted in a locked queue, that is only touched when it is not empty.
+         * Jobs come out highest priority first, and in the order they were inserted for equal priorities.
+         */
         class WorkQueue final
         {
         public:
@@ -33,25 +44,42 @@ namespace AZ
             Job* LocalPopFront();
             Job* TryStealFront();
 
+            /// Returns the number of jobs in the queue, only a hint when other threads use the queue.
+            AZ::u64 GetApproximateSize() const;
+
+            /// Returns true if the queue was observed empty, only a hint when other threads use the queue.
+            bool IsEmpty() const;
+
+            /// Frees memory retired by the lock-free deque, must only be called when the job system is idle.
+            void CollectGarbage();
+
         private:
             enum
             {
                 TryStealSpinAttemps = 16,
             };
-            using LockType = AZStd::shared_mutex;
+            using LockType = AZStd::mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
-            LockType m_lock;
+            Job* PopPrioritizedJob(bool isOwner);
+
+            WorkStealingDeque<Job*> m_defaultPriorityJobs;
+
+            AZStd::deque<Job*> m_prioritizedJobs; ///< sorted by priority, guarded by m_prioritizedJobsLock
+            LockType m_prioritizedJobsLock;
+            AZStd::atomic_uint m_numHigherPriorityJobs{0}; ///< number of jobs in m_prioritizedJobs with a priority above the default
+            AZStd::atomic_uint m_numLowerPriorityJobs{0}; ///< number of jobs in m_prioritizedJobs with a priority below the default
         };
 
         /**
          * Work stealing is in practice a very efficient way for processing fine grained jobs.
-         * IMPORTANT: Because we want to put worker threads to sleep we do have extra locks and condition
-         * variable in the code. In addition we are constantly kicking sleeping threads when we add jobs,
-         * this is NOT efficient. Once we have heavier job loads (in practice) try to optimize and remove
-         * those sticky points (if they are a problem). In addition we can think about writing a more advanced
-         * scheduler or use some off the shelf.
+         * Jobs forked from a worker go to its lock-free local queue, jobs added from any other thread go to a global
+         * queue that is sharded to spread the lock contention across producers.
+         * Every scheduling lane (see JobLane) has its own local and global queues, workers look for jobs in the higher
+         * lanes first, but periodically take a background job first so that background work can't starve.
+         * Idle workers spin for a short, adaptive time before going to sleep. Adding a job only wakes a sleeping worker
+         * if no worker is spinning (or already on its way up), and a worker that finds work wakes the next one if there
+         * is more, so the number of awake workers ramps up with the amount of work instead of every job kicking a thread.
          */
         class JobManagerWorkStealing final
             : public JobManagerBase
@@ -70,8 +98,9 @@ namespace AZ
 
             void ClearStats();
             void PrintStats();
+            JobManagerTelemetry GetTelemetry() const;
 
-            void CollectGarbage() {}
+            void CollectGarbage();
 
             Job* GetCurrentJob() const;
 
@@ -80,12 +109,47 @@ namespace AZ
             AZ::u32 GetWorkerThreadId() const;
 
         private:
+            enum
+            {
+                SpinPauseLoops = 16, ///< pause instructions between checks for work while spinning
+            };
 
             void ActivateWorker();
 
+            using LaneOrder = AZStd::array<JobLane, JobLaneCount>;
+
+            /**
+             * Always-on per thread telemetry. Counters are only written by the thread that owns them, so they are updated
+             * with relaxed loads and stores instead of atomic read-modify-writes, and can be read from any thread.
+             */
+            struct ThreadTelemetry
+            {
+                void Reset();
+                void Gather(JobManagerThreadTelemetry& telemetry, AZStd::sys_time_t ticksPerMicrosecond) const;
+
+                AZStd::atomic<AZ::u64> m_globalJobs{0};
+                AZStd::atomic<AZ::u64> m_jobsForked{0};
+                AZStd::atomic<AZ::u64> m_jobsDone{0};
+                AZStd::atomic<AZ::u64> m_stealAttempts{0};
+                AZStd::atomic<AZ::u64> m_jobsStolen{0};
+                AZStd::atomic<AZ::u64> m_wakeups{0};
+                AZStd::atomic<AZ::u64> m_futileWakeups{0};
+                AZStd::atomic<AZ::u64> m_spinHits{0};
+                AZStd::atomic<AZ::u64> m_jobTime{0}; // in ticks
+                AZStd::atomic<AZ::u64> m_stealTime{0}; // in ticks
+                AZStd::atomic<AZ::u64> m_wakeLatency{0}; // in ticks
+                AZStd::atomic<AZ::u64> m_maxLocalQueueDepth{0};
+                AZStd::array<AZStd::atomic<AZ::u64>, JobManagerThreadTelemetry::NumJobDurationBuckets> m_jobDurations = {};
+            };
+
+            static void AddTelemetry(AZStd::atomic<AZ::u64>& counter, AZ::u64 amount = 1)
+            {
+                counter.store(counter.load(AZStd::memory_order_relaxed) + amount, AZStd::memory_order_relaxed);
+            }
+
             struct ThreadInfo
             {
-                AZ_CLASS_ALLOCATOR(ThreadInfo, ThreadPoolAllocator, 0)
+                AZ_CLASS_ALLOCATOR(ThreadInfo, SystemAllocator, 0)
 
                 AZStd::thread::id m_threadId;
                 bool m_isWorker = false;
@@ -96,17 +160,16 @@ namespace AZ
                 AZStd::thread m_thread;
                 AZStd::atomic_bool m_isAvailable{false};
                 AZStd::binary_semaphore m_waitEvent;
-                WorkQueue m_pendingJobs;
+                AZStd::array<WorkQueue, JobLaneCount> m_pendingJobs; // one queue per lane
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                AZStd::sys_time_t m_spinTime = 0; // current spin budget in ticks, adapted between 1/8th and all of the configured maximum
+                bool m_isSpinning = false; // true while this worker is accounted for in m_numSpinningWorkers
+                AZStd::sys_time_t m_wakeRequestTime = 0; // written by the waking thread before releasing m_waitEvent
+                bool m_hasRunJobSinceWakeup = true;
 
-#ifdef JOBMANAGER_ENABLE_STATS
-                unsigned int m_globalJobs = 0;
-                unsigned int m_jobsForked = 0;
-                unsigned int m_jobsDone = 0;
-                unsigned int m_jobsStolen = 0;
-                u64 m_jobTime = 0;
-                u64 m_stealTime = 0;
-#endif
+                unsigned int m_jobsSinceBackground = 0; // jobs taken from the higher lanes in a row, saturates at the starvation limit
+
+                ThreadTelemetry m_telemetry;
             };
             using ThreadList = AZStd::vector<ThreadInfo*>;
 
@@ -115,6 +178,38 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+
+            using GlobalJobQueue = AZStd::deque<Job*>;
+            using GlobalQueueMutexType = AZStd::mutex;
+
+            /// One shard of the global job queue, with a queue sorted by priority for each lane
+            struct GlobalQueueShard
+            {
+                AZ_CLASS_ALLOCATOR(GlobalQueueShard, SystemAllocator, 0)
+
+                AZStd::array<GlobalJobQueue, JobLaneCount> m_queues;
+                GlobalQueueMutexType m_mutex;
+                AZStd::array<AZStd::atomic_uint, JobLaneCount> m_numJobs = {}; ///< lets consumers skip empty queues without taking the lock
+            };
+            using GlobalQueueShardList = AZStd::vector<GlobalQueueShard*>;
+
+            GlobalQueueShardList CreateGlobalQueueShards(size_t numWorkerThreads);
+            void PushGlobalJob(Job* job);
+            Job* PopGlobalJob(const ThreadInfo* info, size_t lane);
+            bool HasGlobalJobs() const;
+            bool HasStealableJobs() const;
+
+            /// Lanes in the order the thread should look for jobs, the background lane goes first once it was passed over too often
+            LaneOrder GetLaneOrder(const ThreadInfo* info) const;
+            void OnJobTaken(ThreadInfo* info, JobLane lane) const;
+            Job* PopNextJob(ThreadInfo* info);
+            Job* TryStealJob(ThreadInfo* info, ThreadInfo* victim);
+            static AZ::u64 GetLocalQueueDepth(const ThreadInfo* info);
+
+            void RecordJobDone(ThreadInfo* info, AZStd::sys_time_t jobTime);
+
+            bool SpinUntilWorkIsAvailable(ThreadInfo* info);
+            void StopSpinning(ThreadInfo* info, bool foundJob);
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -130,14 +225,16 @@ namespace AZ
 
             const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads and m_initSemaphore
 
-            using GlobalJobQueue = AZStd::deque<Job*>;
-            using GlobalQueueMutexType = AZStd::mutex;
+            const GlobalQueueShardList  m_globalJobQueues; //no mutex required for this list, it's only assigned during startup
 
-            GlobalJobQueue              m_globalJobQueue;
-            GlobalQueueMutexType        m_globalJobQueueMutex;
+            AZStd::array<AZStd::atomic_uint, JobLaneCount> m_numGlobalJobs = {}; ///< jobs in the global queue of each lane, over all shards
 
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
+            AZStd::atomic_uint          m_numSpinningWorkers{0}; ///< workers looking for jobs, including ones woken up but not running yet
+            AZStd::sys_time_t           m_ticksPerMicrosecond = 1;
+            AZStd::sys_time_t           m_maxSpinTime = 0; ///< in ticks, from JobManagerDesc::m_workerSpinTimeMicroseconds
+            unsigned int                m_backgroundStarvationLimit = 0; ///< from JobManagerDesc::m_backgroundLaneStarvationLimit
 
             //thread-local pointer to the info for this thread. This is set for worker threads all the time,
             //and user threads only while they are processing jobs
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Lock-free work stealing deque, based on "Dynamic Circular Work-Stealing Deque" (Chase, Lev 2005) using the
+         * memory ordering from "Correct and Efficient Work-Stealing for Weak Memory Models" (Le et al. 2013).
+         *
+         * A single owner thread pushes elements to the bottom, any number of threads (including the owner) take elements
+         * from the top, so elements come out in the order they were pushed. Pushing never takes a lock or performs an atomic
+         * read-modify-write, taking an element costs a single compare-and-swap on the top index.
+         *
+         * The ring buffer grows when full. Retired buffers may still be read by a concurrent Steal, so they are kept until
+         * CollectGarbage is called while the deque is idle, bounding the garbage to the size of the live buffer.
+         */
+        template<class T>
+        class WorkStealingDeque final
+        {
+            static_assert(AZStd::is_trivially_copyable<T>::value, "WorkStealingDeque elements are copied without synchronization, they must be trivially copyable");
+
+        public:
+            explicit WorkStealingDeque(AZ::s64 initialCapacity = DefaultCapacity)
+            {
+                AZ_Assert(initialCapacity > 0 && (initialCapacity & (initialCapacity - 1)) == 0, "WorkStealingDeque capacity must be a power of two");
+                m_buffer.store(RingBuffer::Create(initialCapacity), AZStd::memory_order_relaxed);
+            }
+
+            ~WorkStealingDeque()
+            {
+                CollectGarbage();
+                RingBuffer::Destroy(m_buffer.load(AZStd::memory_order_relaxed));
+            }
+
+            WorkStealingDeque(const WorkStealingDeque&) = delete;
+            WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+            /// Adds an element to the bottom of the deque, must only be called from the owning thread.
+            void Push(T value)
+            {
+                const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_relaxed);
+                const AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+                RingBuffer* buffer = m_buffer.load(AZStd::memory_order_relaxed);
+                if (bottom - top > buffer->m_mask)
+                {
+                    buffer = Grow(buffer, top, bottom);
+                }
+                buffer->Store(bottom, value);
+                AZStd::atomic_thread_fence(AZStd::memory_order_release);
+                m_bottom.store(bottom + 1, AZStd::memory_order_relaxed);
+            }
+
+            /**
+             * Takes the element from the top of the deque, can be called from any thread.
+             * \param result receives the element when the steal succeeds.
+             * \return false if the deque was observed empty.
+             */
+            bool Steal(T& result)
+            {
+                AZ::s64 top = m_top.load(AZStd::memory_order_acquire);
+                while (true)
+                {
+                    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                    const AZ::s64 bottom = m_bottom.load(AZStd::memory_order_acquire);
+                    if (top >= bottom)
+                    {
+                        return false;
+                    }
+
+                    // the element must be read before the top is claimed, the owner is free to overwrite the slot afterwards
+                    const T value = m_buffer.load(AZStd::memory_order_acquire)->Load(top);
+                    if (m_top.compare_exchange_weak(top, top + 1, AZStd::memory_order_seq_cst, AZStd::memory_order_acquire))
+                    {
+                        result = value;
+                        return true;
+                    }
+                    // lost the race with another thief, top has been reloaded, try again
+                }
+            }
+
+            /// Returns true if the deque was observed empty. The result is only a hint when other threads use the deque.
+            bool IsEmpty() const
+            {
+                return m_bottom.load(AZStd::memory_order_acquire) <= m_top.load(AZStd::memory_order_acquire);
+            }
+
+            /// Returns the number of elements in the deque, only a hint when other threads use the deque.
+            AZ::s64 GetApproximateSize() const
+            {
+                return AZStd::max<AZ::s64>(m_bottom.load(AZStd::memory_order_relaxed) - m_top.load(AZStd::memory_order_relaxed), 0);
+            }
+
+            /// Frees the ring buffers retired by Push, must *only* be called when no other thread is using the deque.
+            void CollectGarbage()
+            {
+                for (RingBuffer* buffer : m_retiredBuffers)
+                {
+                    RingBuffer::Destroy(buffer);
+                }
+                m_retiredBuffers.clear();
+            }
+
+        private:
+            enum : AZ::s64
+            {
+                DefaultCapacity = 256,
+                CacheLineSize = 64,
+            };
+
+            struct RingBuffer
+            {
+                static RingBuffer* Create(AZ::s64 capacity)
+                {
+                    void* memory = azmalloc(sizeof(RingBuffer) + sizeof(AZStd::atomic<T>) * capacity, alignof(RingBuffer), AZ::SystemAllocator, "WorkStealingDeque");
+                    RingBuffer* buffer = new(memory) RingBuffer;
+                    buffer->m_mask = capacity - 1;
+                    AZStd::atomic<T>* elements = buffer->GetElements();
+                    for (AZ::s64 i = 0; i < capacity; ++i)
+                    {
+                        new(&elements[i]) AZStd::atomic<T>();
+                    }
+                    return buffer;
+                }
+
+                static void Destroy(RingBuffer* buffer)
+                {
+                    // AZStd::atomic<T> of a trivially copyable type is trivially destructible
+                    buffer->~RingBuffer();
+                    azfree(buffer, AZ::SystemAllocator);
+                }
+
+                AZStd::atomic<T>* GetElements()
+                {
+                    return reinterpret_cast<AZStd::atomic<T>*>(this + 1);
+                }
+
+                T Load(AZ::s64 index)
+                {
+                    return GetElements()[index & m_mask].load(AZStd::memory_order_relaxed);
+                }
+
+                void Store(AZ::s64 index, T value)
+                {
+                    GetElements()[index & m_mask].store(value, AZStd::memory_order_relaxed);
+                }
+
+                AZ::s64 m_mask = 0;
+                AZ::s64 m_padding = 0; // keep the element array 16 byte aligned
+            };
+
+            RingBuffer* Grow(RingBuffer* buffer, AZ::s64 top, AZ::s64 bottom)
+            {
+                RingBuffer* newBuffer = RingBuffer::Create((buffer->m_mask + 1) * 2);
+                for (AZ::s64 i = top; i < bottom; ++i)
+                {
+                    newBuffer->Store(i, buffer->Load(i));
+                }
+                m_retiredBuffers.push_back(buffer);
+                m_buffer.store(newBuffer, AZStd::memory_order_release);
+                return newBuffer;
+            }
+
+            // top and bottom are written by different threads, keep them on separate cache lines
+            AZStd::atomic<AZ::s64> m_top{ 0 };
+            char m_topPadding[CacheLineSize - sizeof(AZStd::atomic<AZ::s64>)];
+            AZStd::atomic<AZ::s64> m_bottom{ 0 };
+            AZStd::atomic<RingBuffer*> m_buffer{ nullptr };
+            AZStd::vector<RingBuffer*> m_retiredBuffers; ///< only accessed by the owner
+        };
+    }
+}
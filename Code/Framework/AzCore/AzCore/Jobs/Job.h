@@ -172,6 +172,18 @@ namespace AZ
          */
         AZ::s8 GetPriority() const;
 
+        /**
+         * Selects the scheduling lane of this job, overriding the lane of its context. Workers drain higher lanes
+         * first, the priority only orders jobs within a lane. Call this only while the job is in the setup state
+         * (before Start, or after Reset), it is not threadsafe.
+         */
+        void SetLane(JobLane lane);
+
+        /**
+         * Get the scheduling lane of this job, the lane of its context unless one was set with SetLane.
+         */
+        JobLane GetLane() const;
+
 #ifdef AZ_DEBUG_JOB_STATE
         int GetState() const    { return m_state; }
 #endif // AZ_DEBUG_JOB_STATE
@@ -210,8 +222,12 @@ namespace AZ
             FLAG_PRIORITY_MASK = 0x0ff00000,
             FLAG_PRIORITY_START_BIT = 20,
 
-            //20 bits for count
-            FLAG_DEPENDENTCOUNT_MASK = 0x000fffff
+            //2 bits for the lane, JobLane::Inherit uses the lane of the context
+            FLAG_LANE_MASK = 0x000c0000,
+            FLAG_LANE_START_BIT = 18,
+
+            //18 bits for count
+            FLAG_DEPENDENTCOUNT_MASK = 0x0003ffff
         };
 
     protected:
@@ -259,6 +275,7 @@ namespace AZ
             countAndFlags |= (unsigned int)FLAG_COMPLETION;
         }
         countAndFlags |= (unsigned int)((priority << FLAG_PRIORITY_START_BIT) & FLAG_PRIORITY_MASK);
+        countAndFlags |= (unsigned int)JobLane::Inherit << FLAG_LANE_START_BIT;
         SetDependentCountAndFlags(countAndFlags);
         StoreDependent(NULL);
 
@@ -497,6 +514,21 @@ namespace AZ
         return (GetDependentCountAndFlags() >> FLAG_PRIORITY_START_BIT) & 0xff;
     }
 
+    inline void Job::SetLane(JobLane lane)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "Jobs must be in the setup state to change their lane");
+#endif
+        const unsigned int countAndFlags = GetDependentCountAndFlags() & ~(unsigned int)FLAG_LANE_MASK;
+        SetDependentCountAndFlags(countAndFlags | ((unsigned int)lane << FLAG_LANE_START_BIT));
+    }
+
+    inline JobLane Job::GetLane() const
+    {
+        const JobLane lane = static_cast<JobLane>((GetDependentCountAndFlags() & FLAG_LANE_MASK) >> FLAG_LANE_START_BIT);
+        return lane == JobLane::Inherit ? m_context->GetLane() : lane;
+    }
+
 #ifdef AZ_DEBUG_JOB_STATE
     AZ_FORCE_INLINE void Job::SetState(int state)
     {
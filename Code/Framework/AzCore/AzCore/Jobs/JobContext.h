@@ -13,6 +13,20 @@ namespace AZ
 {
     class JobManager;
 
+    /**
+     * Scheduling lanes, workers always run jobs from a higher lane first. Priorities only order jobs within a lane.
+     * To prevent starvation a worker takes a background job after running JobManagerDesc::m_backgroundLaneStarvationLimit
+     * jobs from the other lanes in a row.
+     */
+    enum class JobLane : AZ::u8
+    {
+        Critical = 0, ///< work the current frame is waiting on right now, e.g. animation or physics
+        Frame, ///< regular per frame work, the default
+        Background, ///< long running work that can span frames, e.g. streaming decompression or navmesh rebuilds
+        Inherit, ///< only valid for jobs, use the lane of the job context
+    };
+    static constexpr size_t JobLaneCount = 3; ///< number of real lanes, excluding JobLane::Inherit
+
     /**
      * A job context stores information about the execution environment of jobs, a single context should be shared
      * between many jobs.
@@ -32,7 +46,8 @@ namespace AZ
 
         JobContext(const JobContext& rhs)
             : m_jobManager(rhs.m_jobManager)
-            , m_cancelGroup(rhs.m_cancelGroup) { }
+            , m_cancelGroup(rhs.m_cancelGroup)
+            , m_lane(rhs.m_lane) { }
 
         JobContext& operator=(const JobContext&) = delete;
 
@@ -45,6 +60,18 @@ namespace AZ
 
         JobCancelGroup* GetCancelGroup() const { return m_cancelGroup; }
 
+        /**
+         * Sets the lane used by jobs of this context which don't select one themselves, see Job::SetLane.
+         * Call this only before jobs using this context have been started, it is not threadsafe.
+         */
+        void SetLane(JobLane lane)
+        {
+            AZ_Assert(lane != JobLane::Inherit, "A job context must use a real lane");
+            m_lane = lane;
+        }
+
+        JobLane GetLane() const { return m_lane; }
+
         /**
          * Sets the global job context, this is what will be used when creating a top-level job without specifying
          * the context explicitly.
@@ -63,6 +90,7 @@ namespace AZ
 
         JobManager& m_jobManager;
         JobCancelGroup* m_cancelGroup;
+        JobLane m_lane = JobLane::Frame;
     };
 }
 
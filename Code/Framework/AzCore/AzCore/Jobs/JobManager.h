@@ -11,8 +11,7 @@
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Jobs/Internal/JobManagerWorkStealing.h>
-
-//#define JOBMANAGER_ENABLE_STATS
+#include <AzCore/Jobs/JobManagerTelemetry.h>
 
 namespace AZ
 {
@@ -57,6 +56,12 @@ namespace AZ
          */
         void PrintStats() { m_impl.PrintStats(); }
 
+        /**
+         * Returns a snapshot of the per thread counters, job duration histogram and queue depths. The statistics are
+         * always collected and can be gathered at any time, counters that are updated while gathering may be off by a few.
+         */
+        JobManagerTelemetry GetTelemetry() const { return m_impl.GetTelemetry(); }
+
         /**
          * Optionally call this to collect garbage from the work stealing deques, it absolutely *MUST* be only called
          * when the system is idle. The garbage is bounded, to 100% of the deque memory, so don't call it at all if
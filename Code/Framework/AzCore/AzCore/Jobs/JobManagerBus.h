@@ -8,6 +8,7 @@
 #define AZCORE_JOB_MANAGER_BUS_H
 
 #include <AzCore/EBus/EBus.h>
+#include <AzCore/Jobs/JobManagerTelemetry.h>
 
 namespace AZ
 {
@@ -31,6 +32,9 @@ namespace AZ
 
         virtual JobManager* GetManager() = 0;
         virtual JobContext* GetGlobalContext() = 0;
+
+        /// Returns a snapshot of the runtime telemetry of the global job manager, see JobManager::GetTelemetry.
+        virtual JobManagerTelemetry GetTelemetry() = 0;
     };
 
     typedef AZ::EBus<JobManagerEvents>  JobManagerBus;
@@ -82,6 +82,36 @@ namespace AZ
         m_jobManager = nullptr;
     }
 
+    //=========================================================================
+    // GetTelemetry
+    //=========================================================================
+    JobManagerTelemetry JobManagerComponent::GetTelemetry()
+    {
+        return m_jobManager ? m_jobManager->GetTelemetry() : JobManagerTelemetry();
+    }
+
+    //=========================================================================
+    // DumpTelemetry
+    //=========================================================================
+    void JobManagerComponent::DumpTelemetry([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (m_jobManager)
+        {
+            m_jobManager->PrintStats();
+        }
+    }
+
+    //=========================================================================
+    // ResetTelemetry
+    //=========================================================================
+    void JobManagerComponent::ResetTelemetry([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (m_jobManager)
+        {
+            m_jobManager->ClearStats();
+        }
+    }
+
     //=========================================================================
     // GetProvidedServices
     //=========================================================================
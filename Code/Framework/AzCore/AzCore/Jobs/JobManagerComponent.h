@@ -8,6 +8,7 @@
 #define AZCORE_JOB_MANAGER_COMPONENT_H
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Math/Crc.h>
 
@@ -29,6 +30,7 @@ namespace AZ
         // JobManager bus
         JobManager* GetManager() override { return m_jobManager; }
         JobContext* GetGlobalContext() override { return m_jobGlobalContext; }
+        JobManagerTelemetry GetTelemetry() override;
         //////////////////////////////////////////////////////////////////////////
 
     private:
@@ -47,6 +49,14 @@ namespace AZ
         /// \red ComponentDescriptor::Reflect
         static void Reflect(ReflectContext* reflection);
 
+        void DumpTelemetry(const AZ::ConsoleCommandContainer& arguments);
+        void ResetTelemetry(const AZ::ConsoleCommandContainer& arguments);
+
+        AZ_CONSOLEFUNC(JobManagerComponent, DumpTelemetry, AZ::ConsoleFunctorFlags::Null,
+            "Prints the per thread counters, job duration histogram and queue depths of the job manager");
+        AZ_CONSOLEFUNC(JobManagerComponent, ResetTelemetry, AZ::ConsoleFunctorFlags::Null,
+            "Clears the accumulated job manager telemetry");
+
         JobManager*  m_jobManager;
         JobContext*  m_jobGlobalContext;
         int          m_numberOfWorkerThreads;   ///< Number of worked threads to spawn for this process. If <= 0 we will use all cores.
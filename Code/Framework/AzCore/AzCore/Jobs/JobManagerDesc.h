@@ -52,5 +52,20 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         *  Maximum time (in microseconds) an idle worker spins looking for new jobs before it goes to sleep.
+         *  New jobs don't wake any sleeping worker while another one is spinning, so short bursts of work are picked up
+         *  without paying for a wakeup. Each worker adapts its spin time, halving it every time spinning finds nothing.
+         *  0 disables spinning, idle workers go to sleep right away.
+         */
+        unsigned int m_workerSpinTimeMicroseconds = 50;
+
+        /**
+         *  Number of jobs from the critical and frame lanes a worker runs in a row before it picks a background job
+         *  ahead of them (see JobLane), so background work keeps making progress while the pool is saturated.
+         *  0 disables this, background jobs then only run when the higher lanes are empty.
+         */
+        unsigned int m_backgroundLaneStarvationLimit = 32;
     };
 }
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Telemetry collected by a single thread of a JobManager, either a worker or a user thread that assisted with jobs.
+     * Counters are accumulated since the JobManager was created or since the last JobManager::ClearStats.
+     */
+    struct JobManagerThreadTelemetry
+    {
+        /**
+         * Number of buckets in the job duration histogram. Bucket 0 counts jobs that took less than 1 microsecond,
+         * bucket i counts jobs that took [2^(i-1), 2^i) microseconds and the last bucket also counts all longer jobs.
+         */
+        static constexpr size_t NumJobDurationBuckets = 20;
+        using JobDurationHistogram = AZStd::array<AZ::u64, NumJobDurationBuckets>;
+
+        static size_t GetJobDurationBucket(AZ::u64 microseconds);
+        static AZ::u64 GetJobDurationBucketUpperBound(size_t bucket); ///< in microseconds, exclusive
+
+        JobManagerThreadTelemetry& operator+=(const JobManagerThreadTelemetry& rhs);
+
+        /// Ratio of successful steals to steal attempts, 0 if the thread never tried to steal.
+        float GetStealSuccessRate() const;
+
+        AZ::u32 m_workerId = ~0u; ///< 0 based worker index, ~0u for user threads
+        bool m_isWorker = false;
+
+        AZ::u64 m_globalJobs = 0; ///< jobs taken from the global queue
+        AZ::u64 m_jobsForked = 0; ///< jobs added to the local queue
+        AZ::u64 m_jobsDone = 0;
+        AZ::u64 m_stealAttempts = 0;
+        AZ::u64 m_jobsStolen = 0;
+        AZ::u64 m_wakeups = 0;
+        AZ::u64 m_futileWakeups = 0; ///< woken up but went back to sleep without running a job
+        AZ::u64 m_spinHits = 0; ///< found work while spinning, saving a wakeup
+
+        AZ::u64 m_jobTimeMicroseconds = 0;
+        AZ::u64 m_stealTimeMicroseconds = 0;
+        AZ::u64 m_wakeLatencyMicroseconds = 0;
+
+        AZ::u64 m_localQueueDepth = 0; ///< jobs in the local queue when the telemetry was gathered
+        AZ::u64 m_maxLocalQueueDepth = 0; ///< highest local queue depth seen when forking a job
+
+        JobDurationHistogram m_jobDurations = {};
+    };
+
+    /**
+     * Snapshot of the runtime telemetry of a JobManager, see JobManager::GetTelemetry.
+     */
+    struct JobManagerTelemetry
+    {
+        /// Sums the telemetry of all threads, queue depths are summed and the maximum local depth is the largest of all threads.
+        JobManagerThreadTelemetry GetTotals() const;
+
+        AZStd::vector<JobManagerThreadTelemetry> m_threads; ///< workers first, in worker id order, then user threads
+
+        AZ::u64 m_globalQueueDepth = 0; ///< jobs in the global queue when the telemetry was gathered
+        AZ::u32 m_numSleepingWorkers = 0;
+        AZ::u32 m_numSpinningWorkers = 0;
+    };
+
+    inline size_t JobManagerThreadTelemetry::GetJobDurationBucket(AZ::u64 microseconds)
+    {
+        size_t bucket = 0;
+        while (microseconds > 0 && bucket < NumJobDurationBuckets - 1)
+        {
+            microseconds >>= 1;
+            ++bucket;
+        }
+        return bucket;
+    }
+
+    inline AZ::u64 JobManagerThreadTelemetry::GetJobDurationBucketUpperBound(size_t bucket)
+    {
+        return bucket < NumJobDurationBuckets - 1 ? (AZ::u64(1) << bucket) : ~AZ::u64(0);
+    }
+
+    inline JobManagerThreadTelemetry& JobManagerThreadTelemetry::operator+=(const JobManagerThreadTelemetry& rhs)
+    {
+        m_globalJobs += rhs.m_globalJobs;
+        m_jobsForked += rhs.m_jobsForked;
+        m_jobsDone += rhs.m_jobsDone;
+        m_stealAttempts += rhs.m_stealAttempts;
+        m_jobsStolen += rhs.m_jobsStolen;
+        m_wakeups += rhs.m_wakeups;
+        m_futileWakeups += rhs.m_futileWakeups;
+        m_spinHits += rhs.m_spinHits;
+        m_jobTimeMicroseconds += rhs.m_jobTimeMicroseconds;
+        m_stealTimeMicroseconds += rhs.m_stealTimeMicroseconds;
+        m_wakeLatencyMicroseconds += rhs.m_wakeLatencyMicroseconds;
+        m_localQueueDepth += rhs.m_localQueueDepth;
+        m_maxLocalQueueDepth = AZStd::max(m_maxLocalQueueDepth, rhs.m_maxLocalQueueDepth);
+        for (size_t i = 0; i < NumJobDurationBuckets; ++i)
+        {
+            m_jobDurations[i] += rhs.m_jobDurations[i];
+        }
+        return *this;
+    }
+
+    inline float JobManagerThreadTelemetry::GetStealSuccessRate() const
+    {
+        return m_stealAttempts ? static_cast<float>(m_jobsStolen) / static_cast<float>(m_stealAttempts) : 0.0f;
+    }
+
+    inline JobManagerThreadTelemetry JobManagerTelemetry::GetTotals() const
+    {
+        JobManagerThreadTelemetry totals;
+        for (const JobManagerThreadTelemetry& thread : m_threads)
+        {
+            totals += thread;
+        }
+        return totals;
+    }
+}
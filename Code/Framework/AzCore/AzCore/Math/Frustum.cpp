@@ -191,6 +191,141 @@ namespace AZ
     }
 
 
+    namespace
+    {
+        // Converts the per lane masks of a batched intersection test into intersection results.
+        void StoreIntersectResults(
+            Simd::Vec4::FloatArgType exteriorMask, Simd::Vec4::FloatArgType overlapsMask, IntersectResult* results, size_t count)
+        {
+            using Simd::Vec4;
+
+            const Vec4::FloatType overlapsOrInterior = Vec4::Select(
+                Vec4::Splat(static_cast<float>(IntersectResult::Overlaps)), Vec4::Splat(static_cast<float>(IntersectResult::Interior)),
+                overlapsMask);
+            const Vec4::FloatType result =
+                Vec4::Select(Vec4::Splat(static_cast<float>(IntersectResult::Exterior)), overlapsOrInterior, exteriorMask);
+
+            int32_t lanes[4];
+            Vec4::StoreUnaligned(lanes, Vec4::ConvertToInt(result));
+            for (size_t i = 0; i < count; ++i)
+            {
+                results[i] = static_cast<IntersectResult>(lanes[i]);
+            }
+        }
+    } // namespace
+
+
+    void Frustum::IntersectSpheres(
+        const float* centerX, const float* centerY, const float* centerZ, const float* radius, size_t count,
+        IntersectResult* results) const
+    {
+        using Simd::Vec4;
+
+        // Splat the plane components once up front, so every plane test below handles four spheres
+        Vec4::FloatType planeX[PlaneId::MAX];
+        Vec4::FloatType planeY[PlaneId::MAX];
+        Vec4::FloatType planeZ[PlaneId::MAX];
+        Vec4::FloatType planeW[PlaneId::MAX];
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            planeX[i] = Vec4::SplatFirst(m_planes[i]);
+            planeY[i] = Vec4::SplatSecond(m_planes[i]);
+            planeZ[i] = Vec4::SplatThird(m_planes[i]);
+            planeW[i] = Vec4::SplatFourth(m_planes[i]);
+        }
+
+        size_t index = 0;
+        for (; index + 4 <= count; index += 4)
+        {
+            const Vec4::FloatType x = Vec4::LoadUnaligned(centerX + index);
+            const Vec4::FloatType y = Vec4::LoadUnaligned(centerY + index);
+            const Vec4::FloatType z = Vec4::LoadUnaligned(centerZ + index);
+            const Vec4::FloatType r = Vec4::LoadUnaligned(radius + index);
+            const Vec4::FloatType negativeR = Vec4::Sub(Vec4::ZeroFloat(), r);
+
+            Vec4::FloatType exteriorMask = Vec4::ZeroFloat();
+            Vec4::FloatType overlapsMask = Vec4::ZeroFloat();
+            for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+            {
+                const Vec4::FloatType distance = Vec4::Madd(x, planeX[i], Vec4::Madd(y, planeY[i], Vec4::Madd(z, planeZ[i], planeW[i])));
+                exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(distance, negativeR));
+                overlapsMask = Vec4::Or(overlapsMask, Vec4::CmpLt(Vec4::Abs(distance), r));
+            }
+
+            StoreIntersectResults(exteriorMask, overlapsMask, results + index, 4);
+        }
+
+        for (; index < count; ++index)
+        {
+            results[index] = IntersectSphere(Vector3(centerX[index], centerY[index], centerZ[index]), radius[index]);
+        }
+    }
+
+
+    void Frustum::IntersectAabbs(
+        const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ,
+        size_t count, IntersectResult* results) const
+    {
+        using Simd::Vec4;
+
+        Vec4::FloatType planeX[PlaneId::MAX];
+        Vec4::FloatType planeY[PlaneId::MAX];
+        Vec4::FloatType planeZ[PlaneId::MAX];
+        Vec4::FloatType planeW[PlaneId::MAX];
+        Vec4::FloatType positiveMask[PlaneId::MAX];
+        for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+        {
+            planeX[i] = Vec4::SplatFirst(m_planes[i]);
+            planeY[i] = Vec4::SplatSecond(m_planes[i]);
+            planeZ[i] = Vec4::SplatThird(m_planes[i]);
+            planeW[i] = Vec4::SplatFourth(m_planes[i]);
+            positiveMask[i] = Vec4::CmpGt(m_planes[i], Vec4::ZeroFloat());
+        }
+
+        size_t index = 0;
+        for (; index + 4 <= count; index += 4)
+        {
+            const Vec4::FloatType minimumX = Vec4::LoadUnaligned(minX + index);
+            const Vec4::FloatType minimumY = Vec4::LoadUnaligned(minY + index);
+            const Vec4::FloatType minimumZ = Vec4::LoadUnaligned(minZ + index);
+            const Vec4::FloatType maximumX = Vec4::LoadUnaligned(maxX + index);
+            const Vec4::FloatType maximumY = Vec4::LoadUnaligned(maxY + index);
+            const Vec4::FloatType maximumZ = Vec4::LoadUnaligned(maxZ + index);
+
+            Vec4::FloatType exteriorMask = Vec4::ZeroFloat();
+            Vec4::FloatType overlapsMask = Vec4::ZeroFloat();
+            for (PlaneId i = PlaneId::Near; i < PlaneId::MAX; ++i)
+            {
+                // The same support points as IntersectAabb, the corner furthest along the plane normal decides whether the box
+                // is outside of the plane and the corner furthest against the normal whether it's fully inside
+                const Vec4::FloatType maskX = Vec4::SplatFirst(positiveMask[i]);
+                const Vec4::FloatType maskY = Vec4::SplatSecond(positiveMask[i]);
+                const Vec4::FloatType maskZ = Vec4::SplatThird(positiveMask[i]);
+
+                const Vec4::FloatType disjointDistance = Vec4::Madd(
+                    Vec4::Select(maximumX, minimumX, maskX), planeX[i],
+                    Vec4::Madd(
+                        Vec4::Select(maximumY, minimumY, maskY), planeY[i],
+                        Vec4::Madd(Vec4::Select(maximumZ, minimumZ, maskZ), planeZ[i], planeW[i])));
+                const Vec4::FloatType intersectDistance = Vec4::Madd(
+                    Vec4::Select(minimumX, maximumX, maskX), planeX[i],
+                    Vec4::Madd(
+                        Vec4::Select(minimumY, maximumY, maskY), planeY[i],
+                        Vec4::Madd(Vec4::Select(minimumZ, maximumZ, maskZ), planeZ[i], planeW[i])));
+
+                exteriorMask = Vec4::Or(exteriorMask, Vec4::CmpLt(disjointDistance, Vec4::ZeroFloat()));
+                overlapsMask = Vec4::Or(overlapsMask, Vec4::CmpLt(intersectDistance, Vec4::ZeroFloat()));
+            }
+
+            StoreIntersectResults(exteriorMask, overlapsMask, results + index, 4);
+        }
+
+        for (; index < count; ++index)
+        {
+            results[index] = IntersectAabb(Vector3(minX[index], minY[index], minZ[index]), Vector3(maxX[index], maxY[index], maxZ[index]));
+        }
+    }
+
     ViewFrustumAttributes Frustum::CalculateViewFrustumAttributes() const
     {
         using Simd::Vec4;
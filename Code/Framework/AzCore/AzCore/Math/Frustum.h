@@ -140,6 +140,28 @@ namespace AZ
         //! @return the intersection result of the Aabb against the frustum
         IntersectResult IntersectAabb(const Aabb& aabb) const;
 
+        //! Intersects a batch of spheres against the frustum, four spheres at a time.
+        //! The spheres are passed as separate arrays for each component, the results match IntersectSphere.
+        //!
+        //! @param centerX, centerY, centerZ the components of the sphere centers
+        //! @param radius the radii of the spheres
+        //! @param count the number of spheres in the batch
+        //! @param[out] results receives the intersection result of each sphere against the frustum
+        void IntersectSpheres(
+            const float* centerX, const float* centerY, const float* centerZ, const float* radius, size_t count,
+            IntersectResult* results) const;
+
+        //! Intersects a batch of axis-aligned bounding boxes against the frustum, four boxes at a time.
+        //! The boxes are passed as separate arrays for each component, the results match IntersectAabb.
+        //!
+        //! @param minX, minY, minZ the components of the smallest extents of the boxes
+        //! @param maxX, maxY, maxZ the components of the largest extents of the boxes
+        //! @param count the number of boxes in the batch
+        //! @param[out] results receives the intersection result of each box against the frustum
+        void IntersectAabbs(
+            const float* minX, const float* minY, const float* minZ, const float* maxX, const float* maxY, const float* maxZ,
+            size_t count, IntersectResult* results) const;
+
         //! Returns true if the current frustum and provided frustum are close to identical.
         //! @param rhs the frustum to compare against for closeness
         bool IsClose(const Frustum& rhs, float tolerance = Constants::Tolerance) const;
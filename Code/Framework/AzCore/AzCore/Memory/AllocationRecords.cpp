@@ -11,12 +11,35 @@
 #include <AzCore/Driller/DrillerBus.h>
 
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/time.h>
 
 #include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Math/Random.h>
+
+#include <math.h>
 
 using namespace AZ;
 using namespace AZ::Debug;
 
+namespace
+{
+    AZStd::atomic<size_t> s_samplingInterval{ 512 * 1024 };
+
+    // Bytes the calling thread can still allocate before the next sampled allocation.
+    thread_local AZ::s64 t_bytesUntilSample = 0;
+    thread_local bool t_isSamplingStarted = false;
+    thread_local AZ::SimpleLcgRandom t_samplingRandom;
+
+    AZ::s64 PickNextSampleDistance()
+    {
+        // exponentially distributed with the sampling interval as mean, this makes the sampling a Poisson process over the allocated bytes
+        const float uniform = 1.0f - t_samplingRandom.GetRandomFloat(); // (0,1]
+        const double interval = static_cast<double>(s_samplingInterval.load(AZStd::memory_order_relaxed));
+        return static_cast<AZ::s64>(-log(static_cast<double>(uniform)) * interval) + 1;
+    }
+}
+
 // Many PC tools break with alloc/free size mismatches when the memory guard is enabled.  Disable for now
 //#define ENABLE_MEMORY_GUARD
 
@@ -36,6 +59,10 @@ AllocationRecords::AllocationRecords(unsigned char stackRecordLevels, bool isMem
     , m_requestedBytesPeak(0)
     , m_allocatorName(allocatorName)
 {
+    for (AZStd::atomic<AZ::u32>& count : m_sampledAddressCounts)
+    {
+        count.store(0, AZStd::memory_order_relaxed);
+    }
 #if defined(ENABLE_MEMORY_GUARD)
     m_memoryGuardSize = isMemoryGuard ? sizeof(Debug::GuardValue) : 0;
 #else
@@ -62,6 +89,14 @@ AllocationRecords::~AllocationRecords()
         EnumerateAllocations(PrintAllocationsCB(true, includeNameAndFilename));
         AZ_Error("Memory", m_records.empty(), "We still have %d allocations on record! They must be freed prior to destroy!", m_records.size());
     }
+
+    for (Debug::SampledStacksType::iterator iter = m_sampledStacks.begin(); iter != m_sampledStacks.end(); ++iter)
+    {
+        if (iter->second.m_stackFrames)
+        {
+            m_sampledStacks.get_allocator().deallocate(iter->second.m_stackFrames, sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1);
+        }
+    }
 }
 
 //=========================================================================
@@ -167,7 +202,7 @@ AllocationRecords::RegisterAllocation(void* address, size_t byteSize, size_t ali
     ai.m_timeStamp = AZStd::GetTimeNowMicroSecond();
 
     // if we don't have a fileName,lineNum record the stack or if the user requested it.
-    if ((fileName == 0 && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL)
+    if ((fileName == 0 && m_mode == RECORD_STACK_IF_NO_FILE_LINE) || m_mode == RECORD_FULL || m_mode == RECORD_SAMPLED)
     {
         ai.m_stackFrames = m_numStackLevels ? reinterpret_cast<AZ::Debug::StackFrame*>(m_records.get_allocator().allocate(sizeof(AZ::Debug::StackFrame)*m_numStackLevels, 1)) : nullptr;
         if (ai.m_stackFrames)
@@ -206,6 +241,11 @@ AllocationRecords::RegisterAllocation(void* address, size_t byteSize, size_t ali
 
     AllocatorManager::Instance().DebugBreak(address, ai);
 
+    if (m_mode == RECORD_SAMPLED)
+    {
+        AddSampledAllocation(address, ai);
+    }
+
     // statistics
     m_requestedBytes += byteSize;
     m_requestedBytesPeak = AZStd::GetMax(m_requestedBytesPeak, m_requestedBytes);
@@ -248,6 +288,11 @@ AllocationRecords::UnregisterAllocation(void* address, size_t byteSize, size_t a
 
     // statistics
     m_requestedBytes -= iter->second.m_byteSize;
+
+    if (m_mode == RECORD_SAMPLED)
+    {
+        RemoveSampledAllocation(address, iter->second);
+    }
     
 #if defined(ENABLE_MEMORY_GUARD)
     // memory guard
@@ -324,6 +369,10 @@ AllocationRecords::ResizeAllocation(void* address, size_t newSize)
     }
 
     Debug::AllocationRecordsType::iterator iter = m_records.find(address);
+    if (iter == m_records.end() && m_mode == RECORD_SAMPLED)
+    {
+        return; // the address shares a bucket with a sampled allocation, but it was not sampled
+    }
     AZ_Assert(iter!=m_records.end(), "Could not find address 0x%p in the allocator!", address);
     AllocatorManager::Instance().DebugBreak(address, iter->second);
     
@@ -361,6 +410,15 @@ AllocationRecords::ResizeAllocation(void* address, size_t newSize)
     m_requestedBytesPeak = AZStd::GetMax(m_requestedBytesPeak, m_requestedBytes);
     ++m_requestedAllocs;
 
+    if (m_mode == RECORD_SAMPLED)
+    {
+        if (SampledStackInfo* stackInfo = FindSampledStack(iter->second))
+        {
+            stackInfo->m_liveBytes -= iter->second.m_byteSize;
+            stackInfo->m_liveBytes += newSize;
+        }
+    }
+
     // update allocation size
     iter->second.m_byteSize = newSize;
 }
@@ -374,9 +432,10 @@ AllocationRecords::SetMode(Mode mode)
 {
     DrillerEBusMutex::GetMutex().lock();
 
-    if (mode==RECORD_NO_RECORDS)
+    // Sampled records and full records can't be mixed, the deallocations of the allocations which were not sampled are filtered out.
+    if (mode==RECORD_NO_RECORDS || (mode != m_mode && (mode == RECORD_SAMPLED || m_mode == RECORD_SAMPLED)))
     {
-        m_records.clear();
+        ClearRecordsNoLock();
         m_requestedBytes = 0;
         m_requestedBytesPeak = 0;
         m_requestedAllocs = 0;
@@ -411,6 +470,174 @@ AllocationRecords::EnumerateAllocations(AllocationInfoCBType cb)
     DrillerEBusMutex::GetMutex().unlock();
 }
 
+//=========================================================================
+// ClearRecordsNoLock
+//=========================================================================
+void
+AllocationRecords::ClearRecordsNoLock()
+{
+    for (Debug::AllocationRecordsType::iterator iter = m_records.begin(); iter != m_records.end(); ++iter)
+    {
+        if (iter->second.m_namesBlock)
+        {
+            m_records.get_allocator().deallocate(iter->second.m_namesBlock, iter->second.m_namesBlockSize, 1);
+        }
+        if (iter->second.m_stackFrames)
+        {
+            m_records.get_allocator().deallocate(iter->second.m_stackFrames, sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1);
+        }
+    }
+    m_records.clear();
+
+    for (Debug::SampledStacksType::iterator iter = m_sampledStacks.begin(); iter != m_sampledStacks.end(); ++iter)
+    {
+        if (iter->second.m_stackFrames)
+        {
+            m_sampledStacks.get_allocator().deallocate(iter->second.m_stackFrames, sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1);
+        }
+    }
+    m_sampledStacks.clear();
+
+    for (AZStd::atomic<AZ::u32>& count : m_sampledAddressCounts)
+    {
+        count.store(0, AZStd::memory_order_relaxed);
+    }
+}
+
+//=========================================================================
+// SetSamplingInterval
+//=========================================================================
+void
+AllocationRecords::SetSamplingInterval(size_t samplingInterval)
+{
+    AZ_Assert(samplingInterval > 0, "Sampling interval must be at least 1 byte!");
+    s_samplingInterval.store(AZStd::GetMax(samplingInterval, size_t(1)), AZStd::memory_order_relaxed);
+}
+
+//=========================================================================
+// GetSamplingInterval
+//=========================================================================
+size_t
+AllocationRecords::GetSamplingInterval()
+{
+    return s_samplingInterval.load(AZStd::memory_order_relaxed);
+}
+
+//=========================================================================
+// ShouldSampleAllocation
+//=========================================================================
+bool
+AllocationRecords::ShouldSampleAllocation(size_t byteSize)
+{
+    t_bytesUntilSample -= static_cast<AZ::s64>(byteSize);
+    if (t_bytesUntilSample >= 0)
+    {
+        return false;
+    }
+
+    // The first allocation of a thread only starts its countdown, so threads don't sample their first allocation.
+    const bool isSampled = t_isSamplingStarted;
+    if (!t_isSamplingStarted)
+    {
+        t_samplingRandom.SetSeed(reinterpret_cast<size_t>(&t_bytesUntilSample) ^ AZStd::GetTimeNowTicks());
+        t_isSamplingStarted = true;
+    }
+    t_bytesUntilSample = PickNextSampleDistance();
+    return isSampled;
+}
+
+//=========================================================================
+// SampledAddressBucket
+//=========================================================================
+size_t
+AllocationRecords::SampledAddressBucket(void* address)
+{
+    // Fibonacci hashing, allocations are at least 8 bytes aligned so skip the low bits
+    const AZ::u64 hash = (static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address)) >> 3) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 52) % SampledAddressBuckets;
+}
+
+//=========================================================================
+// IsSampledAllocationCandidate
+//=========================================================================
+bool
+AllocationRecords::IsSampledAllocationCandidate(void* address) const
+{
+    return m_sampledAddressCounts[SampledAddressBucket(address)].load(AZStd::memory_order_relaxed) != 0;
+}
+
+//=========================================================================
+// FindSampledStack
+//=========================================================================
+SampledStackInfo*
+AllocationRecords::FindSampledStack(const AllocationInfo& info)
+{
+    size_t stackHash = 0;
+    if (info.m_stackFrames)
+    {
+        for (unsigned char i = 0; i < m_numStackLevels; ++i)
+        {
+            AZStd::hash_combine(stackHash, info.m_stackFrames[i].m_programCounter);
+        }
+    }
+
+    Debug::SampledStacksType::pair_iter_bool iterBool = m_sampledStacks.insert_key(stackHash);
+    SampledStackInfo& stackInfo = iterBool.first->second;
+    if (iterBool.second && info.m_stackFrames)
+    {
+        stackInfo.m_stackFrames = reinterpret_cast<AZ::Debug::StackFrame*>(m_sampledStacks.get_allocator().allocate(sizeof(AZ::Debug::StackFrame) * m_numStackLevels, 1));
+        memcpy(stackInfo.m_stackFrames, info.m_stackFrames, sizeof(AZ::Debug::StackFrame) * m_numStackLevels);
+    }
+    return &stackInfo;
+}
+
+//=========================================================================
+// AddSampledAllocation
+//=========================================================================
+void
+AllocationRecords::AddSampledAllocation(void* address, const AllocationInfo& info)
+{
+    m_sampledAddressCounts[SampledAddressBucket(address)].fetch_add(1, AZStd::memory_order_relaxed);
+
+    SampledStackInfo* stackInfo = FindSampledStack(info);
+    ++stackInfo->m_numLiveAllocations;
+    stackInfo->m_liveBytes += info.m_byteSize;
+    ++stackInfo->m_numAllocations;
+    stackInfo->m_allocatedBytes += info.m_byteSize;
+}
+
+//=========================================================================
+// RemoveSampledAllocation
+//=========================================================================
+void
+AllocationRecords::RemoveSampledAllocation(void* address, const AllocationInfo& info)
+{
+    m_sampledAddressCounts[SampledAddressBucket(address)].fetch_sub(1, AZStd::memory_order_relaxed);
+
+    SampledStackInfo* stackInfo = FindSampledStack(info);
+    --stackInfo->m_numLiveAllocations;
+    stackInfo->m_liveBytes -= info.m_byteSize;
+}
+
+//=========================================================================
+// EnumerateSampledStacks
+//=========================================================================
+void
+AllocationRecords::EnumerateSampledStacks(SampledStackInfoCBType cb)
+{
+    DrillerEBusMutex::GetMutex().lock();
+    // Like EnumerateAllocations, iterate a copy since the callback can allocate. Callstacks are only freed when the records are cleared.
+    const Debug::SampledStacksType stacksCopy = m_sampledStacks;
+    for (Debug::SampledStacksType::const_iterator iter = stacksCopy.begin(); iter != stacksCopy.end(); ++iter)
+    {
+        if (!cb(iter->second, m_numStackLevels))
+        {
+            break;
+        }
+    }
+    DrillerEBusMutex::GetMutex().unlock();
+}
+
 //=========================================================================
 // IntegrityCheck
 // [9/9/2011]
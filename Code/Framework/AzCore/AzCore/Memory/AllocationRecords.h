@@ -13,6 +13,7 @@
 
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace AZ
 {
@@ -42,6 +43,29 @@ namespace AZ
         // We use OSAllocator which uses system calls to allocate memory, they are not recorded or tracked!
         typedef AZStd::unordered_map<void*, AllocationInfo, AZStd::hash<void*>, AZStd::equal_to<void*>, OSStdAllocator>  AllocationRecordsType;
 
+        /**
+        * Statistics of the sampled allocations made from the same callstack, see AllocationRecords::RECORD_SAMPLED.
+        * The values are the sampled ones, they have to be scaled by the sampling interval to estimate the real ones.
+        */
+        struct SampledStackInfo
+        {
+            AZ::Debug::StackFrame*  m_stackFrames{};    ///< Callstack shared by the allocations, AllocationRecords::GetNumStackLevels() entries.
+            AZ::u64         m_numLiveAllocations{};     ///< Sampled allocations that were not freed yet.
+            AZ::u64         m_liveBytes{};
+            AZ::u64         m_numAllocations{};         ///< All sampled allocations, including the freed ones.
+            AZ::u64         m_allocatedBytes{};
+        };
+
+        typedef AZStd::unordered_map<size_t, SampledStackInfo, AZStd::hash<size_t>, AZStd::equal_to<size_t>, OSStdAllocator>  SampledStacksType;
+
+        /**
+         * Sampled callstacks enumeration callback
+         * \param const SampledStackInfo& statistics of the callstack.
+         * \param unsigned char number of stack levels in SampledStackInfo::m_stackFrames.
+         * \returns true if you want to continue traverse of the callstacks and false if you want to stop.
+         */
+        typedef AZStd::function<bool (const SampledStackInfo&, unsigned char)> SampledStackInfoCBType;
+
         /**
          * Records enumeration callback
          * \param void* allocation address
@@ -130,6 +154,7 @@ namespace AZ
                 RECORD_STACK_NEVER,             ///< Never record stack traces. All other info is stored.
                 RECORD_STACK_IF_NO_FILE_LINE,   ///< Record stack if fileName and lineNum are not available. (default)
                 RECORD_FULL,                    ///< Always record the full stack.
+                RECORD_SAMPLED,                 ///< Record only a sample of the allocations, on average one every sampling interval bytes, with the full stack. Cheap enough for production.
 
                 RECORD_MAX                      ///< Must be last
             };
@@ -186,6 +211,22 @@ namespace AZ
 
             const char* GetAllocatorName() const                { return m_allocatorName; }
 
+            // @{ Sampling, used in RECORD_SAMPLED mode.
+            // Allocations are Poisson sampled by bytes like tcmalloc: every thread counts down a random number of bytes,
+            // exponentially distributed with the sampling interval as mean, and the allocation that crosses zero is recorded.
+            // Large allocations are therefore always recorded, and small ones with a probability proportional to their size.
+
+            /// Sets the average number of bytes between sampled allocations, for all threads and allocators. Default 512KB.
+            static void     SetSamplingInterval(size_t samplingInterval);
+            static size_t   GetSamplingInterval();
+            /// Returns true if an allocation of byteSize bytes should be sampled. Only updates a counter of the calling thread, so it can be called for every allocation.
+            static bool     ShouldSampleAllocation(size_t byteSize);
+            /// Returns false if the address is certainly not a sampled allocation, so deallocations can skip the records without a lock. Lock free.
+            bool            IsSampledAllocationCandidate(void* address) const;
+            /// Enumerates the statistics of all sampled callstacks in a thread safe manner.
+            void            EnumerateSampledStacks(SampledStackInfoCBType cb);
+            // @}
+
         protected:
 
             // @{ Allocation tracking management - we assume this functions are called with the lock locked.
@@ -197,7 +238,21 @@ namespace AZ
 
             void    IntegrityCheckNoLock() const;
 
+            /// Frees all records and the sampled callstacks, we assume the lock is locked.
+            void    ClearRecordsNoLock();
+
+            // @{ Sampled callstacks - we assume this functions are called with the lock locked.
+            static size_t SampledAddressBucket(void* address);
+            SampledStackInfo* FindSampledStack(const AllocationInfo& info);
+            void    AddSampledAllocation(void* address, const AllocationInfo& info);
+            void    RemoveSampledAllocation(void* address, const AllocationInfo& info);
+            // @}
+
+            static const size_t             SampledAddressBuckets = 4096;
+
             Debug::AllocationRecordsType    m_records;
+            Debug::SampledStacksType        m_sampledStacks;
+            AZStd::atomic<AZ::u32>          m_sampledAddressCounts[SampledAddressBuckets];  ///< Number of sampled allocations per address hash, to filter out the deallocations of allocations that were not sampled.
             Mode                            m_mode;
             bool                            m_isAutoIntegrityCheck;
             bool                            m_isMarkUnallocatedMemory;      ///< True if we want to set value 0xcd in unallocated memory.
@@ -7,6 +7,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationRecords.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
 
 using namespace AZ;
@@ -121,6 +122,11 @@ void AllocatorBase::DisableRegistration()
     m_registrationEnabled = false;
 }
 
+bool AllocatorBase::IsSamplingAllocations() const
+{
+    return m_records && m_records->GetMode() == Debug::AllocationRecords::RECORD_SAMPLED;
+}
+
 void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignment, const char* name, const char* fileName, int lineNum, int suppressStackRecord)
 {
 #if defined(AZ_HAS_VARIADIC_TEMPLATES) && defined(AZ_DEBUG_BUILD)
@@ -132,6 +138,11 @@ void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignme
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
         AZ::PlatformMemoryInstrumentation::Alloc(ptr, byteSize, 0, m_platformMemoryInstrumentationGroupId);
 #else
+        // In sampled mode only the sampled allocations reach the records, the others skip the driller bus and its lock
+        if (IsSamplingAllocations() && !Debug::AllocationRecords::ShouldSampleAllocation(byteSize))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, RegisterAllocation, this, ptr, byteSize, alignment, name, fileName, lineNum, suppressStackRecord);
 #endif
     }
@@ -144,6 +155,10 @@ void AllocatorBase::ProfileDeallocation(void* ptr, size_t byteSize, size_t align
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
         AZ::PlatformMemoryInstrumentation::Free(ptr);
 #else
+        if (IsSamplingAllocations() && !m_records->IsSampledAllocationCandidate(ptr))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, UnregisterAllocation, this, ptr, byteSize, alignment, info);
 #endif
     }
@@ -170,6 +185,13 @@ void AllocatorBase::ProfileReallocationEnd(void* ptr, void* newPtr, size_t newSi
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
         AZ::PlatformMemoryInstrumentation::ReallocEnd(newPtr, newSize, 0);
 #else
+        if (IsSamplingAllocations())
+        {
+            // The new block is sampled on its own, its size decides if it's recorded.
+            ProfileDeallocation(ptr, 0, 0, nullptr);
+            ProfileAllocation(newPtr, newSize, newAlignment, nullptr, nullptr, 0, 0);
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, ReallocateAllocation, this, ptr, newPtr, newSize, newAlignment);
 #endif
     }
@@ -184,6 +206,10 @@ void AllocatorBase::ProfileResize(void* ptr, size_t newSize)
 {
     if (newSize && m_isProfilingActive)
     {
+        if (IsSamplingAllocations() && !m_records->IsSampledAllocationCandidate(ptr))
+        {
+            return;
+        }
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, ResizeAllocation, this, ptr, newSize);
     }
 }
@@ -99,6 +99,8 @@ namespace AZ
         bool OnOutOfMemory(size_t byteSize, size_t alignment, int flags, const char* name, const char* fileName, int lineNum);
 
     private:
+        /// True if the records only keep a sample of the allocations, see Debug::AllocationRecords::RECORD_SAMPLED.
+        bool IsSamplingAllocations() const;
 
         const char* m_name = nullptr;
         const char* m_desc = nullptr;
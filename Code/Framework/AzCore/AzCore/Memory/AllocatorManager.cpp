@@ -14,6 +14,10 @@
 #include <AzCore/Memory/AllocatorOverrideShim.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/Driller/DrillerBus.h>
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/SystemFile.h>
 
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -586,7 +590,163 @@ AllocatorManager::DumpAllocators()
     }
 
     AZ_Printf(TAG, "-,Totals,%.2f,%.2f,%.2f\n", totalUsedBytes / 1024.0f, totalReservedBytes / 1024.0f, totalConsumedBytes / 1024.0f);
+
+    // Thread caches, without allocating since this can run when memory is exhausted
+    static const size_t maxThreadCaches = 64;
+    AllocatorThreadCacheStats cacheStats[maxThreadCaches];
+    IAllocatorAllocate* schemaList[m_maxNumAllocators];
+    for (int i = 0; i < m_numAllocators; i++)
+    {
+        IAllocatorAllocate* schema = m_allocators[i]->GetSchema();
+        schemaList[i] = schema;
+        if (!schema || AZStd::find(schemaList, schemaList + i, schema) != schemaList + i)
+        {
+            continue;
+        }
+        const size_t numCaches = AZStd::GetMin(schema->GetThreadCacheStats(cacheStats, maxThreadCaches), maxThreadCaches);
+        if (numCaches > 0)
+        {
+            AZ_Printf(TAG, "%s thread caches: Thread,Hits,Misses,Hit rate,Cached kb\n", m_allocators[i]->GetName());
+        }
+        for (size_t cacheIndex = 0; cacheIndex < numCaches; ++cacheIndex)
+        {
+            const AllocatorThreadCacheStats& stats = cacheStats[cacheIndex];
+            const AZ::u64 numAllocations = stats.m_numHits + stats.m_numMisses;
+            AZ_Printf(TAG, "%zu,%llu,%llu,%.1f%%,%.2f\n", static_cast<size_t>(stats.m_threadId.m_id),
+                static_cast<unsigned long long>(stats.m_numHits), static_cast<unsigned long long>(stats.m_numMisses),
+                numAllocations ? 100.0f * stats.m_numHits / numAllocations : 0.0f, stats.m_cachedBytes / 1024.0f);
+        }
+    }
 }
+
+void AllocatorManager::GetThreadCacheStats(AZStd::vector<ThreadCacheStats>& outStats)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+    AZStd::vector<AllocatorThreadCacheStats> cacheStats;
+    AZStd::vector<IAllocatorAllocate*> visitedSchemas;
+    for (int i = 0; i < m_numAllocators; ++i)
+    {
+        IAllocatorAllocate* schema = m_allocators[i]->GetSchema();
+        // Allocators can share a schema, report its caches once
+        if (!schema || AZStd::find(visitedSchemas.begin(), visitedSchemas.end(), schema) != visitedSchemas.end())
+        {
+            continue;
+        }
+        visitedSchemas.push_back(schema);
+
+        // Threads can attach caches between the calls, so query until all of them fit
+        size_t numCaches = schema->GetThreadCacheStats(cacheStats.data(), cacheStats.size());
+        while (numCaches > cacheStats.size())
+        {
+            cacheStats.resize(numCaches);
+            numCaches = schema->GetThreadCacheStats(cacheStats.data(), cacheStats.size());
+        }
+        for (size_t cacheIndex = 0; cacheIndex < numCaches; ++cacheIndex)
+        {
+            outStats.emplace_back(m_allocators[i]->GetName(), cacheStats[cacheIndex]);
+        }
+    }
+}
+bool AllocatorManager::WriteSampledHeapProfile(IO::GenericStream& stream)
+{
+    struct ProfileStack
+    {
+        AZStd::vector<uintptr_t> m_programCounters;
+        Debug::SampledStackInfo m_stats;
+    };
+    // The allocators share the callstacks of the process, so their samples are merged into one profile
+    AZStd::unordered_map<size_t, ProfileStack> stacks;
+    bool isSampling = false;
+    {
+        // Same lock order as the MemoryDriller, the records are guarded by the driller mutex
+        AZStd::lock_guard<Debug::DrillerEBusMutex::MutexType> drillerLock(Debug::DrillerEBusMutex::GetMutex());
+        AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+        for (int i = 0; i < m_numAllocators; ++i)
+        {
+            Debug::AllocationRecords* records = m_allocators[i]->GetRecords();
+            if (!records || records->GetMode() != Debug::AllocationRecords::RECORD_SAMPLED)
+            {
+                continue;
+            }
+            isSampling = true;
+            records->EnumerateSampledStacks([&stacks](const Debug::SampledStackInfo& info, unsigned char numStackLevels)
+            {
+                size_t stackHash = 0;
+                unsigned char numFrames = 0;
+                while (info.m_stackFrames && numFrames < numStackLevels && info.m_stackFrames[numFrames].IsValid())
+                {
+                    AZStd::hash_combine(stackHash, info.m_stackFrames[numFrames].m_programCounter);
+                    ++numFrames;
+                }
+
+                ProfileStack& stack = stacks[stackHash];
+                if (stack.m_programCounters.empty())
+                {
+                    for (unsigned char frame = 0; frame < numFrames; ++frame)
+                    {
+                        stack.m_programCounters.push_back(info.m_stackFrames[frame].m_programCounter);
+                    }
+                }
+                stack.m_stats.m_numLiveAllocations += info.m_numLiveAllocations;
+                stack.m_stats.m_liveBytes += info.m_liveBytes;
+                stack.m_stats.m_numAllocations += info.m_numAllocations;
+                stack.m_stats.m_allocatedBytes += info.m_allocatedBytes;
+                return true;
+            });
+        }
+    }
+
+    if (!isSampling)
+    {
+        return false;
+    }
+
+    Debug::SampledStackInfo totals;
+    for (const auto& stack : stacks)
+    {
+        totals.m_numLiveAllocations += stack.second.m_stats.m_numLiveAllocations;
+        totals.m_liveBytes += stack.second.m_stats.m_liveBytes;
+        totals.m_numAllocations += stack.second.m_stats.m_numAllocations;
+        totals.m_allocatedBytes += stack.second.m_stats.m_allocatedBytes;
+    }
+
+    // heap_v2 tells pprof the counts are sampled, it scales them back with the sampling interval
+    AZStd::string line = AZStd::string::format("heap profile: %llu: %llu [%llu: %llu] @ heap_v2/%zu\n",
+        static_cast<unsigned long long>(totals.m_numLiveAllocations), static_cast<unsigned long long>(totals.m_liveBytes),
+        static_cast<unsigned long long>(totals.m_numAllocations), static_cast<unsigned long long>(totals.m_allocatedBytes),
+        Debug::AllocationRecords::GetSamplingInterval());
+    stream.Write(line.size(), line.data());
+
+    for (const auto& stack : stacks)
+    {
+        const Debug::SampledStackInfo& stats = stack.second.m_stats;
+        line = AZStd::string::format("%llu: %llu [%llu: %llu] @",
+            static_cast<unsigned long long>(stats.m_numLiveAllocations), static_cast<unsigned long long>(stats.m_liveBytes),
+            static_cast<unsigned long long>(stats.m_numAllocations), static_cast<unsigned long long>(stats.m_allocatedBytes));
+        for (uintptr_t programCounter : stack.second.m_programCounters)
+        {
+            line += AZStd::string::format(" 0x%llx", static_cast<unsigned long long>(programCounter));
+        }
+        line += "\n";
+        stream.Write(line.size(), line.data());
+    }
+
+    // The memory map lets pprof find the binaries the addresses belong to
+    static const char mapsPath[] = "/proc/self/maps";
+    IO::SystemFile mapsFile;
+    if (IO::SystemFile::Exists(mapsPath) && mapsFile.Open(mapsPath, IO::SystemFile::SF_OPEN_READ_ONLY))
+    {
+        static const char mappedLibraries[] = "\nMAPPED_LIBRARIES:\n";
+        stream.Write(sizeof(mappedLibraries) - 1, mappedLibraries);
+        char buffer[4096];
+        for (IO::SystemFile::SizeType numRead = mapsFile.Read(sizeof(buffer), buffer); numRead > 0; numRead = mapsFile.Read(sizeof(buffer), buffer))
+        {
+            stream.Write(numRead, buffer);
+        }
+    }
+    return true;
+}
+
 void AllocatorManager::GetAllocatorStats(size_t& allocatedBytes, size_t& capacityBytes, AZStd::vector<AllocatorStats>* outStats)
 {
     allocatedBytes = 0;
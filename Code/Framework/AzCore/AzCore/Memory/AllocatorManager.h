@@ -8,6 +8,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/IAllocator.h>
 #include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/string/string.h>
@@ -22,6 +23,11 @@ namespace AZ
     class IAllocator;
     class MallocSchema;
 
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     /**
     * Global allocation manager. It has access to all
     * created allocators IAllocator interface. And control
@@ -127,6 +133,33 @@ namespace AZ
 
         void GetAllocatorStats(size_t& usedBytes, size_t& reservedBytes, AZStd::vector<AllocatorStats>* outStats = nullptr);
 
+        struct ThreadCacheStats
+        {
+            ThreadCacheStats(const char* allocatorName, const AllocatorThreadCacheStats& cacheStats)
+                : m_allocatorName(allocatorName)
+                , m_cacheStats(cacheStats)
+            {}
+
+            /// Fraction of the allocations of the thread that were served from its cache.
+            float GetHitRate() const
+            {
+                const AZ::u64 numAllocations = m_cacheStats.m_numHits + m_cacheStats.m_numMisses;
+                return numAllocations ? static_cast<float>(m_cacheStats.m_numHits) / static_cast<float>(numAllocations) : 0.0f;
+            }
+
+            AZStd::string m_allocatorName;
+            AllocatorThreadCacheStats m_cacheStats;
+        };
+
+        /// Returns the statistics of the caches per thread of all allocators whose schema keeps them (see IAllocatorAllocate::GetThreadCacheStats).
+        void GetThreadCacheStats(AZStd::vector<ThreadCacheStats>& outStats);
+
+        /// Writes the sampled allocations of all allocators recording in Debug::AllocationRecords::RECORD_SAMPLED mode as
+        /// a pprof heap profile (legacy text format), with the live and the total sampled allocations per callstack.
+        /// When the platform exposes /proc/self/maps it's appended, so pprof can symbolize the addresses against the binaries.
+        /// Returns false if no allocator records sampled allocations.
+        bool WriteSampledHeapProfile(IO::GenericStream& stream);
+
         //////////////////////////////////////////////////////////////////////////
         // Debug support
         static const int MaxNumMemoryBreaks = 5;
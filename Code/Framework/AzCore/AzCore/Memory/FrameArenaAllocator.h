@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator
+     * Scratch memory for data that doesn't outlive the frame, like per frame visibility lists and temporary
+     * containers. Allocations bump a pointer of the calling thread and all memory is released at once when
+     * the ComponentApplication starts the next tick, so nothing allocated from it can be kept across frames.
+     * Use FrameArenaStdAllocator for AZStd containers.
+     */
+    class FrameArenaAllocator
+        : public SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{6F0A2B7C-4D1E-4B8A-9C53-2E7D8F1A6B94}");
+
+        using Base = SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, false, true>;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Linear allocator for per frame scratch memory")
+        {
+            DisableOverriding();
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            // Allocations are released in bulk with the frame, there are no deallocations to track.
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        /// Releases all allocations of the frame. Must be called while no thread is allocating.
+        void ResetFrame()
+        {
+            GetFrameArenaSchema()->ResetFrame();
+        }
+
+        /// Returns the largest number of bytes allocated in a single frame.
+        size_type GetPeakFrameBytes() const
+        {
+            return static_cast<const FrameArenaSchema*>(m_schema)->GetPeakFrameBytes();
+        }
+
+    private:
+        FrameArenaSchema* GetFrameArenaSchema()
+        {
+            return static_cast<FrameArenaSchema*>(m_schema);
+        }
+    };
+
+    using FrameArenaStdAllocator = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
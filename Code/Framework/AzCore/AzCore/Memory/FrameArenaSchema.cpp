@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace FrameArenaInternal
+    {
+        static const size_t MinAlignment = 8;
+        static const size_t PageAlignment = 16;
+        static const size_t MaxCachedArenas = 4;
+
+        struct CachedArena
+        {
+            AZ::u64 m_arenaId;
+            void* m_threadArena;
+        };
+
+        // Arena ids are never reused, so entries of destroyed arenas are never matched again.
+        static AZStd::atomic<AZ::u64> s_nextArenaId{ 1 };
+        static thread_local CachedArena s_cachedArenas[MaxCachedArenas];
+        static thread_local size_t s_nextCachedArena;
+    }
+
+    struct FrameArenaSchema::Page
+    {
+        Page* m_next;
+        size_t m_size;                  ///< Size of the page including this header.
+
+        char* Begin() { return reinterpret_cast<char*>(this + 1); }
+        char* End() { return reinterpret_cast<char*>(this) + m_size; }
+    };
+
+    struct FrameArenaSchema::ThreadArena
+    {
+        AZStd::thread_id m_threadId;
+        Page* m_pages = nullptr;        ///< Pages used by the thread this frame, the first one is the current page.
+        Page* m_oversizePages = nullptr;
+        char* m_current = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 };
+        ThreadArena* m_next = nullptr;
+    };
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(const Descriptor& desc)
+        : m_desc(desc)
+        , m_id(FrameArenaInternal::s_nextArenaId++)
+    {
+        if (m_desc.m_pageAllocator == nullptr)
+        {
+            m_desc.m_pageAllocator = &AllocatorInstance<SystemAllocator>::Get(); // use the SystemAllocator if no page allocator is provided
+        }
+        AZ_Assert(m_desc.m_pageSize > sizeof(Page) * 2, "Page size %zu is too small for the frame arena!", m_desc.m_pageSize);
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        ResetFrame();
+        GarbageCollect();
+
+        while (m_threadArenas)
+        {
+            ThreadArena* arena = m_threadArenas;
+            m_threadArenas = arena->m_next;
+            arena->~ThreadArena();
+            m_desc.m_pageAllocator->DeAllocate(arena, sizeof(ThreadArena), alignof(ThreadArena));
+        }
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        byteSize = AZ::GetMax(byteSize, size_type(1));
+        alignment = AZ::GetMax(alignment, FrameArenaInternal::MinAlignment);
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment %zu must be a power of 2!", alignment);
+
+        ThreadArena* arena = GetThreadArena();
+        char* address = AZ::PointerAlignUp(arena->m_current, alignment);
+        if (address && address + byteSize <= arena->m_end)
+        {
+            arena->m_current = address + byteSize;
+            arena->m_lastAllocation = address;
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+            return address;
+        }
+        return AllocateFromNewPage(arena, byteSize, alignment);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+
+        if (ptr == nullptr)
+        {
+            return;
+        }
+
+        // Only the last allocation can be given back, everything else is released with the frame.
+        ThreadArena* arena = GetThreadArena();
+        if (ptr == arena->m_lastAllocation)
+        {
+            size_t allocationSize = arena->m_current - arena->m_lastAllocation;
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - allocationSize, AZStd::memory_order_relaxed);
+            arena->m_current = arena->m_lastAllocation;
+            arena->m_lastAllocation = nullptr;
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        ThreadArena* arena = GetThreadArena();
+        char* address = reinterpret_cast<char*>(ptr);
+        if (address == nullptr || address != arena->m_lastAllocation || address + newSize > arena->m_end)
+        {
+            return 0;
+        }
+
+        newSize = AZ::GetMax(newSize, size_type(1));
+        size_t allocationSize = arena->m_current - address;
+        arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - allocationSize + newSize, AZStd::memory_order_relaxed);
+        arena->m_current = address + newSize;
+        return newSize;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            DeAllocate(ptr);
+            return nullptr;
+        }
+
+        ThreadArena* arena = GetThreadArena();
+        if (ptr != arena->m_lastAllocation)
+        {
+            AZ_Assert(false, "FrameArenaSchema can only reallocate the last allocation of a thread!");
+            return nullptr;
+        }
+
+        newAlignment = AZ::GetMax(newAlignment, FrameArenaInternal::MinAlignment);
+        if ((reinterpret_cast<size_t>(ptr) & (newAlignment - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+
+        // The allocation doesn't fit in the current page anymore, move it to a new one.
+        size_t allocationSize = arena->m_current - arena->m_lastAllocation;
+        pointer_type newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memcpy(newPtr, ptr, AZ::GetMin(allocationSize, newSize));
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        (void)ptr;
+        return 0;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void FrameArenaSchema::GarbageCollect()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        while (m_freePages)
+        {
+            Page* page = m_freePages;
+            m_freePages = page->m_next;
+            ReleasePage(page);
+        }
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_type numAllocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (ThreadArena* arena = m_threadArenas; arena; arena = arena->m_next)
+        {
+            numAllocatedBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return numAllocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        return m_capacity.load(AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        size_type maxPageSize = m_desc.m_pageAllocator->GetMaxAllocationSize();
+        return maxPageSize > sizeof(Page) ? maxPageSize - sizeof(Page) : 0;
+    }
+
+    //=========================================================================
+    // GetSubAllocator
+    //=========================================================================
+    IAllocatorAllocate* FrameArenaSchema::GetSubAllocator()
+    {
+        return m_desc.m_pageAllocator;
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaSchema::ResetFrame()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        size_t frameBytes = 0;
+        for (ThreadArena* arena = m_threadArenas; arena; arena = arena->m_next)
+        {
+            frameBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            arena->m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+
+            while (arena->m_pages)
+            {
+                Page* page = arena->m_pages;
+                arena->m_pages = page->m_next;
+                page->m_next = m_freePages;
+                m_freePages = page;
+            }
+            while (arena->m_oversizePages)
+            {
+                Page* page = arena->m_oversizePages;
+                arena->m_oversizePages = page->m_next;
+                ReleasePage(page);
+            }
+            arena->m_current = nullptr;
+            arena->m_end = nullptr;
+            arena->m_lastAllocation = nullptr;
+        }
+        m_peakFrameBytes = AZ::GetMax(m_peakFrameBytes, frameBytes);
+    }
+
+    //=========================================================================
+    // GetPeakFrameBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetPeakFrameBytes() const
+    {
+        size_type numAllocatedBytes = NumAllocatedBytes();
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return AZ::GetMax(m_peakFrameBytes, numAllocatedBytes);
+    }
+
+    //=========================================================================
+    // GetThreadArena
+    //=========================================================================
+    FrameArenaSchema::ThreadArena* FrameArenaSchema::GetThreadArena()
+    {
+        using namespace FrameArenaInternal;
+        for (const CachedArena& cachedArena : s_cachedArenas)
+        {
+            if (cachedArena.m_arenaId == m_id)
+            {
+                return reinterpret_cast<ThreadArena*>(cachedArena.m_threadArena);
+            }
+        }
+
+        // The thread is new to this arena, or its entry was evicted by other arenas.
+        ThreadArena* threadArena = nullptr;
+        AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            for (ThreadArena* arena = m_threadArenas; arena; arena = arena->m_next)
+            {
+                if (arena->m_threadId == threadId)
+                {
+                    threadArena = arena;
+                    break;
+                }
+            }
+            if (threadArena == nullptr)
+            {
+                void* memory = m_desc.m_pageAllocator->Allocate(sizeof(ThreadArena), alignof(ThreadArena), 0, "AZ::FrameArenaSchema::ThreadArena", __FILE__, __LINE__);
+                threadArena = new(memory) ThreadArena();
+                threadArena->m_threadId = threadId;
+                threadArena->m_next = m_threadArenas;
+                m_threadArenas = threadArena;
+            }
+        }
+
+        CachedArena& cachedArena = s_cachedArenas[s_nextCachedArena++ % MaxCachedArenas];
+        cachedArena.m_arenaId = m_id;
+        cachedArena.m_threadArena = threadArena;
+        return threadArena;
+    }
+
+    //=========================================================================
+    // AcquirePage
+    //=========================================================================
+    FrameArenaSchema::Page* FrameArenaSchema::AcquirePage(size_t byteSize)
+    {
+        if (byteSize == m_desc.m_pageSize)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_freePages)
+            {
+                Page* page = m_freePages;
+                m_freePages = page->m_next;
+                page->m_next = nullptr;
+                return page;
+            }
+        }
+
+        void* memory = m_desc.m_pageAllocator->Allocate(byteSize, FrameArenaInternal::PageAlignment, 0, "AZ::FrameArenaSchema::Page", __FILE__, __LINE__);
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        m_capacity += byteSize;
+        Page* page = reinterpret_cast<Page*>(memory);
+        page->m_next = nullptr;
+        page->m_size = byteSize;
+        return page;
+    }
+
+    //=========================================================================
+    // ReleasePage
+    //=========================================================================
+    void FrameArenaSchema::ReleasePage(Page* page)
+    {
+        m_capacity -= page->m_size;
+        m_desc.m_pageAllocator->DeAllocate(page, page->m_size, FrameArenaInternal::PageAlignment);
+    }
+
+    //=========================================================================
+    // AllocateFromNewPage
+    //=========================================================================
+    char* FrameArenaSchema::AllocateFromNewPage(ThreadArena* arena, size_t byteSize, size_t alignment)
+    {
+        size_t requiredSize = sizeof(Page) + byteSize + alignment - 1;
+        if (requiredSize > m_desc.m_pageSize)
+        {
+            // Large allocations get a page of their own, the current page can still be used by the next allocations.
+            Page* page = AcquirePage(requiredSize);
+            if (page == nullptr)
+            {
+                return nullptr;
+            }
+            page->m_next = arena->m_oversizePages;
+            arena->m_oversizePages = page;
+            arena->m_lastAllocation = nullptr;
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+            return AZ::PointerAlignUp(page->Begin(), alignment);
+        }
+
+        Page* page = AcquirePage(m_desc.m_pageSize);
+        if (page == nullptr)
+        {
+            return nullptr;
+        }
+        page->m_next = arena->m_pages;
+        arena->m_pages = page;
+
+        char* address = AZ::PointerAlignUp(page->Begin(), alignment);
+        arena->m_current = address + byteSize;
+        arena->m_end = page->End();
+        arena->m_lastAllocation = address;
+        arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+} // namespace AZ
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena schema
+     * Linear allocator for scratch memory that only lives until the end of the frame. Every thread bumps a pointer
+     * in pages of its own, so allocations don't take locks, and all memory of the frame is released at once with
+     * ResetFrame. DeAllocate only gives back the most recent allocation of the calling thread, all other memory is
+     * kept until the reset. The pages are kept for the next frame, so after a few frames the arena doesn't allocate
+     * at all and Capacity reports the high-water mark of the frames.
+     * IMPORTANT: ResetFrame must be called while no thread is allocating, and memory of the arena must not be used after it.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        struct Descriptor
+        {
+            Descriptor()
+                : m_pageSize(64 * 1024)
+                , m_pageAllocator(nullptr)
+            {}
+            size_t              m_pageSize;         ///< Size of the pages the threads allocate from, larger allocations get a page of their own.
+            IAllocatorAllocate* m_pageAllocator;    ///< If you provide this interface we will use it for page allocations, otherwise SystemAllocator will be used.
+        };
+
+        FrameArenaSchema(const Descriptor& desc = Descriptor());
+        ~FrameArenaSchema() override;
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation of the calling thread can be resized.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        /// Only the most recent allocation of the calling thread can be reallocated, in place.
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        /// The arena doesn't track the size of allocations, always returns 0.
+        size_type AllocationSize(pointer_type ptr) override;
+
+        /// Returns the pages that are not used by the current frame to the page allocator.
+        void GarbageCollect() override;
+
+        /// Bytes allocated in the current frame.
+        size_type NumAllocatedBytes() const override;
+        /// Bytes of all pages held by the arena.
+        size_type Capacity() const override;
+        /// Large allocations get a page of their own, so the limit is the one of the page allocator.
+        size_type GetMaxAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        /// Releases all allocations of the frame, the pages are kept for the next frame.
+        void ResetFrame();
+        /// Returns the largest number of bytes allocated in a single frame.
+        size_type GetPeakFrameBytes() const;
+
+    private:
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        struct Page;
+        struct ThreadArena;
+
+        ThreadArena* GetThreadArena();
+        Page* AcquirePage(size_t byteSize);
+        void ReleasePage(Page* page);
+        char* AllocateFromNewPage(ThreadArena* arena, size_t byteSize, size_t alignment);
+
+        Descriptor m_desc;
+        AZ::u64 m_id;                                   ///< Unique id of the arena, to find the thread arenas in thread local storage.
+        mutable AZStd::mutex m_mutex;                   ///< Guards the thread arenas list and the free pages.
+        ThreadArena* m_threadArenas = nullptr;
+        Page* m_freePages = nullptr;
+        AZStd::atomic<size_t> m_capacity{ 0 };
+        size_t m_peakFrameBytes = 0;
+    };
+} // namespace AZ
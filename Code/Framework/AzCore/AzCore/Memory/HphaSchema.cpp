@@ -10,8 +10,11 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/spin_mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
 #ifdef _DEBUG
@@ -467,6 +470,68 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // the thread caches are per thread magazines of free small blocks in front of the buckets
+        // allocations and frees of the cached sizes are served from the magazine of the calling thread without taking
+        // the bucket lock, the magazines are refilled from and flushed to the buckets in batches
+        static const size_t THREAD_CACHE_MAX_ELEM_SIZE = 256UL;
+        static const size_t THREAD_CACHE_NUM_BUCKETS = THREAD_CACHE_MAX_ELEM_SIZE / MIN_ALLOCATION;
+        // every magazine holds up to THREAD_CACHE_BUCKET_BYTES, which bounds a thread cache to 32KB
+        static const size_t THREAD_CACHE_BUCKET_BYTES = 1024UL;
+        static const unsigned THREAD_CACHE_MIN_BUCKET_COUNT = 4;
+        static const unsigned THREAD_CACHE_MAX_BUCKET_COUNT = 64;
+        // number of allocators a thread keeps caches for, allocators beyond that use the buckets directly
+        static const unsigned MAX_THREAD_CACHES = 4;
+
+        // must stay trivially constructible and destructible, it lives in thread local storage
+        struct thread_cache
+        {
+            HpAllocator*                    mOwner;
+            thread_cache*                   mNext;      // next cache of the owner, guarded by thread_cache_mutex()
+            AZStd::native_thread_id_type    mThreadId;
+            free_link*                      mBlocks[THREAD_CACHE_NUM_BUCKETS];
+            unsigned short                  mCounts[THREAD_CACHE_NUM_BUCKETS];
+            // only written by the owning thread, atomic so the statistics can be read from other threads
+            AZStd::atomic<size_t>           mCachedBytes;
+            AZStd::atomic<AZ::u64>          mNumHits;
+            AZStd::atomic<AZ::u64>          mNumMisses;
+        };
+        struct thread_cache_set
+        {
+            thread_cache    mCaches[MAX_THREAD_CACHES];
+            bool            mIsReleased;    // the thread is exiting, don't cache for the rest of its lifetime
+        };
+        // returns the caches to their allocators when the thread exits
+        struct thread_cache_exit_hook
+        {
+            ~thread_cache_exit_hook();
+        };
+        static thread_cache_set& thread_caches();
+        static AZStd::spin_mutex& thread_cache_mutex();
+        static unsigned thread_cache_capacity(unsigned bi);
+        inline thread_cache* get_thread_cache()
+        {
+            thread_cache_set& caches = thread_caches();
+            for (thread_cache& cache : caches.mCaches)
+            {
+                if (cache.mOwner == this)
+                {
+                    return &cache;
+                }
+            }
+            return thread_cache_attach(caches);
+        }
+        thread_cache* thread_cache_attach(thread_cache_set& caches);
+        void* thread_cache_alloc(thread_cache* cache, unsigned bi);
+        void thread_cache_free(thread_cache* cache, unsigned bi, void* ptr);
+        void thread_cache_flush(thread_cache* cache, unsigned bi, unsigned count);
+        // flushes all magazines of the cache and detaches it, requires thread_cache_mutex()
+        void thread_cache_release(thread_cache* cache);
+        void thread_cache_release_all();
+        size_t thread_cache_cached_bytes() const;
+
+        thread_cache* mThreadCaches = nullptr;  // caches of all threads using this allocator, guarded by thread_cache_mutex()
+        bool m_isThreadCache;
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -1046,6 +1111,8 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Only the cache of the calling thread can be returned safely, other threads flush theirs when they exit
+            thread_cache_flush_current();
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1062,7 +1129,8 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            // blocks held by the thread caches are free for the user, even though the buckets account them as allocated
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_cached_bytes();
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1070,6 +1138,11 @@ namespace AZ {
         size_t  GetMaxAllocationSize() const;
         size_t  GetUnAllocatedMemory(bool isPrint) const;
 
+        /// returns the free blocks cached by the calling thread to the buckets.
+        void    thread_cache_flush_current();
+        /// fills up to maxStats entries with the statistics of the thread caches and returns the number of caches.
+        size_t  GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_t maxStats) const;
+
         void*   SystemAlloc(size_t size, size_t align);
         void    SystemFree(void* ptr);
 
@@ -1149,6 +1222,7 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        m_isThreadCache = desc.m_isThreadCacheAllocations;
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1179,7 +1253,8 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+        thread_cache_release_all();
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1370,6 +1445,13 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (m_isThreadCache && bi < THREAD_CACHE_NUM_BUCKETS)
+        {
+            if (thread_cache* cache = get_thread_cache())
+            {
+                return thread_cache_alloc(cache, bi);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1437,6 +1519,13 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+        if (m_isThreadCache && bi < THREAD_CACHE_NUM_BUCKETS)
+        {
+            if (thread_cache* cache = get_thread_cache())
+            {
+                return thread_cache_free(cache, bi, ptr);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1455,6 +1544,13 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+        if (m_isThreadCache && bi < THREAD_CACHE_NUM_BUCKETS)
+        {
+            if (thread_cache* cache = get_thread_cache())
+            {
+                return thread_cache_free(cache, bi, ptr);
+            }
+        }
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1569,6 +1665,248 @@ namespace AZ {
         }
     }
 
+    HpAllocator::thread_cache_set& HpAllocator::thread_caches()
+    {
+        // zero initialized, so it can be used at any point of the thread's lifetime without a construction guard
+        static thread_local thread_cache_set s_caches;
+        return s_caches;
+    }
+
+    AZStd::spin_mutex& HpAllocator::thread_cache_mutex()
+    {
+        // shared by all allocators as threads can exit while an allocator is destroyed, it's only taken when a thread
+        // attaches or releases its caches, when an allocator is destroyed and when the statistics are gathered
+        static AZStd::spin_mutex s_mutex;
+        return s_mutex;
+    }
+
+    HpAllocator::thread_cache_exit_hook::~thread_cache_exit_hook()
+    {
+        thread_cache_set& caches = thread_caches();
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        caches.mIsReleased = true;
+        for (thread_cache& cache : caches.mCaches)
+        {
+            if (cache.mOwner)
+            {
+                cache.mOwner->thread_cache_release(&cache);
+            }
+        }
+    }
+
+    unsigned HpAllocator::thread_cache_capacity(unsigned bi)
+    {
+        const size_t elemCount = THREAD_CACHE_BUCKET_BYTES / bucket_spacing_function_inverse(bi);
+        return AZStd::GetMin(AZStd::GetMax(static_cast<unsigned>(elemCount), THREAD_CACHE_MIN_BUCKET_COUNT), THREAD_CACHE_MAX_BUCKET_COUNT);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_attach(thread_cache_set& caches)
+    {
+        if (caches.mIsReleased)
+        {
+            return nullptr;
+        }
+        for (thread_cache& cache : caches.mCaches)
+        {
+            if (cache.mOwner == nullptr)
+            {
+                // make sure the caches are returned when the thread exits
+                static thread_local thread_cache_exit_hook s_exitHook;
+                (void)s_exitHook;
+
+                AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+                cache.mOwner = this;
+                cache.mThreadId = AZStd::this_thread::get_id().m_id;
+                cache.mNumHits.store(0, AZStd::memory_order_relaxed);
+                cache.mNumMisses.store(0, AZStd::memory_order_relaxed);
+                cache.mNext = mThreadCaches;
+                mThreadCaches = &cache;
+                return &cache;
+            }
+        }
+        // all caches of this thread are in use by other allocators
+        return nullptr;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache* cache, unsigned bi)
+    {
+        if (free_link* block = cache->mBlocks[bi])
+        {
+            cache->mBlocks[bi] = block->mNext;
+            --cache->mCounts[bi];
+            cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+            cache->mNumHits.store(cache->mNumHits.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+            return block;
+        }
+
+        cache->mNumMisses.store(cache->mNumMisses.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+
+        // refill half of the magazine with a single lock, the first block is returned
+        const unsigned refillCount = AZStd::GetMax(thread_cache_capacity(bi) / 2, 1U);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        void* result = nullptr;
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        for (unsigned i = 0; i < refillCount; ++i)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                p = bucket_grow(elemSize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            mTotalAllocatedSizeBuckets += elemSize;
+            void* block = mBuckets[bi].alloc(p);
+            if (!result)
+            {
+                result = block;
+            }
+            else
+            {
+                free_link* lnk = (free_link*)block;
+                lnk->mNext = cache->mBlocks[bi];
+                cache->mBlocks[bi] = lnk;
+                ++cache->mCounts[bi];
+                cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) + elemSize, AZStd::memory_order_relaxed);
+            }
+        }
+        return result;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache* cache, unsigned bi, void* ptr)
+    {
+        const unsigned capacity = thread_cache_capacity(bi);
+        if (cache->mCounts[bi] >= capacity)
+        {
+            // keep half of the magazine, so alternating frees and allocations don't flush and refill every time
+            thread_cache_flush(cache, bi, capacity - capacity / 2);
+        }
+        free_link* lnk = (free_link*)ptr;
+        lnk->mNext = cache->mBlocks[bi];
+        cache->mBlocks[bi] = lnk;
+        ++cache->mCounts[bi];
+        cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache* cache, unsigned bi, unsigned count)
+    {
+        HPPA_ASSERT(count <= cache->mCounts[bi]);
+        if (count == 0)
+        {
+            return;
+        }
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        free_link* lnk = cache->mBlocks[bi];
+        for (unsigned i = 0; i < count; ++i)
+        {
+            free_link* next = lnk->mNext;
+            mTotalAllocatedSizeBuckets -= elemSize;
+            mBuckets[bi].free(ptr_get_page(lnk), lnk);
+            lnk = next;
+        }
+        cache->mBlocks[bi] = lnk;
+        cache->mCounts[bi] = static_cast<unsigned short>(cache->mCounts[bi] - count);
+        cache->mCachedBytes.store(cache->mCachedBytes.load(AZStd::memory_order_relaxed) - count * elemSize, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache* cache)
+    {
+        HPPA_ASSERT(cache->mOwner == this);
+        for (unsigned bi = 0; bi < THREAD_CACHE_NUM_BUCKETS; ++bi)
+        {
+            thread_cache_flush(cache, bi, cache->mCounts[bi]);
+        }
+        for (thread_cache** link = &mThreadCaches; *link; link = &(*link)->mNext)
+        {
+            if (*link == cache)
+            {
+                *link = cache->mNext;
+                break;
+            }
+        }
+        cache->mNext = nullptr;
+        cache->mOwner = nullptr;
+    }
+
+    void HpAllocator::thread_cache_release_all()
+    {
+        // the allocator is destroyed, the threads that are still running will attach a new cache if they use an
+        // allocator at the same address again
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        while (mThreadCaches)
+        {
+            thread_cache_release(mThreadCaches);
+        }
+    }
+
+    void HpAllocator::thread_cache_flush_current()
+    {
+        if (!m_isThreadCache)
+        {
+            return;
+        }
+        for (thread_cache& cache : thread_caches().mCaches)
+        {
+            if (cache.mOwner == this)
+            {
+                for (unsigned bi = 0; bi < THREAD_CACHE_NUM_BUCKETS; ++bi)
+                {
+                    thread_cache_flush(&cache, bi, cache.mCounts[bi]);
+                }
+                break;
+            }
+        }
+    }
+
+    size_t HpAllocator::thread_cache_cached_bytes() const
+    {
+        if (!m_isThreadCache)
+        {
+            return 0;
+        }
+        size_t cachedBytes = 0;
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            cachedBytes += cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return cachedBytes;
+    }
+
+    size_t HpAllocator::GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_t maxStats) const
+    {
+        size_t numCaches = 0;
+        AZStd::lock_guard<AZStd::spin_mutex> lock(thread_cache_mutex());
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext, ++numCaches)
+        {
+            if (numCaches < maxStats)
+            {
+                AllocatorThreadCacheStats& stats = outStats[numCaches];
+                stats.m_threadId = AZStd::thread_id(cache->mThreadId);
+                stats.m_numHits = cache->mNumHits.load(AZStd::memory_order_relaxed);
+                stats.m_numMisses = cache->mNumMisses.load(AZStd::memory_order_relaxed);
+                stats.m_cachedBytes = cache->mCachedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return numCaches;
+    }
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -2695,6 +3033,15 @@ namespace AZ {
     {
         m_allocator->purge();
     }
+
+    //=========================================================================
+    // GetThreadCacheStats
+    //=========================================================================
+    HphaSchema::size_type
+    HphaSchema::GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const
+    {
+        return m_allocator->GetThreadCacheStats(outStats, maxStats);
+    }
         
     size_t
     HphaSchema::Capacity() const
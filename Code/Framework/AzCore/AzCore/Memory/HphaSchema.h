@@ -38,6 +38,7 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCacheAllocations(false)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -49,6 +50,7 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCacheAllocations;             ///< True to serve small pool allocations from a cache per thread (bounded to 32KB per thread) before taking the pool locks.
         };
 
 
@@ -67,6 +69,7 @@ namespace AZ
         virtual size_type       GetMaxAllocationSize() const;
         virtual size_type       GetUnAllocatedMemory(bool isPrint = false) const;
         virtual IAllocatorAllocate* GetSubAllocator()                       { return m_desc.m_subAllocator; }
+        virtual size_type       GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const;
 
         /// Return unused memory to the OS (if we don't use fixed block). Don't call this unless you really need free memory, it is slow.
         virtual void            GarbageCollect();
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/std/parallel/config.h>
 
 namespace AZ
 {
@@ -27,6 +28,17 @@ namespace AZ
 
     class AllocatorManager;
 
+    /**
+     * Statistics of a cache an allocation scheme keeps per thread in front of its shared pools.
+     */
+    struct AllocatorThreadCacheStats
+    {
+        AZStd::thread_id    m_threadId;         ///< Thread that owns the cache.
+        AZ::u64             m_numHits = 0;      ///< Allocations served from the cache.
+        AZ::u64             m_numMisses = 0;    ///< Allocations that had to refill the cache from the shared pools.
+        size_t              m_cachedBytes = 0;  ///< Free memory currently held by the cache.
+    };
+
     /**
      * Allocator alloc/free basic interface. It is separate because it can be used
      * for user provided allocators overrides
@@ -70,6 +82,8 @@ namespace AZ
         virtual size_type               GetUnAllocatedMemory(bool isPrint = false) const { (void)isPrint; return 0; }
         /// Returns a pointer to a sub-allocator or NULL.
         virtual IAllocatorAllocate*     GetSubAllocator() = 0;
+        /// Fills outStats with up to maxStats entries and returns the number of thread caches, 0 if the schema doesn't cache per thread.
+        virtual size_type               GetThreadCacheStats(AllocatorThreadCacheStats* outStats, size_type maxStats) const { (void)outStats; (void)maxStats; return 0; }
     };
 
     /**
@@ -36,9 +36,11 @@ namespace AZ
         void NameData::release()
         {
             AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
+            // Once our reference is gone another thread may remove and free this entry at any time
+            const Hash hash = m_hash;
             if (m_useCount.fetch_sub(1) == 1)
             {
-                AZ::NameDictionary::Instance().TryReleaseName(this);
+                AZ::NameDictionary::Instance().TryReleaseName(this, hash);
             }
         }
     }
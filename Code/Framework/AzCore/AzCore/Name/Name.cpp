@@ -32,8 +32,8 @@ namespace AZ
         *this = NameDictionary::Instance().FindName(hash);
     }
 
-    Name::Name(Internal::NameData* data)
-        : m_data{data}
+    Name::Name(Internal::NameData* data, bool addRef)
+        : m_data{data, addRef}
         , m_view{data->GetName()}
         , m_hash{data->GetHash()}
     {}
@@ -88,6 +88,15 @@ namespace AZ
             return m_hash;
         }
 
+        //! Calculates the hash of a string the way the NameDictionary does, before any hash collision is resolved.
+        //! This can be evaluated at compile time, see AZ_NAME_LITERAL.
+        static constexpr Hash ComputeHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
     private:
         
         // Assigns a new name.  
@@ -99,7 +108,8 @@ namespace AZ
         void SetEmptyString();
         
         // This constructor is used by NameDictionary to construct from a dictionary-held NameData instance.
-        Name(Internal::NameData* nameData);
+        // addRef is false when the dictionary already took the reference for this Name.
+        Name(Internal::NameData* nameData, bool addRef = true);
 
         static void ScriptConstructor(Name* thisPtr, ScriptDataContext& dc);
 
@@ -7,6 +7,7 @@
 
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/Name/NameLiteral.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
@@ -75,18 +76,154 @@ namespace AZ
         return *(*s_instance);
     }
     
+    NameDictionary::HashTable::HashTable(size_t capacity)
+        : m_mask(capacity - 1)
+    {
+        AZ_Assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "NameDictionary table capacity must be a power of two");
+        m_slots = reinterpret_cast<AZStd::atomic<Internal::NameData*>*>(
+            azmalloc(sizeof(AZStd::atomic<Internal::NameData*>) * capacity, alignof(AZStd::atomic<Internal::NameData*>), AZ::OSAllocator, "NameDictionary"));
+        for (size_t i = 0; i < capacity; ++i)
+        {
+            new (&m_slots[i]) AZStd::atomic<Internal::NameData*>(nullptr);
+        }
+    }
+
+    NameDictionary::HashTable::~HashTable()
+    {
+        azfree(m_slots, AZ::OSAllocator);
+    }
+
+    Internal::NameData* NameDictionary::HashTable::Find(Name::Hash hash) const
+    {
+        for (size_t i = hash & m_mask, probes = 0; probes <= m_mask; i = (i + 1) & m_mask, ++probes)
+        {
+            Internal::NameData* data = m_slots[i].load(AZStd::memory_order_acquire);
+            if (!data)
+            {
+                return nullptr;
+            }
+            if (data != GetTombstone() && data->m_hash == hash)
+            {
+                return data;
+            }
+        }
+        return nullptr;
+    }
+
+    bool NameDictionary::HashTable::Contains(Internal::NameData* data, Name::Hash hash) const
+    {
+        // Only compares pointers, the data may already have been freed if it isn't in the table
+        for (size_t i = hash & m_mask, probes = 0; probes <= m_mask; i = (i + 1) & m_mask, ++probes)
+        {
+            Internal::NameData* slot = m_slots[i].load(AZStd::memory_order_relaxed);
+            if (!slot)
+            {
+                return false;
+            }
+            if (slot == data)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool NameDictionary::HashTable::NeedsRebuild() const
+    {
+        // Keep the table at most half full, counting tombstones, so probe sequences stay short and always end
+        return (m_entryCount + m_tombstoneCount + 1) * 2 > GetCapacity();
+    }
+
+    void NameDictionary::HashTable::Insert(Internal::NameData* data)
+    {
+        for (size_t i = data->m_hash & m_mask;; i = (i + 1) & m_mask)
+        {
+            Internal::NameData* slot = m_slots[i].load(AZStd::memory_order_relaxed);
+            if (!slot || slot == GetTombstone())
+            {
+                if (slot)
+                {
+                    --m_tombstoneCount;
+                }
+                ++m_entryCount;
+                // Publishes the fully constructed entry to lock-free readers
+                m_slots[i].store(data, AZStd::memory_order_release);
+                return;
+            }
+        }
+    }
+
+    void NameDictionary::HashTable::Remove(Internal::NameData* data)
+    {
+        for (size_t i = data->m_hash & m_mask, probes = 0; probes <= m_mask; i = (i + 1) & m_mask, ++probes)
+        {
+            Internal::NameData* slot = m_slots[i].load(AZStd::memory_order_relaxed);
+            if (slot == data)
+            {
+                // A tombstone instead of an empty slot, so probe sequences that pass through here continue
+                m_slots[i].store(GetTombstone(), AZStd::memory_order_release);
+                --m_entryCount;
+                ++m_tombstoneCount;
+                return;
+            }
+            if (!slot)
+            {
+                break;
+            }
+        }
+        AZ_Assert(false, "NameData is not in the dictionary");
+    }
+
+    NameDictionary::ReadScope::ReadScope(const NameDictionary& dictionary)
+    {
+        // Each thread sticks to one stripe of reader counters
+        static AZStd::atomic<AZ::u32> s_nextReaderStripe{0};
+        static AZ_THREAD_LOCAL AZ::u32 s_readerStripe = ~0u;
+        if (s_readerStripe == ~0u)
+        {
+            s_readerStripe = s_nextReaderStripe.fetch_add(1, AZStd::memory_order_relaxed) % ReaderStripeCount;
+        }
+
+        while (true)
+        {
+            const AZ::u32 epoch = dictionary.m_epoch.load(AZStd::memory_order_seq_cst);
+            m_readerCount = &dictionary.m_readerCounts[epoch & 1][s_readerStripe].m_count;
+            m_readerCount->fetch_add(1, AZStd::memory_order_seq_cst);
+
+            // If the epoch changed before we were counted the writer may not have seen us, so count ourselves in the new epoch
+            if (dictionary.m_epoch.load(AZStd::memory_order_seq_cst) == epoch)
+            {
+                return;
+            }
+            m_readerCount->fetch_sub(1, AZStd::memory_order_release);
+        }
+    }
+
+    NameDictionary::ReadScope::~ReadScope()
+    {
+        m_readerCount->fetch_sub(1, AZStd::memory_order_release);
+    }
+
     NameDictionary::NameDictionary()
-    {}
+    {
+        m_table.store(aznew HashTable(InitialCapacity), AZStd::memory_order_release);
+    }
 
     NameDictionary::~NameDictionary()
     {
+        // Literals hold on to their entries until they are unbound, release them before looking for leaks
+        while (m_boundLiterals)
+        {
+            UnbindLiteral(*m_boundLiterals);
+        }
+
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        HashTable* table = m_table.load(AZStd::memory_order_acquire);
+        table->ForEachEntry([&leaksDetected](Internal::NameData* nameData)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
+            const int useCount = nameData->m_useCount;
+            const bool hadCollision = nameData->m_hashCollision;
 
             if (useCount == 0)
             {
@@ -97,25 +234,49 @@ namespace AZ
             else
             {
                 leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, nameData->GetHash(), AZ_STRING_ARG(nameData->GetName()));
             }
-        }
+        });
+        delete table;
+
+        // There are no readers left, everything retired can be freed
+        FreeRetired(m_retired);
+        FreeRetired(m_retiredBeforeEpoch);
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    bool NameDictionary::TryAcquireName(Internal::NameData* data)
+    {
+        // A use count of -1 means the entry is being removed, it must not be brought back to life
+        int useCount = data->m_useCount.load(AZStd::memory_order_relaxed);
+        do
+        {
+            if (useCount < 0)
+            {
+                return false;
+            }
+        } while (!data->m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acq_rel, AZStd::memory_order_relaxed));
+        return true;
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        ReadScope readScope(*this);
+        Internal::NameData* data = m_table.load(AZStd::memory_order_acquire)->Find(hash);
+        if (data && TryAcquireName(data))
         {
-            return Name(iter->second);
+            return Name(data, false);
         }
         return Name();
     }
 
     Name NameDictionary::MakeName(AZStd::string_view nameString)
+    {
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
     {
         // Null strings should return empty.
         if (nameString.empty())
@@ -123,49 +284,52 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
-
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        // This path is faster than the loop below because it doesn't take any lock whereas the
+        // loop requires m_writeMutex to modify the dictionary.
         {
-            return AZStd::move(name);
+            ReadScope readScope(*this);
+            Internal::NameData* data = m_table.load(AZStd::memory_order_acquire)->Find(hash);
+            if (data && data->GetName() == nameString && TryAcquireName(data))
+            {
+                return Name(data, false);
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
 
-        auto iter = m_dictionary.find(hash);
+        // Entries in the table can't be removed while we hold the lock, so they can be used without TryAcquireName
+        HashTable* table = m_table.load(AZStd::memory_order_relaxed);
+        Internal::NameData* data = table->Find(hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (!data)
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                ReserveEntry()->Insert(nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
-            else if (iter->second->GetName() == nameString)
+            else if (data->GetName() == nameString)
             {
-                return Name(iter->second);
+                return Name(data);
             }
             // Hash collision, try a new hash
             else
             {
                 collisionDetected = true;
-                iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
+                data->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
+                data = table->Find(hash);
             }
         }
     }
 
-    void NameDictionary::TryReleaseName(Internal::NameData* nameData)
+    void NameDictionary::TryReleaseName(Internal::NameData* nameData, Name::Hash hash)
     {
         // Note that we don't remove NameData from the dictionary if it has been involved in a collision.
         // This avoids specific edge cases where a Name object could get an incorrect hash value. Consider
@@ -178,15 +342,17 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
-        // Early exit to avoid locking the mutex unnecessarily.
-        if (nameData->m_hashCollision)
+        AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
+
+        // Another thread may have taken and released a reference since our last reference was dropped, and
+        // already removed the entry. Only entries still in the table are guaranteed to not have been freed.
+        HashTable* table = m_table.load(AZStd::memory_order_relaxed);
+        if (!table->Contains(nameData, hash))
         {
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+        // Check m_hashCollision inside m_writeMutex because a new collision could have happened
         // on another thread before taking the lock.
         if (nameData->m_hashCollision)
         {
@@ -195,18 +361,160 @@ namespace AZ
 
         // We need to check the count again in here in case
         // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
+        // Set it to -1 so lock-free lookups can't take a new reference,
+        // and only this thread will attempt to clean up the dictionary.
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            table->Remove(nameData);
+            // Lock-free lookups may still be looking at the entry, it's freed once they're done
+            m_retired.m_names.push_back(nameData);
+            ReclaimRetired();
         }
 
         ReportStats();
     }
 
+    NameDictionary::HashTable* NameDictionary::ReserveEntry()
+    {
+        HashTable* table = m_table.load(AZStd::memory_order_relaxed);
+        if (!table->NeedsRebuild())
+        {
+            return table;
+        }
+
+        // Grow when at least a quarter full, otherwise the table is full of tombstones and rebuilding it at the same size cleans them up
+        const size_t capacity = (table->GetEntryCount() + 1) * 4 > table->GetCapacity() ? table->GetCapacity() * 2 : table->GetCapacity();
+        HashTable* newTable = aznew HashTable(capacity);
+        table->ForEachEntry([newTable](Internal::NameData* nameData)
+        {
+            newTable->Insert(nameData);
+        });
+        m_table.store(newTable, AZStd::memory_order_release);
+
+        m_retired.m_tables.push_back(table);
+        ReclaimRetired();
+        return newTable;
+    }
+
+    void NameDictionary::ReclaimRetired()
+    {
+        const AZ::u32 previousParity = (m_epoch.load(AZStd::memory_order_relaxed) + 1) & 1;
+        if (HasReaders(previousParity))
+        {
+            // Lookups that started before the last epoch change are still running, try again on the next removal
+            return;
+        }
+
+        // Everything retired before the last epoch change can't be seen by anyone anymore
+        FreeRetired(m_retiredBeforeEpoch);
+
+        if (!m_retired.m_names.empty() || !m_retired.m_tables.empty())
+        {
+            // New lookups count themselves in the other parity, which has no readers left, so once the current
+            // parity drains nobody can see the entries retired so far.
+            m_epoch.fetch_add(1, AZStd::memory_order_seq_cst);
+            AZStd::swap(m_retired, m_retiredBeforeEpoch);
+        }
+    }
+
+    bool NameDictionary::HasReaders(AZ::u32 parity) const
+    {
+        for (const ReaderCount& readerCount : m_readerCounts[parity])
+        {
+            if (readerCount.m_count.load(AZStd::memory_order_seq_cst) != 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void NameDictionary::FreeRetired(RetiredList& retired)
+    {
+        for (Internal::NameData* nameData : retired.m_names)
+        {
+            delete nameData;
+        }
+        for (HashTable* table : retired.m_tables)
+        {
+            delete table;
+        }
+        retired.m_names.clear();
+        retired.m_tables.clear();
+    }
+
+    void NameDictionary::BindLiteral(const NameLiteral& literal)
+    {
+        // Declared before the lock, so that if another thread bound the literal first, our reference is released after unlocking
+        Name name = MakeName(literal.m_literal, literal.m_hash);
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
+        if (literal.m_isBound.load(AZStd::memory_order_relaxed))
+        {
+            return;
+        }
+
+        literal.m_name = AZStd::move(name);
+        literal.m_previousBound = nullptr;
+        literal.m_nextBound = m_boundLiterals;
+        if (m_boundLiterals)
+        {
+            m_boundLiterals->m_previousBound = &literal;
+        }
+        m_boundLiterals = &literal;
+        literal.m_isBound.store(true, AZStd::memory_order_release);
+    }
+
+    void NameDictionary::UnbindLiteral(const NameLiteral& literal)
+    {
+        // Moved out of the literal and released after unlocking, releasing the last reference takes the lock
+        Name name;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
+            if (!literal.m_isBound.load(AZStd::memory_order_relaxed))
+            {
+                return;
+            }
+
+            if (literal.m_previousBound)
+            {
+                literal.m_previousBound->m_nextBound = literal.m_nextBound;
+            }
+            else
+            {
+                m_boundLiterals = literal.m_nextBound;
+            }
+            if (literal.m_nextBound)
+            {
+                literal.m_nextBound->m_previousBound = literal.m_previousBound;
+            }
+            literal.m_previousBound = nullptr;
+            literal.m_nextBound = nullptr;
+            literal.m_isBound.store(false, AZStd::memory_order_release);
+            name = AZStd::move(literal.m_name);
+        }
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
+        return m_table.load(AZStd::memory_order_relaxed)->GetEntryCount();
+    }
+
+    AZStd::vector<Internal::NameData*> NameDictionary::GetEntries() const
+    {
+        AZStd::vector<Internal::NameData*> entries;
+        AZStd::lock_guard<AZStd::mutex> lock(m_writeMutex);
+        const HashTable* table = m_table.load(AZStd::memory_order_relaxed);
+        entries.reserve(table->GetEntryCount());
+        table->ForEachEntry([&entries](Internal::NameData* nameData)
+        {
+            entries.push_back(nameData);
+        });
+        return entries;
+    }
+
     void NameDictionary::ReportStats() const
     {
 #ifdef AZ_DEBUG_BUILD
@@ -222,34 +530,35 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            const HashTable* table = m_table.load(AZStd::memory_order_relaxed);
+            table->ForEachEntry([&](Internal::NameData* nameData)
             {
-                const size_t nameLength = iter.second->m_name.size();
+                const size_t nameLength = nameData->m_name.size();
                 actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                potentialStringMemoryUsed += (nameLength * nameData->m_useCount);
 
                 if (!longestName || longestName->m_name.size() < nameLength)
                 {
-                    longestName = iter.second;
+                    longestName = nameData;
                 }
 
                 if (!mostRepeatedName)
                 {
-                    mostRepeatedName = iter.second;
+                    mostRepeatedName = nameData;
                 }
                 else
                 {
                     const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (nameData->m_useCount - 1);
                     if (currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = nameData;
                     }
                 }
-            }
+            });
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", table->GetEntryCount());
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -274,9 +583,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Name::ComputeHash(name);
     }
 }
@@ -7,10 +7,11 @@
 
 #pragma once
 
-#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
-#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -28,6 +29,7 @@ namespace UnitTest
 namespace AZ
 {
     class Module;
+    class NameLiteral;
 
     namespace Internal
     {
@@ -42,6 +44,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! Looking up existing names takes no locks. Entries are kept in an open addressing hash table that
+    //! is only modified while holding a mutex, and removed entries (and replaced tables) are only freed
+    //! once every lookup that could still see them has finished. Lookups announce themselves on one of a
+    //! few striped counters, so concurrent lookups from different threads don't contend on a cache line.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -49,6 +56,7 @@ namespace AZ
         friend Module;
         friend Name;
         friend Internal::NameData;
+        friend NameLiteral;
         friend UnitTest::NameDictionaryTester;
         
     public:
@@ -77,20 +85,132 @@ namespace AZ
 
         void ReportStats() const;
 
+        // Makes a Name with a hash that was already calculated with CalcHash (or at compile time by a NameLiteral)
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
+        //////////////////////////////////////////////////////////////////////////
+        // Private API for NameLiteral
+
+        // Binds the literal to its entry, unless another thread did so already.
+        void BindLiteral(const NameLiteral& literal);
+
+        // Releases the literal's entry, the literal binds again on its next use.
+        void UnbindLiteral(const NameLiteral& literal);
+
+        //////////////////////////////////////////////////////////////////////////
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
         // Attempts to release the name from the dictionary, but checks to make sure
-        // a reference wasn't taken by another thread.
-        void TryReleaseName(Internal::NameData* data);
+        // a reference wasn't taken by another thread. The hash must be read before the
+        // last reference is dropped, the data may have been removed by another thread
+        // by the time this is called, so it isn't dereferenced unless it's still in the dictionary.
+        void TryReleaseName(Internal::NameData* data, Name::Hash hash);
         
         //////////////////////////////////////////////////////////////////////////
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+
+        // Takes a reference on an entry found without holding the lock, fails if the entry is being removed.
+        static bool TryAcquireName(Internal::NameData* data);
+
+        // Returns the number of entries and a copy of them, for tests and stats.
+        size_t GetEntryCount() const;
+        AZStd::vector<Internal::NameData*> GetEntries() const;
+
+        // Open addressing hash table with linear probing, keyed by the name hash.
+        // Readers probe it without locks, it is only modified while holding m_writeMutex.
+        class HashTable final
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(HashTable, AZ::OSAllocator, 0);
+
+            explicit HashTable(size_t capacity);
+            ~HashTable();
+
+            HashTable(const HashTable&) = delete;
+            HashTable& operator=(const HashTable&) = delete;
+
+            Internal::NameData* Find(Name::Hash hash) const;
+
+            // The following must only be called while holding m_writeMutex
+            bool Contains(Internal::NameData* data, Name::Hash hash) const;
+            bool NeedsRebuild() const;
+            void Insert(Internal::NameData* data);
+            void Remove(Internal::NameData* data);
+            size_t GetCapacity() const { return m_mask + 1; }
+            size_t GetEntryCount() const { return m_entryCount; }
+
+            template<class Function>
+            void ForEachEntry(Function&& function) const
+            {
+                for (size_t i = 0; i <= m_mask; ++i)
+                {
+                    Internal::NameData* data = m_slots[i].load(AZStd::memory_order_relaxed);
+                    if (data && data != GetTombstone())
+                    {
+                        function(data);
+                    }
+                }
+            }
+
+        private:
+            static Internal::NameData* GetTombstone() { return reinterpret_cast<Internal::NameData*>(static_cast<uintptr_t>(1)); }
+
+            AZStd::atomic<Internal::NameData*>* m_slots = nullptr;
+            size_t m_mask = 0;
+            size_t m_entryCount = 0;
+            size_t m_tombstoneCount = 0;
+        };
+
+        // Registers a lock-free lookup for the lifetime of the scope, see ReclaimRetired.
+        class ReadScope final
+        {
+        public:
+            explicit ReadScope(const NameDictionary& dictionary);
+            ~ReadScope();
+
+        private:
+            AZStd::atomic<AZ::u32>* m_readerCount;
+        };
+
+        // Entries removed and tables replaced since the last epoch change
+        struct RetiredList
+        {
+            AZStd::vector<Internal::NameData*> m_names;
+            AZStd::vector<HashTable*> m_tables;
+        };
+
+        // Makes sure the table has room for one more entry, must be called while holding m_writeMutex.
+        HashTable* ReserveEntry();
+
+        // Frees retired entries once no lookup can see them anymore, must be called while holding m_writeMutex.
+        // Lookups count themselves in the reader counters of the current epoch's parity. Retired entries are held
+        // until the epoch advances and then until every lookup of the old parity has finished.
+        void ReclaimRetired();
+        bool HasReaders(AZ::u32 parity) const;
+        static void FreeRetired(RetiredList& retired);
+
+        static constexpr size_t ReaderStripeCount = 32;
+        static constexpr size_t InitialCapacity = 1024;
+
+        // Pads each counter to a cache line, so lookups on different threads don't share it
+        struct ReaderCount
+        {
+            AZStd::atomic<AZ::u32> m_count{0};
+            char m_padding[64 - sizeof(AZStd::atomic<AZ::u32>)];
+        };
+
+        AZStd::atomic<HashTable*> m_table{nullptr};
+        mutable ReaderCount m_readerCounts[2][ReaderStripeCount];
+        AZStd::atomic<AZ::u32> m_epoch{0};
+
+        mutable AZStd::mutex m_writeMutex;
+        RetiredList m_retired; ///< retired in the current epoch, guarded by m_writeMutex
+        RetiredList m_retiredBeforeEpoch; ///< retired before the last epoch change, guarded by m_writeMutex
+        const NameLiteral* m_boundLiterals = nullptr; ///< list of bound literals, guarded by m_writeMutex
     };
 }
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Name/NameLiteral.h>
+#include <AzCore/Name/NameDictionary.h>
+
+namespace AZ
+{
+    NameLiteral::NameLiteral(AZStd::string_view literal, Name::Hash hash)
+        : m_literal(literal)
+        , m_hash(hash)
+    {
+        AZ_Assert(hash == Name::ComputeHash(literal), "Hash doesn't match the name literal '%.*s'", AZ_STRING_ARG(literal));
+    }
+
+    NameLiteral::~NameLiteral()
+    {
+        // A destroyed dictionary unbinds all literals, so the dictionary is still alive if we are bound
+        if (m_isBound.load(AZStd::memory_order_acquire))
+        {
+            NameDictionary::Instance().UnbindLiteral(*this);
+        }
+    }
+
+    void NameLiteral::Bind() const
+    {
+        AZ_Assert(NameDictionary::IsReady(), "Attempted to use Name literal '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(m_literal));
+        NameDictionary::Instance().BindLiteral(*this);
+    }
+} // namespace AZ
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ * 
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/integral_constant.h>
+
+namespace AZ
+{
+    class NameDictionary;
+
+    //! A Name for a string known at compile time, usually declared with AZ_NAME_LITERAL.
+    //! The hash is computed at compile time. The first use binds the literal to its dictionary entry,
+    //! every later use only checks that it is still bound and returns the cached Name.
+    //!
+    //! A bound literal holds a reference on its entry until the literal is destroyed or the NameDictionary
+    //! is destroyed, whichever comes first. It binds again if it is used with a new dictionary.
+    //! The Name it returns is a regular Name, so it can be compared, hashed and serialized (NameSerializer,
+    //! NameJsonSerializer) like any other, and is equal to a Name created at runtime from the same string.
+    class NameLiteral final
+    {
+        friend NameDictionary;
+    public:
+        //! @param literal A string that outlives this object, usually a string literal.
+        //! @param hash Must be Name::ComputeHash(literal), AZ_NAME_LITERAL computes it at compile time.
+        NameLiteral(AZStd::string_view literal, Name::Hash hash);
+        ~NameLiteral();
+
+        NameLiteral(const NameLiteral&) = delete;
+        NameLiteral& operator=(const NameLiteral&) = delete;
+
+        //! Returns the Name for the literal, binding it to the dictionary on first use.
+        const Name& GetName() const
+        {
+            if (!m_isBound.load(AZStd::memory_order_acquire))
+            {
+                Bind();
+            }
+            return m_name;
+        }
+
+        operator const Name&() const
+        {
+            return GetName();
+        }
+
+        AZStd::string_view GetStringView() const
+        {
+            return m_literal;
+        }
+
+    private:
+        void Bind() const;
+
+        AZStd::string_view m_literal;
+        Name::Hash m_hash; // before hash collisions are resolved, the bound Name's hash may differ
+
+        // Guarded by the dictionary, m_name is only written before m_isBound is set or after it was cleared
+        mutable AZStd::atomic_bool m_isBound{false};
+        mutable Name m_name;
+        mutable const NameLiteral* m_previousBound = nullptr;
+        mutable const NameLiteral* m_nextBound = nullptr;
+    };
+} // namespace AZ
+
+//! Returns a const AZ::Name& for a string literal, hashed at compile time and bound to the NameDictionary
+//! on first use at this call site, so repeated calls don't hash or look up the string.
+//! Example: if (materialProperty.GetName() == AZ_NAME_LITERAL("baseColor")) ...
+#define AZ_NAME_LITERAL(literal)                                                                                            \
+    ([]() -> const AZ::Name&                                                                                                \
+    {                                                                                                                       \
+        static const AZ::NameLiteral s_nameLiteral{ literal,                                                                \
+            AZStd::integral_constant<AZ::Name::Hash, AZ::Name::ComputeHash(literal)>::value };                              \
+        return s_nameLiteral.GetName();                                                                                     \
+    }())
@@ -5,6 +5,8 @@
  *
  */
 
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonDeserializer.h>
@@ -124,15 +126,38 @@ namespace AZ
     JsonDeserializerContext::JsonDeserializerContext(JsonDeserializerSettings& settings)
         : JsonBaseContext(settings.m_metadata, settings.m_reporting,
             StackedString::Format::JsonPointer, settings.m_serializeContext, settings.m_registrationContext)
+        , m_jobContext((settings.m_jobContext || settings.m_parallelLoadThreshold == 0) ? settings.m_jobContext : JobContext::GetGlobalContext())
+        , m_parallelLoadThreshold(settings.m_parallelLoadThreshold)
         , m_clearContainers(settings.m_clearContainers)
     {
     }
 
+    JsonDeserializerContext::JsonDeserializerContext(
+        const JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting)
+        : JsonBaseContext(parent.m_metadata, AZStd::move(reporting), StackedString::Format::JsonPointer,
+            parent.m_serializeContext, parent.m_registrationContext)
+        , m_jobContext(parent.m_jobContext)
+        , m_clearContainers(parent.m_clearContainers)
+    {
+        m_path = parent.m_path;
+    }
+
     bool JsonDeserializerContext::ShouldClearContainers() const
     {
         return m_clearContainers;
     }
 
+    bool JsonDeserializerContext::ShouldLoadInParallel(size_t elementCount) const
+    {
+        return m_parallelLoadThreshold > 0 && elementCount >= m_parallelLoadThreshold && m_jobContext &&
+            m_jobContext->GetJobManager().GetNumWorkerThreads() > 0;
+    }
+
+    JobContext* JsonDeserializerContext::GetJobContext()
+    {
+        return m_jobContext;
+    }
+
 
 
     //
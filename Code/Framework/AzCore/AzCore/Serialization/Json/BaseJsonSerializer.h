@@ -88,6 +88,9 @@ namespace AZ
     {
     public:
         explicit JsonDeserializerContext(JsonDeserializerSettings& settings);
+        //! Creates a context for an element that's loaded in parallel with its siblings. The element context starts at the current
+        //! path of the parent and reports to the provided callback. Elements of the element won't be loaded in parallel.
+        JsonDeserializerContext(const JsonDeserializerContext& parent, JsonSerializationResult::JsonIssueCallback reporting);
         ~JsonDeserializerContext() override = default;
 
         JsonDeserializerContext(const JsonDeserializerContext&) = delete;
@@ -100,7 +103,14 @@ namespace AZ
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool ShouldClearContainers() const;
 
+        //! Returns true if a container with the provided number of elements should load its elements in parallel.
+        bool ShouldLoadInParallel(size_t elementCount) const;
+        //! The job context used to load elements in parallel.
+        JobContext* GetJobContext();
+
     private:
+        JobContext* m_jobContext = nullptr;
+        size_t m_parallelLoadThreshold = 0;
         bool m_clearContainers = false;
     };
 
@@ -8,9 +8,12 @@
 #include <limits>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonParallelLoader.h>
 #include <AzCore/Serialization/Json/JsonSerializationResult.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -192,6 +195,66 @@ namespace AZ
             retVal.Combine(result);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
+
+        // Elements that are stored as pointers can be created and loaded in parallel without touching the container. The
+        // loaded pointers are added to the container afterwards in document order. Elements that won't fit are left to
+        // the loop below, which loads them on this thread if space frees up.
+        const bool isPointer = (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) != 0;
+        JsonParallelLoader parallelLoader(context);
+        AZStd::vector<void*> loadedPointers;
+        if (isPointer && context.ShouldLoadInParallel(arraySize))
+        {
+            loadedPointers.resize(AZStd::min<size_t>(arraySize, capacity - containerSize), nullptr);
+            auto loadElement = [this, &loadedPointers, &inputValue, classElement, flags](size_t index, JsonDeserializerContext& elementContext)
+            {
+                ScopedContextPath subPath(elementContext, index);
+                return ContinueLoading(&loadedPointers[index], classElement->m_typeId,
+                    inputValue[aznumeric_cast<rapidjson::SizeType>(index)], elementContext, flags);
+            };
+            parallelLoader.Load(loadedPointers.size(), loadElement);
+        }
+        // Destroys the loaded elements that weren't moved into the container. This doesn't go through the container, so it
+        // also works when no more elements can be reserved.
+        auto freeLoadedPointers = [&loadedPointers, classElement, &context](size_t first)
+        {
+            for (size_t i = first; i < loadedPointers.size(); ++i)
+            {
+                void* instance = loadedPointers[i];
+                if (!instance)
+                {
+                    continue;
+                }
+                loadedPointers[i] = nullptr;
+
+                const SerializeContext::ClassData* classData = classElement->m_genericClassInfo
+                    ? classElement->m_genericClassInfo->GetClassData()
+                    : context.GetSerializeContext()->FindClassData(classElement->m_typeId);
+                if (classElement->m_azRtti)
+                {
+                    // The element may point to a derived type, which has to be destroyed through its own factory.
+                    const Uuid& actualClassId = classElement->m_azRtti->GetActualUuid(instance);
+                    if (actualClassId != classElement->m_typeId)
+                    {
+                        classData = context.GetSerializeContext()->FindClassData(actualClassId);
+                        if (classData && classData->m_azRtti)
+                        {
+                            instance = classElement->m_azRtti->Cast(instance, classData->m_azRtti->GetTypeId());
+                        }
+                    }
+                }
+
+                if (classData && classData->m_factory)
+                {
+                    classData->m_factory->Destroy(instance);
+                }
+                else
+                {
+                    context.Report(JsonSerializationResult::Tasks::Clear, JsonSerializationResult::Outcomes::Unsupported,
+                        "Unable to find the factory needed to destroy a loaded element of the basic container.");
+                }
+            }
+        };
+
         for (rapidjson::SizeType i = 0; i < arraySize; ++i)
         {
             ScopedContextPath subPath(context, i);
@@ -202,24 +265,37 @@ namespace AZ
             {
                 retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
                     "Unable to load more entries in basic container because it's full."));
+                freeLoadedPointers(i);
                 break;
             }
 
             void* elementAddress = container->ReserveElement(outputValue, classElement);
             if (!elementAddress)
             {
+                freeLoadedPointers(i);
                 return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
                     "Failed to allocate an item in the basic container.");
             }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+            if (isPointer)
             {
                 *reinterpret_cast<void**>(elementAddress) = nullptr;
             }
             
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+            JSR::ResultCode result(JSR::Tasks::ReadField);
+            if (i < loadedPointers.size())
+            {
+                *reinterpret_cast<void**>(elementAddress) = loadedPointers[i];
+                loadedPointers[i] = nullptr;
+                result = parallelLoader.Finalize(i);
+            }
+            else
+            {
+                result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+            }
             if (result.GetProcessing() == JSR::Processing::Halted)
             {
                 container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+                freeLoadedPointers(i + 1);
                 return context.Report(retVal, "Failed to read element for basic container.");
             }
             else if (result.GetProcessing() == JSR::Processing::Altered)
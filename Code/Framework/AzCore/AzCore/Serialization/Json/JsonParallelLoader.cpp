@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Serialization/Json/JsonParallelLoader.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    JsonParallelLoader::JsonParallelLoader(JsonDeserializerContext& context)
+        : m_context(context)
+    {
+    }
+
+    void JsonParallelLoader::Load(size_t elementCount, const LoadFunction& loadElement)
+    {
+        m_elements.clear();
+        m_elements.resize(elementCount);
+
+        JobContext* jobContext = m_context.GetJobContext();
+        const size_t numWorkers = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        if (elementCount < 2 || numWorkers == 0)
+        {
+            LoadRange(0, elementCount, loadElement);
+            return;
+        }
+
+        // Elements can differ a lot in size, so use a few batches per thread to balance the load. The calling thread
+        // loads the first batch itself instead of waiting idle.
+        const size_t numBatches = AZStd::min(elementCount, (numWorkers + 1) * 4);
+        const size_t batchSize = (elementCount + numBatches - 1) / numBatches;
+
+        JobCompletion completion(jobContext);
+        for (size_t batchStart = batchSize; batchStart < elementCount; batchStart += batchSize)
+        {
+            const size_t batchEnd = AZStd::min(batchStart + batchSize, elementCount);
+            auto loadBatch = [this, batchStart, batchEnd, &loadElement]()
+            {
+                LoadRange(batchStart, batchEnd, loadElement);
+            };
+            Job* job = CreateJobFunction(loadBatch, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+
+        LoadRange(0, batchSize, loadElement);
+        completion.StartAndWaitForCompletion();
+    }
+
+    JsonSerializationResult::ResultCode JsonParallelLoader::Finalize(size_t index)
+    {
+        AZ_Assert(index < m_elements.size(), "Element %zu wasn't loaded by the parallel loader.", index);
+        Element& element = m_elements[index];
+        const JsonSerializationResult::JsonIssueCallback& reporter = m_context.GetReporter();
+        for (const Issue& issue : element.m_issues)
+        {
+            reporter(issue.m_message, issue.m_result, issue.m_path);
+        }
+        element.m_issues = {};
+        return element.m_result;
+    }
+
+    void JsonParallelLoader::LoadRange(size_t begin, size_t end, const LoadFunction& loadElement)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "JsonParallelLoader::LoadRange");
+        for (size_t i = begin; i < end; ++i)
+        {
+            Element& element = m_elements[i];
+            auto recordIssue = [&element](AZStd::string_view message, JsonSerializationResult::ResultCode result, AZStd::string_view path)
+            {
+                element.m_issues.push_back({ AZStd::string(message), AZStd::string(path), result });
+                return result;
+            };
+            JsonDeserializerContext elementContext(m_context, recordIssue);
+            element.m_result = loadElement(i, elementContext);
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    //! Loads the elements of a container on the job system. Each element is loaded with its own JsonDeserializerContext that
+    //! records the reported issues instead of passing them on. Once all elements are loaded the container finalizes the elements
+    //! one by one in document order, which forwards the recorded issues to the reporter of the container's context. This keeps
+    //! the reporting identical to loading the elements one after the other.
+    //! The load function is called from multiple threads at the same time, so it must not modify the container itself.
+    class JsonParallelLoader final
+    {
+    public:
+        using LoadFunction = AZStd::function<JsonSerializationResult::ResultCode(size_t index, JsonDeserializerContext& elementContext)>;
+
+        explicit JsonParallelLoader(JsonDeserializerContext& context);
+
+        //! Calls the load function for all elements and waits until they have been loaded.
+        void Load(size_t elementCount, const LoadFunction& loadElement);
+        //! Reports the issues recorded for the element and returns the result of loading it.
+        JsonSerializationResult::ResultCode Finalize(size_t index);
+
+    private:
+        struct Issue
+        {
+            AZStd::string m_message;
+            AZStd::string m_path;
+            JsonSerializationResult::ResultCode m_result;
+        };
+
+        struct Element
+        {
+            AZStd::vector<Issue> m_issues;
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        };
+
+        void LoadRange(size_t begin, size_t end, const LoadFunction& loadElement);
+
+        JsonDeserializerContext& m_context;
+        AZStd::vector<Element> m_elements;
+    };
+} // namespace AZ
@@ -14,6 +14,7 @@
 
 namespace AZ
 {
+    class JobContext;
     class JsonRegistrationContext;
     class SerializeContext;
 
@@ -35,6 +36,15 @@ namespace AZ
         //! any values in the container will be kept and not overwritten.
         //! Note that this does not apply to containers where elements have a fixed location such as smart pointers or AZStd::tuple.
         bool m_clearContainers = false;
+
+        //! Optional job context used to load the elements of large containers in parallel. If not provided the global job context is
+        //! used, which then needs to be set when m_parallelLoadThreshold is enabled.
+        JobContext* m_jobContext = nullptr;
+        //! Maps and arrays of pointers with at least this many elements load their elements in parallel. Set to 0, the default,
+        //! to load everything on the calling thread. Only use this if all serializers, id mappers and metadata involved in loading
+        //! the elements can be used from multiple threads. Issues are still reported in document order, but only after the elements
+        //! are loaded, so changing the result code in the reporting callback doesn't alter how those elements are processed.
+        size_t m_parallelLoadThreshold = 0;
     };
 
     //! Optional settings used while storing an object to a json value.
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
+#include <AzCore/Serialization/Json/JsonParallelLoader.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/MapSerializer.h>
 #include <AzCore/Serialization/Json/StackedString.h>
@@ -122,7 +123,44 @@ namespace AZ
             }
             retVal.Combine(result);
         }
-        if (inputValue.IsObject())
+        if (inputValue.IsObject() && context.ShouldLoadInParallel(inputValue.MemberCount()) && CanLoadElementsInParallel(container))
+        {
+            maximumSize = inputValue.MemberCount();
+            JsonParallelLoader loader(context);
+            AZStd::vector<void*> addresses;
+            AZStd::vector<JSR::ResultCode> valueResults;
+            if (!LoadObjectInParallel(loader, addresses, valueResults, outputValue, container, pairElement, pairContainer,
+                keyElement, valueElement, inputValue, context))
+            {
+                return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                    "Failed to allocate the items for an associative container.");
+            }
+
+            rapidjson::SizeType index = 0;
+            for (auto& entry : inputValue.GetObject())
+            {
+                ScopedContextPath subPath(context, AZStd::string_view(entry.name.GetString(), entry.name.GetStringLength()));
+
+                JSR::ResultCode keyResult = loader.Finalize(index);
+                JSR::Result elementResult = StoreLoadedElement(outputValue, container, addresses[index], container->Size(outputValue) + 1,
+                    keyResult, valueResults[index], context);
+                ++index;
+                if (elementResult.GetResultCode().GetProcessing() != JSR::Processing::Halted)
+                {
+                    retVal.Combine(elementResult.GetResultCode());
+                }
+                else
+                {
+                    // The remaining elements are already loaded, but wouldn't have been reached when loading on a single thread.
+                    for (; index < maximumSize; ++index)
+                    {
+                        container->FreeReservedElement(outputValue, addresses[index], context.GetSerializeContext());
+                    }
+                    return elementResult;
+                }
+            }
+        }
+        else if (inputValue.IsObject())
         {
             maximumSize = inputValue.MemberCount();
             // Don't early out here because an empty object is also considered a default object.
@@ -213,6 +251,20 @@ namespace AZ
                 "Failed to allocate an item for an associative container.");
         }
 
+        JSR::ResultCode keyResult(JSR::Tasks::ReadField);
+        JSR::ResultCode valueResult(JSR::Tasks::ReadField);
+        LoadKeyAndValue(keyResult, valueResult, address, pairElement, pairContainer, keyElement, valueElement, key, value, context);
+        return StoreLoadedElement(outputValue, container, address, expectedSize, keyResult, valueResult, context);
+    }
+
+    void JsonMapSerializer::LoadKeyAndValue(JsonSerializationResult::ResultCode& keyResult,
+        JsonSerializationResult::ResultCode& valueResult, void* address, const SerializeContext::ClassElement* pairElement,
+        SerializeContext::IDataContainer* pairContainer, const SerializeContext::ClassElement* keyElement,
+        const SerializeContext::ClassElement* valueElement, const rapidjson::Value& key, const rapidjson::Value& value,
+        JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
         // Load key
         void* keyAddress = pairContainer->GetElementByIndex(address, pairElement, 0);
         AZ_Assert(keyAddress, "Element reserved for associative container, but unable to retrieve address of the key.");
@@ -222,11 +274,10 @@ namespace AZ
             keyLoadFlags |= ContinuationFlags::ResolvePointer;
             *reinterpret_cast<void**>(keyAddress) = nullptr;
         }
-        JSR::ResultCode keyResult = ContinueLoading(keyAddress, keyElement->m_typeId, key, context, keyLoadFlags);
+        keyResult = ContinueLoading(keyAddress, keyElement->m_typeId, key, context, keyLoadFlags);
         if (keyResult.GetProcessing() == JSR::Processing::Halted)
         {
-            container->FreeReservedElement(outputValue, address, context.GetSerializeContext());
-            return context.Report(keyResult, "Failed to read key for associative container.");
+            return;
         }
 
         // Load value
@@ -238,7 +289,20 @@ namespace AZ
             valueLoadFlags |= ContinuationFlags::ResolvePointer;
             *reinterpret_cast<void**>(valueAddress) = nullptr;
         }
-        JSR::ResultCode valueResult = ContinueLoading(valueAddress, valueElement->m_typeId, value, context, valueLoadFlags);
+        valueResult = ContinueLoading(valueAddress, valueElement->m_typeId, value, context, valueLoadFlags);
+    }
+
+    JsonSerializationResult::Result JsonMapSerializer::StoreLoadedElement(void* outputValue, SerializeContext::IDataContainer* container,
+        void* address, size_t expectedSize, JsonSerializationResult::ResultCode keyResult, JsonSerializationResult::ResultCode valueResult,
+        JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
+        if (keyResult.GetProcessing() == JSR::Processing::Halted)
+        {
+            container->FreeReservedElement(outputValue, address, context.GetSerializeContext());
+            return context.Report(keyResult, "Failed to read key for associative container.");
+        }
         if (valueResult.GetProcessing() == JSR::Processing::Halted)
         {
             container->FreeReservedElement(outputValue, address, context.GetSerializeContext());
@@ -267,6 +331,57 @@ namespace AZ
             "Successfully loaded an entry into the associative container.");
     }
 
+    bool JsonMapSerializer::LoadObjectInParallel(JsonParallelLoader& loader, AZStd::vector<void*>& addresses,
+        AZStd::vector<JsonSerializationResult::ResultCode>& valueResults, void* outputValue, SerializeContext::IDataContainer* container,
+        const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer,
+        const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement,
+        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult;
+
+        // Associative containers reserve elements outside of the container, so all elements can be reserved up front and loaded
+        // at the same time. The caller stores the elements in the container afterwards in document order.
+        const rapidjson::SizeType elementCount = inputValue.MemberCount();
+        addresses.reserve(elementCount);
+        for (rapidjson::SizeType i = 0; i < elementCount; ++i)
+        {
+            void* address = container->ReserveElement(outputValue, pairElement);
+            if (!address)
+            {
+                for (void* reservedAddress : addresses)
+                {
+                    container->FreeReservedElement(outputValue, reservedAddress, context.GetSerializeContext());
+                }
+                return false;
+            }
+            addresses.push_back(address);
+        }
+
+        const rapidjson::Value defaultValue(rapidjson::kObjectType);
+        const rapidjson::Value::ConstMemberIterator members = inputValue.MemberBegin();
+        valueResults.resize(elementCount, JSR::ResultCode(JSR::Tasks::ReadField));
+        auto loadElement = [this, &addresses, &valueResults, &defaultValue, members, pairElement, pairContainer, keyElement, valueElement]
+            (size_t index, JsonDeserializerContext& elementContext)
+        {
+            const auto& entry = *(members + index);
+            AZStd::string_view keyName(entry.name.GetString(), entry.name.GetStringLength());
+            ScopedContextPath subPath(elementContext, keyName);
+
+            const rapidjson::Value& key = (keyName == JsonSerialization::DefaultStringIdentifier) ? defaultValue : entry.name;
+            JSR::ResultCode keyResult(JSR::Tasks::ReadField);
+            LoadKeyAndValue(keyResult, valueResults[index], addresses[index], pairElement, pairContainer,
+                keyElement, valueElement, key, entry.value, elementContext);
+            return keyResult;
+        };
+        loader.Load(elementCount, loadElement);
+        return true;
+    }
+
+    bool JsonMapSerializer::CanLoadElementsInParallel(SerializeContext::IDataContainer* container) const
+    {
+        return container->GetAssociativeContainerInterface() != nullptr;
+    }
+
     JsonSerializationResult::Result JsonMapSerializer::Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
         const Uuid& valueTypeId, JsonSerializerContext& context, bool sortResult)
     {
@@ -458,6 +573,12 @@ namespace AZ
         }
     }
 
+    bool JsonUnorderedMultiMapSerializer::CanLoadElementsInParallel(SerializeContext::IDataContainer*) const
+    {
+        // Values are stored per key as an array, which isn't handled by the parallel loading of the base class.
+        return false;
+    }
+
     JsonSerializationResult::Result JsonUnorderedMultiMapSerializer::Store(rapidjson::Value& outputValue, const void* inputValue,
         const void* defaultValue, const Uuid& valueTypeId, JsonSerializerContext& context)
     {
@@ -10,9 +10,12 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
+    class JsonParallelLoader;
+
     class JsonMapSerializer
         : public BaseJsonSerializer
     {
@@ -37,6 +40,27 @@ namespace AZ
             const Uuid& valueTypeId, JsonSerializerContext& context, bool sortResult);
 
         virtual bool CanBeConvertedToObject(const rapidjson::Value& outputValue);
+
+        //! Returns true if the elements of the container can be loaded with LoadObjectInParallel instead of LoadElement.
+        virtual bool CanLoadElementsInParallel(SerializeContext::IDataContainer* container) const;
+
+        //! Loads the key and value into an element that was reserved in the container. This doesn't modify the container, so
+        //! it can be called for multiple elements at the same time.
+        void LoadKeyAndValue(JsonSerializationResult::ResultCode& keyResult, JsonSerializationResult::ResultCode& valueResult,
+            void* address, const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer,
+            const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement,
+            const rapidjson::Value& key, const rapidjson::Value& value, JsonDeserializerContext& context);
+        //! Stores an element with a loaded key and value in the container, or frees the element if either failed to load.
+        JsonSerializationResult::Result StoreLoadedElement(void* outputValue, SerializeContext::IDataContainer* container, void* address,
+            size_t expectedSize, JsonSerializationResult::ResultCode keyResult, JsonSerializationResult::ResultCode valueResult,
+            JsonDeserializerContext& context);
+        //! Reserves an element for every member of the object and loads their keys and values on the job system.
+        //! @return False if not all elements could be reserved.
+        bool LoadObjectInParallel(JsonParallelLoader& loader, AZStd::vector<void*>& addresses,
+            AZStd::vector<JsonSerializationResult::ResultCode>& valueResults, void* outputValue, SerializeContext::IDataContainer* container,
+            const SerializeContext::ClassElement* pairElement, SerializeContext::IDataContainer* pairContainer,
+            const SerializeContext::ClassElement* keyElement, const SerializeContext::ClassElement* valueElement,
+            const rapidjson::Value& inputValue, JsonDeserializerContext& context);
     };
 
     class JsonUnorderedMapSerializer
@@ -64,5 +88,8 @@ namespace AZ
 
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
+
+    protected:
+        bool CanLoadElementsInParallel(SerializeContext::IDataContainer* container) const override;
     };
 }
@@ -22,6 +22,7 @@
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/TextStreamWriters.h>
 #include <AzCore/Math/Crc.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Jobs/JobManager.h>
 
@@ -48,6 +49,9 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/string/osstring.h>
 
 namespace AZ
@@ -58,6 +62,70 @@ namespace AZ
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
+        static const u8 s_compactBinaryStreamTag = 1;
+        // Compact binary streams store values in native byte order, this mark is used to detect streams from other platforms.
+        static const u16 s_compactByteOrderMark = 0x0102;
+
+        // The compact binary format refers to classes and element names by index instead of writing their ids with every element.
+        // An element starts with a type token, followed by a name token and the value or plain data block if the class has one.
+        enum CompactToken : u32
+        {
+            CT_ELEMENT_END = 0,     // Type token that closes the current element.
+            CT_SCHEMA_DEFINITION,   // Type token that's followed by the definition of the next schema, before the actual type token.
+            CT_FIRST_SCHEMA,        // Type tokens from here on are schema indices.
+
+            CT_NO_NAME = 0,         // Name token for elements without a name.
+            CT_NEW_NAME,            // Name token that's followed by the name crc, which is added to the parent's name table.
+            CT_FIRST_NAME           // Name tokens from here on are indices in the parent's name table.
+        };
+
+        enum CompactSchemaFlags : u8
+        {
+            CSF_HAS_VALUE   = 1 << 0,
+            CSF_PLAIN_DATA  = 1 << 1,   // The fields are stored as one block after the element header, there's no end token.
+            CSF_LEAF        = 1 << 2    // The class only has a value, there's no end token.
+        };
+
+        enum CompactReadResult
+        {
+            CRR_ELEMENT,
+            CRR_END,
+            CRR_ERROR
+        };
+
+        //! A field of a plain data class, which is a class that only consists of fundamental types. All fields of such a class are
+        //! stored together as one block in native layout.
+        struct CompactField
+        {
+            u32 m_nameCrc;
+            u32 m_size;
+            u64 m_offset;
+            Uuid m_typeId;
+        };
+
+        //! A contiguous range of fields that can be copied between the plain data block and the object in one go.
+        struct CompactCopyRange
+        {
+            size_t m_dataOffset;
+            size_t m_objectOffset;
+            size_t m_size;
+        };
+
+        //! Layout of a class in a compact binary stream.
+        struct CompactSchema
+        {
+            Uuid m_typeId;
+            u32 m_version = 0;
+            u8 m_flags = 0;
+            u64 m_layoutHash = 0;
+            size_t m_dataSize = 0;
+            AZStd::vector<CompactField> m_fields;
+            AZStd::vector<CompactCopyRange> m_copyRanges;
+            //! Names of the sub elements, added in the order they're first used by an element of this class.
+            AZStd::vector<u32> m_names;
+            //! The class the plain data can be copied into directly, if its layout matches the layout in the stream.
+            const SerializeContext::ClassData* m_directCopyClass = nullptr;
+        };
 
         class ObjectStreamImpl;
 
@@ -174,6 +242,29 @@ namespace AZ
             /// finalizes the stream after the user is done submitting his writes
             bool Finalize() override;
 
+            // Compact binary format
+            static bool IsCompactFundamentalType(const Uuid& typeId, size_t size);
+            /// Collects the fields of a class that only consists of fundamental types. Returns false if the class is anything else.
+            bool GetCompactPlainDataFields(const SerializeContext::ClassData* classData, AZStd::vector<CompactField>& fields) const;
+            static u64 CalculateCompactLayoutHash(const Uuid& typeId, u32 version, const AZStd::vector<CompactField>& fields);
+            static void BuildCompactCopyRanges(CompactSchema& schema);
+            /// Returns the index of the schema for the class, writes the schema definition to the stream the first time it's used.
+            u32 GetOrWriteCompactSchema(const SerializeContext::ClassData* classData);
+            void WriteCompactName(u32 nameCrc);
+            void WriteCompactVarInt(u64 value);
+            bool ReadCompactVarInt(u64& value);
+            bool ReadCompactSchema();
+            bool ReadCompactName(u32& nameCrc);
+            /// Reads the next element header and its value from a compact stream.
+            CompactReadResult ReadCompactElement(SerializeContext::DataElement& element);
+            /// Returns the fields of the last read plain data element one by one, so they're loaded like regular elements.
+            bool ReadCompactPlainDataField(SerializeContext::DataElement& element);
+            /// Copies the last read plain data element directly into the object if the layouts match. Returns false if the fields
+            /// of the element need to be loaded one by one instead.
+            bool CopyCompactPlainData(const SerializeContext::ClassData* classData, void* dataAddress);
+            void SkipCompactElement();
+            void ReportCompactReadError(const char* message);
+
             /// Returns true if we will keep the element class, otherwise false
             bool ConvertOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
             void PreparseOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
@@ -224,6 +315,24 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // used for compact binary streams
+            AZStd::vector<CompactSchema>                  m_compactSchemas;
+            AZStd::unordered_map<Uuid, u32>               m_compactSchemaIndices;
+            AZStd::vector<u32>                            m_compactRootNames;
+            AZStd::vector<u32>                            m_compactElementStack; // schema indices of the open elements
+            // The plain data block of the last read plain data element, until all its fields are loaded.
+            struct CompactPlainData
+            {
+                bool m_isPending = false;
+                u32 m_schemaIndex = 0;
+                size_t m_nextField = 0;
+                size_t m_nextDataOffset = 0;
+                AZStd::vector<u8> m_data;
+            };
+            CompactPlainData                              m_compactPlainData;
+            bool                                          m_compactLeafOpen = false; // the last read element has no children
+            bool                                          m_compactReadFailed = false;
         };
 
         //=========================================================================
@@ -820,8 +929,11 @@ namespace AZ
                     classData->m_container->ClearElements(dataAddress, m_sc);
                 }
 
-                // Read child nodes
-                result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                // Read child nodes. Plain data classes from compact binary streams are copied in one go if their layout didn't change.
+                if (isConvertedData || !CopyCompactPlainData(classData, dataAddress))
+                {
+                    result = LoadClass(stream, *convertedNode, classData, dataAddress, flags) && result;
+                }
 
                 if (classContainer)
                 {
@@ -1271,6 +1383,64 @@ namespace AZ
                     }
                 }
             }
+            else if (GetType() == ST_BINARY_COMPACT)
+            {
+                if (m_compactLeafOpen)
+                {
+                    // The last element doesn't have children, so reading its first child ends it.
+                    m_compactLeafOpen = false;
+                    if (nextLevel)
+                    {
+                        return false;
+                    }
+                }
+
+                if (m_compactPlainData.m_isPending && !nextLevel && m_compactPlainData.m_nextField == 0)
+                {
+                    // The fields of the last plain data element were never read, so drop them and continue with its sibling.
+                    m_compactPlainData.m_isPending = false;
+                }
+
+                if (m_compactPlainData.m_isPending)
+                {
+                    if (!ReadCompactPlainDataField(element))
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    if (m_stream->GetCurPos() == m_stream->GetLength())
+                    {
+                        // Reached the end of the stream. We may reach this state if we just skipped the root element
+                        return false;
+                    }
+
+                    if (ReadCompactElement(element) != CRR_ELEMENT)
+                    {
+                        return false;
+                    }
+                }
+
+                element.m_dataType = SerializeContext::DataElement::DT_BINARY;
+
+                // find the registered class data
+                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+                if (cd)
+                {
+                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                    {
+                        element.m_id = genericClassInfo->GetSpecializedTypeId();
+                    }
+                }
+
+                // Root elements may require classInfo to be provided by the in-place load callback.
+                if (!cd && isTopElement && m_inplaceLoadInfoCB)
+                {
+                    m_inplaceLoadInfoCB(nullptr, &cd, element.m_id, &sc);
+                }
+            }
             else /*ST_BINARY*/
             {
                 if (m_stream->GetCurPos() == m_stream->GetLength())
@@ -1419,7 +1589,11 @@ namespace AZ
         //=========================================================================
         void ObjectStreamImpl::SkipElement()
         {
-            if (GetType() == ST_BINARY)
+            if (GetType() == ST_BINARY_COMPACT)
+            {
+                SkipCompactElement();
+            }
+            else if (GetType() == ST_BINARY)
             {
                 int endTagsNeeded = 1;
                 while (endTagsNeeded > 0)
@@ -1497,6 +1671,472 @@ namespace AZ
             }
         }
 
+        //=========================================================================
+        // Compact binary format
+        //=========================================================================
+        bool ObjectStreamImpl::IsCompactFundamentalType(const Uuid& typeId, size_t size)
+        {
+            static const AZStd::pair<Uuid, size_t> fundamentalTypes[] =
+            {
+                { azrtti_typeid<char>(), sizeof(char) },
+                { azrtti_typeid<s8>(), sizeof(s8) },
+                { azrtti_typeid<short>(), sizeof(short) },
+                { azrtti_typeid<int>(), sizeof(int) },
+                { azrtti_typeid<long>(), sizeof(long) },
+                { azrtti_typeid<s64>(), sizeof(s64) },
+                { azrtti_typeid<unsigned char>(), sizeof(unsigned char) },
+                { azrtti_typeid<unsigned short>(), sizeof(unsigned short) },
+                { azrtti_typeid<unsigned int>(), sizeof(unsigned int) },
+                { azrtti_typeid<unsigned long>(), sizeof(unsigned long) },
+                { azrtti_typeid<u64>(), sizeof(u64) },
+                { azrtti_typeid<float>(), sizeof(float) },
+                { azrtti_typeid<double>(), sizeof(double) },
+                { azrtti_typeid<bool>(), sizeof(bool) }
+            };
+
+            for (const AZStd::pair<Uuid, size_t>& fundamentalType : fundamentalTypes)
+            {
+                if (fundamentalType.first == typeId)
+                {
+                    return fundamentalType.second == size;
+                }
+            }
+            return false;
+        }
+
+        bool ObjectStreamImpl::GetCompactPlainDataFields(const SerializeContext::ClassData* classData, AZStd::vector<CompactField>& fields) const
+        {
+            if (classData->m_serializer || classData->m_container || classData->m_elements.empty() || classData->IsDeprecated() ||
+                classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid() ||
+                classData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride))
+            {
+                return false;
+            }
+
+            fields.clear();
+            fields.reserve(classData->m_elements.size());
+            for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+            {
+                // Pointers, base classes and dynamic fields can't be copied as plain data.
+                if ((classElement.m_flags & ~SerializeContext::ClassElement::FLG_NO_DEFAULT_VALUE) != 0 ||
+                    !IsCompactFundamentalType(classElement.m_typeId, classElement.m_dataSize))
+                {
+                    fields.clear();
+                    return false;
+                }
+                fields.push_back({ classElement.m_nameCrc, static_cast<u32>(classElement.m_dataSize), classElement.m_offset, classElement.m_typeId });
+            }
+            return true;
+        }
+
+        u64 ObjectStreamImpl::CalculateCompactLayoutHash(const Uuid& typeId, u32 version, const AZStd::vector<CompactField>& fields)
+        {
+            struct LayoutHeader
+            {
+                Uuid m_typeId;
+                u32 m_version;
+                u32 m_fieldCount;
+            };
+            LayoutHeader header{ typeId, version, static_cast<u32>(fields.size()) };
+            HashValue64 hash = TypeHash64(header);
+            for (const CompactField& field : fields)
+            {
+                hash = TypeHash64(field, hash);
+            }
+            return static_cast<u64>(hash);
+        }
+
+        void ObjectStreamImpl::BuildCompactCopyRanges(CompactSchema& schema)
+        {
+            schema.m_copyRanges.clear();
+            schema.m_dataSize = 0;
+            for (const CompactField& field : schema.m_fields)
+            {
+                const size_t objectOffset = static_cast<size_t>(field.m_offset);
+                if (!schema.m_copyRanges.empty())
+                {
+                    // Merge fields that directly follow each other in the object, which is the common case for structs
+                    // without padding.
+                    CompactCopyRange& lastRange = schema.m_copyRanges.back();
+                    if (lastRange.m_objectOffset + lastRange.m_size == objectOffset)
+                    {
+                        lastRange.m_size += field.m_size;
+                        schema.m_dataSize += field.m_size;
+                        continue;
+                    }
+                }
+                schema.m_copyRanges.push_back({ schema.m_dataSize, objectOffset, field.m_size });
+                schema.m_dataSize += field.m_size;
+            }
+        }
+
+        u32 ObjectStreamImpl::GetOrWriteCompactSchema(const SerializeContext::ClassData* classData)
+        {
+            auto schemaIt = m_compactSchemaIndices.find(classData->m_typeId);
+            if (schemaIt != m_compactSchemaIndices.end())
+            {
+                return schemaIt->second;
+            }
+
+            CompactSchema schema;
+            schema.m_typeId = classData->m_typeId;
+            schema.m_version = classData->m_version;
+            if (classData->m_serializer)
+            {
+                schema.m_flags |= CSF_HAS_VALUE;
+                if (classData->m_elements.empty() && !classData->m_container)
+                {
+                    schema.m_flags |= CSF_LEAF;
+                }
+            }
+            else if (GetCompactPlainDataFields(classData, schema.m_fields))
+            {
+                schema.m_flags |= CSF_PLAIN_DATA;
+                schema.m_layoutHash = CalculateCompactLayoutHash(schema.m_typeId, schema.m_version, schema.m_fields);
+                BuildCompactCopyRanges(schema);
+            }
+
+            WriteCompactVarInt(CT_SCHEMA_DEFINITION);
+            m_stream->Write(schema.m_typeId.end() - schema.m_typeId.begin(), schema.m_typeId.begin());
+            WriteCompactVarInt(schema.m_version);
+            m_stream->Write(sizeof(schema.m_flags), &schema.m_flags);
+            if (schema.m_flags & CSF_PLAIN_DATA)
+            {
+                m_stream->Write(sizeof(schema.m_layoutHash), &schema.m_layoutHash);
+                WriteCompactVarInt(schema.m_fields.size());
+                for (const CompactField& field : schema.m_fields)
+                {
+                    m_stream->Write(sizeof(field.m_nameCrc), &field.m_nameCrc);
+                    m_stream->Write(field.m_typeId.end() - field.m_typeId.begin(), field.m_typeId.begin());
+                    WriteCompactVarInt(field.m_offset);
+                    WriteCompactVarInt(field.m_size);
+                }
+            }
+
+            const u32 schemaIndex = static_cast<u32>(m_compactSchemas.size());
+            m_compactSchemas.push_back(AZStd::move(schema));
+            m_compactSchemaIndices.emplace(classData->m_typeId, schemaIndex);
+            return schemaIndex;
+        }
+
+        void ObjectStreamImpl::WriteCompactName(u32 nameCrc)
+        {
+            if (nameCrc == 0)
+            {
+                WriteCompactVarInt(CT_NO_NAME);
+                return;
+            }
+
+            AZStd::vector<u32>& names = m_compactElementStack.empty() ? m_compactRootNames : m_compactSchemas[m_compactElementStack.back()].m_names;
+            auto nameIt = AZStd::find(names.begin(), names.end(), nameCrc);
+            if (nameIt != names.end())
+            {
+                WriteCompactVarInt(CT_FIRST_NAME + static_cast<u64>(nameIt - names.begin()));
+            }
+            else
+            {
+                WriteCompactVarInt(CT_NEW_NAME);
+                m_stream->Write(sizeof(nameCrc), &nameCrc);
+                names.push_back(nameCrc);
+            }
+        }
+
+        void ObjectStreamImpl::WriteCompactVarInt(u64 value)
+        {
+            // 7 bits per byte, the high bit is set if more bytes follow.
+            u8 buffer[10];
+            size_t size = 0;
+            do
+            {
+                u8 byte = static_cast<u8>(value & 0x7F);
+                value >>= 7;
+                if (value)
+                {
+                    byte |= 0x80;
+                }
+                buffer[size++] = byte;
+            } while (value);
+            m_stream->Write(size, buffer);
+        }
+
+        bool ObjectStreamImpl::ReadCompactVarInt(u64& value)
+        {
+            value = 0;
+            for (u32 shift = 0; shift < 64; shift += 7)
+            {
+                u8 byte;
+                if (m_stream->Read(sizeof(byte), &byte) != sizeof(byte))
+                {
+                    return false;
+                }
+                value |= static_cast<u64>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool ObjectStreamImpl::ReadCompactSchema()
+        {
+            // Plain data classes only consist of fundamental types, so this is far more than any real class has.
+            static const u64 maxFieldCount = 0xFFFF;
+
+            CompactSchema schema;
+            u64 version = 0;
+            const IO::SizeType uuidSize = schema.m_typeId.end() - schema.m_typeId.begin();
+            if (m_stream->Read(uuidSize, schema.m_typeId.begin()) != uuidSize ||
+                !ReadCompactVarInt(version) || version > AZStd::numeric_limits<u32>::max() ||
+                m_stream->Read(sizeof(schema.m_flags), &schema.m_flags) != sizeof(schema.m_flags))
+            {
+                ReportCompactReadError("Failed to read schema definition.");
+                return false;
+            }
+            schema.m_version = static_cast<u32>(version);
+
+            if (schema.m_flags & CSF_PLAIN_DATA)
+            {
+                u64 fieldCount = 0;
+                if (m_stream->Read(sizeof(schema.m_layoutHash), &schema.m_layoutHash) != sizeof(schema.m_layoutHash) ||
+                    !ReadCompactVarInt(fieldCount) || fieldCount == 0 || fieldCount > maxFieldCount)
+                {
+                    ReportCompactReadError("Failed to read plain data schema definition.");
+                    return false;
+                }
+
+                schema.m_fields.resize_no_construct(static_cast<size_t>(fieldCount));
+                for (CompactField& field : schema.m_fields)
+                {
+                    u64 size = 0;
+                    if (m_stream->Read(sizeof(field.m_nameCrc), &field.m_nameCrc) != sizeof(field.m_nameCrc) ||
+                        m_stream->Read(uuidSize, field.m_typeId.begin()) != uuidSize ||
+                        !ReadCompactVarInt(field.m_offset) || !ReadCompactVarInt(size) || size == 0 || size > sizeof(u64))
+                    {
+                        ReportCompactReadError("Failed to read plain data field definition.");
+                        return false;
+                    }
+                    field.m_size = static_cast<u32>(size);
+                }
+
+                if (CalculateCompactLayoutHash(schema.m_typeId, schema.m_version, schema.m_fields) != schema.m_layoutHash)
+                {
+                    ReportCompactReadError("Plain data schema definition is corrupted.");
+                    return false;
+                }
+                BuildCompactCopyRanges(schema);
+
+                // The data can only be copied into the object in one go if the class still has exactly the same layout.
+                AZStd::vector<CompactField> runtimeFields;
+                const SerializeContext::ClassData* classData = m_sc->FindClassData(schema.m_typeId);
+                if (classData && GetCompactPlainDataFields(classData, runtimeFields) &&
+                    CalculateCompactLayoutHash(classData->m_typeId, classData->m_version, runtimeFields) == schema.m_layoutHash)
+                {
+                    schema.m_directCopyClass = classData;
+                }
+            }
+
+            m_compactSchemas.push_back(AZStd::move(schema));
+            return true;
+        }
+
+        bool ObjectStreamImpl::ReadCompactName(u32& nameCrc)
+        {
+            u64 token = 0;
+            if (!ReadCompactVarInt(token))
+            {
+                ReportCompactReadError("Failed to read element name.");
+                return false;
+            }
+
+            AZStd::vector<u32>& names = m_compactElementStack.empty() ? m_compactRootNames : m_compactSchemas[m_compactElementStack.back()].m_names;
+            if (token == CT_NO_NAME)
+            {
+                nameCrc = 0;
+            }
+            else if (token == CT_NEW_NAME)
+            {
+                if (m_stream->Read(sizeof(nameCrc), &nameCrc) != sizeof(nameCrc))
+                {
+                    ReportCompactReadError("Failed to read element name.");
+                    return false;
+                }
+                names.push_back(nameCrc);
+            }
+            else if (token - CT_FIRST_NAME < names.size())
+            {
+                nameCrc = names[static_cast<size_t>(token - CT_FIRST_NAME)];
+            }
+            else
+            {
+                ReportCompactReadError("Element refers to an unknown name.");
+                return false;
+            }
+            return true;
+        }
+
+        CompactReadResult ObjectStreamImpl::ReadCompactElement(SerializeContext::DataElement& element)
+        {
+            u64 token = 0;
+            do
+            {
+                if (!ReadCompactVarInt(token))
+                {
+                    ReportCompactReadError("Failed to read element.");
+                    return CRR_ERROR;
+                }
+                if (token == CT_SCHEMA_DEFINITION && !ReadCompactSchema())
+                {
+                    return CRR_ERROR;
+                }
+            } while (token == CT_SCHEMA_DEFINITION);
+
+            if (token == CT_ELEMENT_END)
+            {
+                if (!m_compactElementStack.empty())
+                {
+                    m_compactElementStack.pop_back();
+                }
+                return CRR_END;
+            }
+
+            if (token - CT_FIRST_SCHEMA >= m_compactSchemas.size())
+            {
+                ReportCompactReadError("Element refers to an unknown schema.");
+                return CRR_ERROR;
+            }
+            const u32 schemaIndex = static_cast<u32>(token - CT_FIRST_SCHEMA);
+            const CompactSchema& schema = m_compactSchemas[schemaIndex];
+
+            if (!ReadCompactName(element.m_nameCrc))
+            {
+                return CRR_ERROR;
+            }
+            element.m_id = schema.m_typeId;
+            element.m_version = schema.m_version;
+
+            if (schema.m_flags & CSF_HAS_VALUE)
+            {
+                u64 valueBytes = 0;
+                if (!ReadCompactVarInt(valueBytes) || valueBytes > m_stream->GetLength() - m_stream->GetCurPos())
+                {
+                    ReportCompactReadError("Failed to read element value.");
+                    return CRR_ERROR;
+                }
+                element.m_dataSize = static_cast<size_t>(valueBytes);
+                element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                if (element.m_dataSize)
+                {
+                    // Directly copy data from m_stream into element.m_stream
+                    element.m_stream->WriteFromStream(element.m_dataSize, m_stream);
+                }
+            }
+
+            if (schema.m_flags & CSF_PLAIN_DATA)
+            {
+                m_compactPlainData.m_data.resize_no_construct(schema.m_dataSize);
+                if (m_stream->Read(schema.m_dataSize, m_compactPlainData.m_data.data()) != schema.m_dataSize)
+                {
+                    ReportCompactReadError("Failed to read plain data.");
+                    return CRR_ERROR;
+                }
+                m_compactPlainData.m_isPending = true;
+                m_compactPlainData.m_schemaIndex = schemaIndex;
+                m_compactPlainData.m_nextField = 0;
+                m_compactPlainData.m_nextDataOffset = 0;
+            }
+            else if (schema.m_flags & CSF_LEAF)
+            {
+                m_compactLeafOpen = true;
+            }
+            else
+            {
+                m_compactElementStack.push_back(schemaIndex);
+            }
+            return CRR_ELEMENT;
+        }
+
+        bool ObjectStreamImpl::ReadCompactPlainDataField(SerializeContext::DataElement& element)
+        {
+            const CompactSchema& schema = m_compactSchemas[m_compactPlainData.m_schemaIndex];
+            if (m_compactPlainData.m_nextField == schema.m_fields.size())
+            {
+                // All fields are loaded, which ends the plain data element.
+                m_compactPlainData.m_isPending = false;
+                return false;
+            }
+
+            const CompactField& field = schema.m_fields[m_compactPlainData.m_nextField++];
+            element.m_id = field.m_typeId;
+            element.m_nameCrc = field.m_nameCrc;
+            element.m_dataSize = field.m_size;
+            element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+            element.m_stream->Write(field.m_size, m_compactPlainData.m_data.data() + m_compactPlainData.m_nextDataOffset);
+            m_compactPlainData.m_nextDataOffset += field.m_size;
+            m_compactLeafOpen = true;
+            return true;
+        }
+
+        bool ObjectStreamImpl::CopyCompactPlainData(const SerializeContext::ClassData* classData, void* dataAddress)
+        {
+            if (!m_compactPlainData.m_isPending || m_compactPlainData.m_nextField != 0 || !dataAddress)
+            {
+                return false;
+            }
+
+            const CompactSchema& schema = m_compactSchemas[m_compactPlainData.m_schemaIndex];
+            if (schema.m_directCopyClass != classData)
+            {
+                return false;
+            }
+
+            for (const CompactCopyRange& range : schema.m_copyRanges)
+            {
+                memcpy(reinterpret_cast<char*>(dataAddress) + range.m_objectOffset, m_compactPlainData.m_data.data() + range.m_dataOffset, range.m_size);
+            }
+            m_compactPlainData.m_isPending = false;
+            return true;
+        }
+
+        void ObjectStreamImpl::SkipCompactElement()
+        {
+            if (m_compactLeafOpen)
+            {
+                m_compactLeafOpen = false;
+                return;
+            }
+            if (m_compactPlainData.m_isPending)
+            {
+                m_compactPlainData.m_isPending = false;
+                return;
+            }
+
+            // The skipped element is on top of the stack, read until its end token. Names and schemas in the skipped elements
+            // still need to be read to keep the tables in sync with the writer.
+            SerializeContext::DataElement element;
+            element.m_stream = &element.m_byteStream;
+            const size_t depth = m_compactElementStack.size();
+            while (m_compactElementStack.size() >= depth)
+            {
+                if (ReadCompactElement(element) == CRR_ERROR)
+                {
+                    return;
+                }
+                m_compactLeafOpen = false;
+                m_compactPlainData.m_isPending = false;
+            }
+        }
+
+        void ObjectStreamImpl::ReportCompactReadError(const char* message)
+        {
+            AZStd::string error = AZStd::string::format("ObjectStream compact binary load error: %s File %s", message, GetStreamFilename());
+            m_errorLogger.ReportError(error.c_str());
+
+            // The rest of the stream can't be interpreted anymore, so stop reading.
+            m_compactReadFailed = true;
+            m_stream->Seek(0, IO::GenericStream::ST_SEEK_END);
+        }
+
         //=========================================================================
         // WriteClass
         // [6/22/2012]
@@ -1782,6 +2422,41 @@ namespace AZ
                 m_jsonWriteValues.push_back();
                 m_jsonWriteValues.back().SetArray();
             }
+            else if (GetType() == ST_BINARY_COMPACT)
+            {
+                const u32 schemaIndex = GetOrWriteCompactSchema(classData);
+                WriteCompactVarInt(CT_FIRST_SCHEMA + schemaIndex);
+                WriteCompactName(element.m_nameCrc);
+
+                const CompactSchema& schema = m_compactSchemas[schemaIndex];
+                if (schema.m_flags & CSF_HAS_VALUE)
+                {
+                    WriteCompactVarInt(element.m_dataSize);
+                    if (element.m_dataSize)
+                    {
+                        element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                        // Directly copy data from element.m_stream into m_stream
+                        m_stream->WriteFromStream(element.m_dataSize, element.m_stream);
+                    }
+                    element.m_stream = nullptr;
+                }
+
+                if (schema.m_flags & CSF_PLAIN_DATA)
+                {
+                    // The fields are written as one block, so stop the enumeration from writing them as elements.
+                    for (const CompactCopyRange& range : schema.m_copyRanges)
+                    {
+                        m_stream->Write(range.m_size, reinterpret_cast<const char*>(objectPtr) + range.m_objectOffset);
+                    }
+                    return false;
+                }
+                if (schema.m_flags & CSF_LEAF)
+                {
+                    // There are no children to write and the element doesn't need to be closed.
+                    return false;
+                }
+                m_compactElementStack.push_back(schemaIndex);
+            }
             else /*ST_BINARY*/
             {
                 u8 flagsSize = ST_BINARYFLAG_ELEMENT_HEADER;
@@ -1913,6 +2588,11 @@ namespace AZ
                 AZ_Assert(m_jsonWriteValues.back().IsArray(), "This value should be the parent fields array!");
                 m_jsonWriteValues.back().PushBack(AZStd::move(classObject), m_jsonDoc->GetAllocator());
             }
+            else if (GetType() == ST_BINARY_COMPACT)
+            {
+                WriteCompactVarInt(CT_ELEMENT_END);
+                m_compactElementStack.pop_back();
+            }
             else /*ST_BINARY*/
             {
                 u8 endTag = ST_BINARYFLAG_ELEMENT_END;
@@ -1954,6 +2634,16 @@ namespace AZ
                     m_jsonWriteValues.push_back();
                     m_jsonWriteValues.back().SetArray();
                 }
+                else if (m_type == ST_BINARY_COMPACT)
+                {
+                    u8 compactTag = s_compactBinaryStreamTag;
+                    u32 version = static_cast<u32>(m_version);
+                    u16 byteOrderMark = s_compactByteOrderMark;
+                    AZStd::endian_swap(version);
+                    m_stream->Write(sizeof(compactTag), &compactTag);
+                    m_stream->Write(sizeof(version), &version);
+                    m_stream->Write(sizeof(byteOrderMark), &byteOrderMark);
+                }
                 else
                 {
                     u8 binaryTag = s_binaryStreamTag;
@@ -1998,6 +2688,40 @@ namespace AZ
                             result = false;
                         }
                     }
+                    else if (streamTag == s_compactBinaryStreamTag)
+                    {
+                        SetType(ST_BINARY_COMPACT);
+
+                        u32 version = 0;
+                        u16 byteOrderMark = 0;
+                        m_stream->Read(sizeof(version), &version);
+                        m_stream->Read(sizeof(byteOrderMark), &byteOrderMark);
+                        AZStd::endian_swap(version);
+                        m_version = version;
+
+                        if (m_version > s_objectStreamVersion)
+                        {
+                            AZStd::string newVersionError = AZStd::string::format("ObjectStream compact binary load error: Stream is a newer version than object stream supports. ObjectStream version: %u, load stream version: %u",
+                                s_objectStreamVersion, m_version);
+                            m_errorLogger.ReportError(newVersionError.c_str());
+
+                            // this is considered a "fatal" error since the entire stream is unreadable.
+                            result = false;
+                        }
+                        else if (byteOrderMark != s_compactByteOrderMark)
+                        {
+                            m_errorLogger.ReportError("ObjectStream compact binary load error: Stream was saved on a platform with a different byte order.");
+
+                            // this is considered a "fatal" error since the entire stream is unreadable.
+                            result = false;
+                        }
+                        else
+                        {
+                            result = LoadClass(m_inStream, convertedClassElement, nullptr, nullptr, m_flags) && result;
+                            // a corrupted stream is a "fatal" error since the rest of the stream is unreadable.
+                            result = result && !m_compactReadFailed;
+                        }
+                    }
                     else if (streamTag == s_xmlStreamTag)
                     {
                         SetType(ST_XML);
@@ -2098,7 +2822,7 @@ namespace AZ
                     }
                     else
                     {
-                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '<' xml or '{' json!");
+                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '\\1' compact binary, '<' xml or '{' json!");
                         // this is considered a "fatal" error since the entire stream is unreadable.
                         result = false;
                     }
@@ -2149,6 +2873,10 @@ namespace AZ
                     azdestroy(m_jsonDoc, SystemAllocator, rapidjson::Document);
                     m_jsonDoc = nullptr;
                 }
+                else if (GetType() == ST_BINARY_COMPACT)
+                {
+                    WriteCompactVarInt(CT_ELEMENT_END);
+                }
                 else
                 {   /* ST_BINARY */
                     u8 endTag = ST_BINARYFLAG_ELEMENT_END;
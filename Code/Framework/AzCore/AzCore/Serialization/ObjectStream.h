@@ -72,6 +72,7 @@ namespace AZ
             ST_XML,
             ST_JSON,
             ST_BINARY,
+            ST_BINARY_COMPACT, ///< Binary stream that stores the layout of each class once and copies plain data classes in a single block.
             ST_MAX // insert new types before this.
         };
 
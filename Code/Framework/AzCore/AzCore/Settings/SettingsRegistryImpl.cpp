@@ -8,11 +8,15 @@
 #include <cctype>
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+#include <AzCore/IO/SystemFile.h>
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/NativeUI//NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/Utils/TypeHash.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 
@@ -1161,4 +1165,136 @@ namespace AZ
     {
         applyPatchSettings = m_applyPatchSettings;
     }
+
+    size_t SettingsRegistryImpl::GetFileHistoryCount() const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+
+        const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(m_settings);
+        return (history && history->IsArray()) ? history->Size() : 0;
+    }
+
+    u64 SettingsRegistryImpl::GetSnapshotKey(const Specializations& specializations, AZStd::string_view platform) const
+    {
+        AZStd::vector<char> buffer;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            SettingsRegistrySnapshot::WriteValue(buffer, m_settings);
+        }
+
+        HashValue64 key = TypeHash64(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.size());
+        size_t specializationCount = specializations.GetCount();
+        for (size_t i = 0; i < specializationCount; ++i)
+        {
+            AZStd::string_view name = specializations.GetSpecialization(i);
+            key = TypeHash64(reinterpret_cast<const uint8_t*>(name.data()), name.size(), key);
+        }
+        key = TypeHash64(reinterpret_cast<const uint8_t*>(platform.data()), platform.size(), key);
+        return static_cast<u64>(key);
+    }
+
+    bool SettingsRegistryImpl::SaveSnapshot(const char* filePath, u64 stateKey, size_t historyStart, AZStd::string_view platform) const
+    {
+        using namespace AZ::IO;
+        using namespace SettingsRegistrySnapshot;
+
+        AZStd::vector<char> buffer;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+
+            // Every merged file is recorded in the history with its path, either directly or as part of an error. Folders are
+            // recorded with their search pattern, which is also used to find the platform specific files if there's a platform.
+            InputList inputs;
+            const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(m_settings);
+            const rapidjson::SizeType historyCount = (history && history->IsArray()) ? history->Size() : 0;
+            for (rapidjson::SizeType i = aznumeric_caster(historyStart); i < historyCount; ++i)
+            {
+                const rapidjson::Value& entry = (*history)[i];
+                const rapidjson::Value* path = &entry;
+                InputType type = InputType::File;
+                if (entry.IsObject())
+                {
+                    auto folderIt = entry.FindMember("Folder");
+                    auto pathIt = entry.FindMember("Path");
+                    if (folderIt != entry.MemberEnd())
+                    {
+                        path = &folderIt->value;
+                        type = InputType::Folder;
+                    }
+                    else if (pathIt != entry.MemberEnd())
+                    {
+                        path = &pathIt->value;
+                    }
+                }
+                if (!path->IsString() || path->GetStringLength() > MaxPathLength)
+                {
+                    continue;
+                }
+
+                Input& input = inputs.emplace_back();
+                input.m_path.assign(path->GetString(), path->GetStringLength());
+                input.m_type = type;
+                input.m_hash = HashInput(input);
+
+                if (type == InputType::Folder && !platform.empty())
+                {
+                    // Replace the '*' at the end of the folder pattern with the platform folder.
+                    Input platformInput;
+                    platformInput.m_path.assign(path->GetString(), path->GetStringLength() - 1);
+                    platformInput.m_path += PlatformFolder;
+                    platformInput.m_path.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                    platformInput.m_path += platform;
+                    platformInput.m_path.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                    platformInput.m_path.push_back('*');
+                    platformInput.m_type = InputType::Folder;
+                    platformInput.m_hash = HashInput(platformInput);
+                    inputs.push_back(AZStd::move(platformInput));
+                }
+            }
+
+            Write(buffer, stateKey, inputs, m_settings);
+        }
+
+        // Write to a temporary file first so other processes never map a partially written snapshot.
+        FixedMaxPathString tempPath(filePath);
+        tempPath += ".tmp";
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to create registry snapshot "%s".)", tempPath.c_str());
+            return false;
+        }
+        const bool written = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        if (!written || !SystemFile::Rename(tempPath.c_str(), filePath, true))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write registry snapshot "%s".)", filePath);
+            SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistryImpl::LoadSnapshot(const char* filePath, u64 stateKey)
+    {
+        AZ::IO::MemoryMappedFile file;
+        if (!file.Map(filePath))
+        {
+            return false;
+        }
+
+        rapidjson::Document snapshot;
+        if (!SettingsRegistrySnapshot::Read(snapshot, file.GetData(), file.GetSize(), stateKey) || !snapshot.IsObject())
+        {
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            m_settings.Swap(snapshot);
+        }
+
+        m_notifiers.Signal("", Type::Object);
+        return true;
+    }
 } // namespace AZ
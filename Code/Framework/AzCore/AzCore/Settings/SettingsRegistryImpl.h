@@ -76,6 +76,18 @@ namespace AZ
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
 
+        //! Returns the number of entries in the file history. Used to mark where the merges covered by a snapshot start.
+        size_t GetFileHistoryCount() const;
+        //! Calculates the key that identifies the current state of the registry, which includes the settings, the specializations
+        //! and the platform. Files merged on top of the same state produce the same settings, so the key is stored with a snapshot.
+        u64 GetSnapshotKey(const Specializations& specializations, AZStd::string_view platform) const;
+        //! Writes the settings to a binary snapshot. The files and folders merged since the file history had historyStart entries
+        //! are stored as the inputs of the snapshot, so the snapshot is ignored once any of them changes.
+        bool SaveSnapshot(const char* filePath, u64 stateKey, size_t historyStart, AZStd::string_view platform) const;
+        //! Replaces the settings with the ones from a snapshot created by SaveSnapshot with the same state key.
+        //! @return False and leaves the settings untouched if there's no valid snapshot or one of its inputs changed.
+        bool LoadSnapshot(const char* filePath, u64 stateKey);
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -63,6 +63,12 @@ namespace AZ::SettingsRegistryMergeUtils
     //! The value of the key has no meaning. Notification Handlers only need to check if the key was supplied
     inline static constexpr char CommandLineValueChangedKey[] = "/Amazon/AzCore/Runtime/CommandLineChanged";
 
+    //! Path of the binary snapshot of the engine, gem and project registry files. When set, the ComponentApplication
+    //! restores the merged settings from the snapshot instead of merging those files, as long as none of them changed.
+    //! The snapshot is written after each full merge. Can be set with --regset or in the o3de user registry (~/.o3de/Registry),
+    //! the project user registry is only merged before the snapshot is restored in debug and profile builds.
+    inline static constexpr char RegistrySnapshotPathKey[] = "/Amazon/AzCore/Settings/RegistrySnapshotPath";
+
     //! Root key where raw project settings (project.json) file is merged to settings registry
     inline static constexpr char ProjectSettingsRootKey[] = "/Amazon/Project/Settings";
 
@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/Utils/TypeHash.h>
+
+namespace AZ::SettingsRegistrySnapshot
+{
+    namespace Internal
+    {
+        // Tags for the encoded JSON values. Numbers are stored in their native 8 byte representation, strings, arrays and
+        // objects are prefixed with their length.
+        enum class ValueTag : u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object
+        };
+
+        struct Header
+        {
+            u32 m_magic;
+            u32 m_version;
+            u64 m_stateKey;
+            u32 m_inputCount;
+            u32 m_padding;
+        };
+
+        // Protects against stack overflows when reading corrupted snapshots. The registry is nowhere near this deep.
+        static constexpr u32 MaxDepth = 256;
+        // The hash of an existing file that's empty, as empty files can't be mapped.
+        static constexpr u64 EmptyFileHash = 1;
+
+        template<typename T>
+        void Append(AZStd::vector<char>& buffer, const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void AppendString(AZStd::vector<char>& buffer, const char* string, u32 length)
+        {
+            Append(buffer, length);
+            buffer.insert(buffer.end(), string, string + length);
+        }
+
+        // Bounds checked reads from the mapped snapshot.
+        class Reader
+        {
+        public:
+            Reader(const u8* data, u64 size)
+                : m_current(data)
+                , m_end(data + size)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (static_cast<u64>(m_end - m_current) < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_current, sizeof(T));
+                m_current += sizeof(T);
+                return true;
+            }
+
+            bool ReadString(const char*& string, u32& length)
+            {
+                if (!Read(length) || static_cast<u64>(m_end - m_current) < length)
+                {
+                    return false;
+                }
+                string = reinterpret_cast<const char*>(m_current);
+                m_current += length;
+                return true;
+            }
+
+            u64 GetRemainingSize() const
+            {
+                return static_cast<u64>(m_end - m_current);
+            }
+
+        private:
+            const u8* m_current;
+            const u8* m_end;
+        };
+
+        bool ReadValue(Reader& reader, rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, u32 depth)
+        {
+            if (depth > MaxDepth)
+            {
+                return false;
+            }
+
+            ValueTag tag;
+            if (!reader.Read(tag))
+            {
+                return false;
+            }
+
+            switch (tag)
+            {
+            case ValueTag::Null:
+                value.SetNull();
+                return true;
+            case ValueTag::False:
+                value.SetBool(false);
+                return true;
+            case ValueTag::True:
+                value.SetBool(true);
+                return true;
+            case ValueTag::Int64:
+            {
+                s64 number;
+                if (!reader.Read(number))
+                {
+                    return false;
+                }
+                value.SetInt64(number);
+                return true;
+            }
+            case ValueTag::Uint64:
+            {
+                u64 number;
+                if (!reader.Read(number))
+                {
+                    return false;
+                }
+                value.SetUint64(number);
+                return true;
+            }
+            case ValueTag::Double:
+            {
+                double number;
+                if (!reader.Read(number))
+                {
+                    return false;
+                }
+                value.SetDouble(number);
+                return true;
+            }
+            case ValueTag::String:
+            {
+                const char* string;
+                u32 length;
+                if (!reader.ReadString(string, length))
+                {
+                    return false;
+                }
+                value.SetString(string, length, allocator);
+                return true;
+            }
+            case ValueTag::Array:
+            {
+                u32 count;
+                if (!reader.Read(count))
+                {
+                    return false;
+                }
+                // Every element takes at least a tag byte, so a count that doesn't fit in the remaining data is corrupt. This is
+                // checked before reserving so a damaged snapshot can't request an arbitrarily large allocation.
+                if (count > reader.GetRemainingSize())
+                {
+                    return false;
+                }
+                value.SetArray();
+                value.Reserve(count, allocator);
+                for (u32 i = 0; i < count; ++i)
+                {
+                    rapidjson::Value element;
+                    if (!ReadValue(reader, element, allocator, depth + 1))
+                    {
+                        return false;
+                    }
+                    value.PushBack(AZStd::move(element), allocator);
+                }
+                return true;
+            }
+            case ValueTag::Object:
+            {
+                u32 count;
+                if (!reader.Read(count))
+                {
+                    return false;
+                }
+                value.SetObject();
+                for (u32 i = 0; i < count; ++i)
+                {
+                    const char* name;
+                    u32 nameLength;
+                    if (!reader.ReadString(name, nameLength))
+                    {
+                        return false;
+                    }
+                    rapidjson::Value member;
+                    if (!ReadValue(reader, member, allocator, depth + 1))
+                    {
+                        return false;
+                    }
+                    value.AddMember(rapidjson::Value(name, nameLength, allocator), AZStd::move(member), allocator);
+                }
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+    } // namespace Internal
+
+    u64 HashFile(const char* path)
+    {
+        AZ::IO::MemoryMappedFile file;
+        if (file.Map(path))
+        {
+            return static_cast<u64>(TypeHash64(file.GetData(), file.GetSize()));
+        }
+        return AZ::IO::SystemFile::Exists(path) ? Internal::EmptyFileHash : 0;
+    }
+
+    u64 HashFolder(const char* filter)
+    {
+        // The order in which files are found isn't defined, so the hashes of the names are combined in an order independent way.
+        u64 hash = 0;
+        AZ::IO::SystemFile::FindFiles(filter, [&hash](const char* fileName, bool isFile)
+        {
+            if (isFile)
+            {
+                hash += static_cast<u64>(TypeHash64(fileName));
+            }
+            return true;
+        });
+        return hash;
+    }
+
+    u64 HashInput(const Input& input)
+    {
+        return input.m_type == InputType::Folder ? HashFolder(input.m_path.c_str()) : HashFile(input.m_path.c_str());
+    }
+
+    void WriteValue(AZStd::vector<char>& buffer, const rapidjson::Value& value)
+    {
+        using namespace Internal;
+
+        switch (value.GetType())
+        {
+        case rapidjson::kNullType:
+            Append(buffer, ValueTag::Null);
+            break;
+        case rapidjson::kFalseType:
+            Append(buffer, ValueTag::False);
+            break;
+        case rapidjson::kTrueType:
+            Append(buffer, ValueTag::True);
+            break;
+        case rapidjson::kNumberType:
+            if (value.IsDouble())
+            {
+                Append(buffer, ValueTag::Double);
+                Append(buffer, value.GetDouble());
+            }
+            else if (value.IsUint64())
+            {
+                Append(buffer, ValueTag::Uint64);
+                Append(buffer, static_cast<u64>(value.GetUint64()));
+            }
+            else
+            {
+                Append(buffer, ValueTag::Int64);
+                Append(buffer, static_cast<s64>(value.GetInt64()));
+            }
+            break;
+        case rapidjson::kStringType:
+            Append(buffer, ValueTag::String);
+            AppendString(buffer, value.GetString(), value.GetStringLength());
+            break;
+        case rapidjson::kArrayType:
+            Append(buffer, ValueTag::Array);
+            Append(buffer, static_cast<u32>(value.Size()));
+            for (const rapidjson::Value& element : value.GetArray())
+            {
+                WriteValue(buffer, element);
+            }
+            break;
+        case rapidjson::kObjectType:
+            Append(buffer, ValueTag::Object);
+            Append(buffer, static_cast<u32>(value.MemberCount()));
+            for (auto member = value.MemberBegin(); member != value.MemberEnd(); ++member)
+            {
+                AppendString(buffer, member->name.GetString(), member->name.GetStringLength());
+                WriteValue(buffer, member->value);
+            }
+            break;
+        default:
+            AZ_Assert(false, "Unsupported RapidJSON type: %i.", aznumeric_cast<int>(value.GetType()));
+            Append(buffer, ValueTag::Null);
+        }
+    }
+
+    void Write(AZStd::vector<char>& buffer, u64 stateKey, const InputList& inputs, const rapidjson::Value& settings)
+    {
+        using namespace Internal;
+
+        Header header;
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_stateKey = stateKey;
+        header.m_inputCount = aznumeric_caster(inputs.size());
+        header.m_padding = 0;
+        Append(buffer, header);
+
+        for (const Input& input : inputs)
+        {
+            Append(buffer, input.m_type);
+            Append(buffer, input.m_hash);
+            AppendString(buffer, input.m_path.c_str(), aznumeric_caster(input.m_path.size()));
+        }
+
+        WriteValue(buffer, settings);
+    }
+
+    bool Read(rapidjson::Document& settings, const u8* data, u64 size, u64 stateKey)
+    {
+        using namespace Internal;
+
+        Reader reader(data, size);
+        Header header;
+        if (!reader.Read(header) || header.m_magic != Magic || header.m_version != Version || header.m_stateKey != stateKey)
+        {
+            return false;
+        }
+
+        for (u32 i = 0; i < header.m_inputCount; ++i)
+        {
+            Input input;
+            const char* path;
+            u32 pathLength;
+            if (!reader.Read(input.m_type) || !reader.Read(input.m_hash) || !reader.ReadString(path, pathLength) ||
+                pathLength > input.m_path.max_size())
+            {
+                return false;
+            }
+            input.m_path.assign(path, pathLength);
+            if (HashInput(input) != input.m_hash)
+            {
+                return false;
+            }
+        }
+
+        return ReadValue(reader, settings, settings.GetAllocator(), 0);
+    }
+} // namespace AZ::SettingsRegistrySnapshot
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/std/containers/vector.h>
+
+//! Binary snapshots of the Settings Registry.
+//! A snapshot stores the settings in a compact binary encoding together with the registry files and folders that were
+//! merged to create them. Restoring a snapshot only copies the values back into a document, which avoids parsing the
+//! registry files and applying them as patches. A snapshot is only restored if it was created from the same registry
+//! state and none of its input files or folders changed since.
+namespace AZ::SettingsRegistrySnapshot
+{
+    inline static constexpr u32 Magic = 0x4E535253; // "SRSN"
+    inline static constexpr u32 Version = 1;
+
+    enum class InputType : u8
+    {
+        File,
+        Folder
+    };
+
+    //! A registry file or folder the snapshot depends on, with the hash of its content at the time the snapshot was created.
+    //! For folders the hash covers the names of the files in the folder, so added or removed registry files are detected.
+    struct Input
+    {
+        AZ::IO::FixedMaxPathString m_path;
+        u64 m_hash{ 0 };
+        InputType m_type{ InputType::File };
+    };
+    using InputList = AZStd::vector<Input>;
+
+    //! Hashes the content of a file. Returns 0 if the file doesn't exist.
+    u64 HashFile(const char* path);
+    //! Hashes the names of the files matching the filter, for instance "<folder>/*". Returns 0 if no files match.
+    u64 HashFolder(const char* filter);
+    //! Returns the hash of the input's file or folder as it is now.
+    u64 HashInput(const Input& input);
+
+    //! Appends the binary encoding of a JSON value to the buffer.
+    void WriteValue(AZStd::vector<char>& buffer, const rapidjson::Value& value);
+    //! Creates a snapshot of the settings in the buffer.
+    //! @param stateKey Identifies the state of the registry before the inputs were merged.
+    void Write(AZStd::vector<char>& buffer, u64 stateKey, const InputList& inputs, const rapidjson::Value& settings);
+    //! Restores the settings from a snapshot.
+    //! @return False if the data isn't a valid snapshot, was created with a different state key or one of its inputs changed.
+    bool Read(rapidjson::Document& settings, const u8* data, u64 size, u64 stateKey);
+} // namespace AZ::SettingsRegistrySnapshot
@@ -56,6 +56,8 @@ set(FILES
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
     Component/TickBus.h
+    Component/TickDispatcher.cpp
+    Component/TickDispatcher.h
     Component/TransformBus.h
     Console/Console.cpp
     Console/Console.h
@@ -107,6 +109,8 @@ set(FILES
     Debug/ProfilerDriller.h
     Debug/ProfilerDrillerBus.h
     Debug/StackTracer.h
+    Debug/EBusProfiler.cpp
+    Debug/EBusProfiler.h
     Debug/EventTrace.h
     Debug/EventTrace.cpp
     Debug/EventTraceDriller.h
@@ -149,6 +153,7 @@ set(FILES
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
+    EBus/Internal/DispatchProfiler.h
     EBus/Internal/Handlers.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
@@ -192,6 +197,10 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/MemoryMappedFile.h
+    IO/Streamer/MemoryMappedFile.cpp
+    IO/Streamer/MemoryMappedReader.h
+    IO/Streamer/MemoryMappedReader.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -210,6 +219,8 @@ set(FILES
     IO/Streamer/StreamerContext.cpp
     IO/Streamer/StreamerComponent.cpp
     IO/Streamer/StreamerComponent.h
+    IO/Streamer/StreamerTrace.h
+    IO/Streamer/StreamerTrace.cpp
     IO/Streamer/StreamStackEntry.h
     IO/Streamer/StreamStackEntry.cpp
     IPC/SharedMemory.cpp
@@ -220,6 +231,7 @@ set(FILES
     Jobs/Internal/JobManagerWorkStealing.cpp
     Jobs/Internal/JobManagerWorkStealing.h
     Jobs/Internal/JobNotify.h
+    Jobs/Internal/WorkStealingDeque.h
     Jobs/Job.h
     Jobs/JobCancelGroup.h
     Jobs/JobCompletion.h
@@ -234,6 +246,7 @@ set(FILES
     Jobs/JobManagerComponent.cpp
     Jobs/JobManagerComponent.h
     Jobs/JobManagerDesc.h
+    Jobs/JobManagerTelemetry.h
     Jobs/LegacyJobExecutor.h
     Jobs/MultipleDependentJob.h
     Jobs/task_group.h
@@ -371,6 +384,9 @@ set(FILES
     Memory/BestFitExternalMapSchema.cpp
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
+    Memory/FrameArenaAllocator.h
+    Memory/FrameArenaSchema.cpp
+    Memory/FrameArenaSchema.h
     Memory/dlmalloc.inl
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
@@ -419,6 +435,8 @@ set(FILES
     Name/NameDictionary.cpp
     Name/NameJsonSerializer.h
     Name/NameJsonSerializer.cpp
+    Name/NameLiteral.h
+    Name/NameLiteral.cpp
     Name/NameSerializer.h
     Name/NameSerializer.cpp
     Name/Internal/NameData.h
@@ -514,6 +532,8 @@ set(FILES
     Serialization/Json/JsonDeserializer.cpp
     Serialization/Json/JsonMerger.h
     Serialization/Json/JsonMerger.cpp
+    Serialization/Json/JsonParallelLoader.h
+    Serialization/Json/JsonParallelLoader.cpp
     Serialization/Json/JsonSerialization.h
     Serialization/Json/JsonSerialization.cpp
     Serialization/Json/JsonSerializationMetadata.h
@@ -555,6 +575,8 @@ set(FILES
     Settings/SettingsRegistryMergeUtils.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     State/HSM.cpp
     State/HSM.h
     Statistics/NamedRunningStatistic.h
@@ -85,10 +85,10 @@ namespace AZStd
         {
         }
 
-        intrusive_ptr(T* p)
+        intrusive_ptr(T* p, bool add_ref = true)
             : px(p)
         {
-            if (px != 0)
+            if (px != 0 && add_ref)
             {
                 CountPolicy::add_ref(px);
             }
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::Map(const char* absolutePath)
+    {
+        AZ_Assert(!IsMapped(), "MemoryMappedFile is already mapping a file.");
+
+        int file = open(absolutePath, O_RDONLY | O_CLOEXEC);
+        if (file < 0)
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if (fstat(file, &fileStats) != 0 || fileStats.st_size <= 0)
+        {
+            close(file);
+            return false;
+        }
+
+        size_t size = aznumeric_cast<size_t>(fileStats.st_size);
+        void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+        // The mapping keeps a reference to the file so the descriptor is no longer needed.
+        close(file);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = size;
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<u8*>(m_data), aznumeric_cast<size_t>(m_size));
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/MemoryMappedFile.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    bool MemoryMappedFile::Map(const char* absolutePath)
+    {
+        AZ_Assert(!IsMapped(), "MemoryMappedFile is already mapping a file.");
+
+        HANDLE file = INVALID_HANDLE_VALUE;
+#ifdef _UNICODE
+        wchar_t fileNameW[AZ_MAX_PATH_LEN];
+        size_t numCharsConverted;
+        if (mbstowcs_s(&numCharsConverted, fileNameW, absolutePath, AZ_ARRAY_SIZE(fileNameW) - 1) == 0)
+        {
+            file = CreateFileW(fileNameW, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        }
+#else // !_UNICODE
+        file = CreateFileA(absolutePath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+#endif // !_UNICODE
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!::GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+        {
+            ::CloseHandle(file);
+            return false;
+        }
+
+        HANDLE mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        // The mapping object keeps a reference to the file so the handle is no longer needed.
+        ::CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        // The view keeps a reference to the mapping object so the handle is no longer needed.
+        ::CloseHandle(mapping);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        m_data = reinterpret_cast<const u8*>(data);
+        m_size = aznumeric_cast<u64>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::Unmap()
+    {
+        if (m_data)
+        {
+            ::UnmapViewOfFile(m_data);
+            m_data = nullptr;
+            m_size = 0;
+        }
+    }
+} // namespace AZ::IO
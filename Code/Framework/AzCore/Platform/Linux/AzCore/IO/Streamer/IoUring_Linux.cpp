@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    namespace IoUringInternal
+    {
+        // The ring indices are shared with the kernel, so they're accessed with explicit memory ordering.
+        static u32 LoadAcquire(const u32* value)
+        {
+            return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+        }
+
+        static void StoreRelease(u32* value, u32 newValue)
+        {
+            __atomic_store_n(value, newValue, __ATOMIC_RELEASE);
+        }
+
+        template<typename T>
+        static T* Offset(void* base, u32 offset)
+        {
+            return reinterpret_cast<T*>(reinterpret_cast<u8*>(base) + offset);
+        }
+    } // namespace IoUringInternal
+
+    IoUring::~IoUring()
+    {
+        Shutdown();
+    }
+
+    bool IoUring::IsSupported()
+    {
+        static const bool isSupported = []()
+        {
+            io_uring_params params{};
+            int ringFd = Setup(1, params);
+            if (ringFd >= 0)
+            {
+                close(ringFd);
+                return true;
+            }
+            return false;
+        }();
+        return isSupported;
+    }
+
+    int IoUring::Setup(u32 entries, io_uring_params& params)
+    {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    }
+
+    bool IoUring::Initialize(u32 entries)
+    {
+        using namespace IoUringInternal;
+
+        AZ_Assert(!IsInitialized(), "IoUring has already been initialized.");
+
+        io_uring_params params{};
+        m_ringFd = Setup(entries, params);
+        if (m_ringFd < 0)
+        {
+            AZ_Warning("IoUring", false, "Unable to create an io_uring instance (Error: %i).\n", errno);
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        void* sqes = mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQES);
+        if (sqes == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_sqes = reinterpret_cast<io_uring_sqe*>(sqes);
+
+        m_submissionHead = Offset<u32>(m_submissionRing, params.sq_off.head);
+        m_submissionTail = Offset<u32>(m_submissionRing, params.sq_off.tail);
+        m_submissionArray = Offset<u32>(m_submissionRing, params.sq_off.array);
+        m_submissionMask = *Offset<u32>(m_submissionRing, params.sq_off.ring_mask);
+        m_completionHead = Offset<u32>(m_completionRing, params.cq_off.head);
+        m_completionTail = Offset<u32>(m_completionRing, params.cq_off.tail);
+        m_completionMask = *Offset<u32>(m_completionRing, params.cq_off.ring_mask);
+        m_cqes = Offset<io_uring_cqe>(m_completionRing, params.cq_off.cqes);
+        m_numEntries = params.sq_entries;
+
+        m_localHead = LoadAcquire(m_submissionTail);
+        m_localTail = m_localHead;
+        return true;
+    }
+
+    void IoUring::Shutdown()
+    {
+        if (m_sqes)
+        {
+            munmap(m_sqes, m_numEntries * sizeof(io_uring_sqe));
+            m_sqes = nullptr;
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            munmap(m_completionRing, m_completionRingSize);
+        }
+        m_completionRing = nullptr;
+        if (m_submissionRing)
+        {
+            munmap(m_submissionRing, m_submissionRingSize);
+            m_submissionRing = nullptr;
+        }
+        if (m_ringFd >= 0)
+        {
+            // Closing the ring cancels any outstanding requests and releases registered buffers and events.
+            close(m_ringFd);
+            m_ringFd = -1;
+        }
+        m_cqes = nullptr;
+        m_numEntries = 0;
+    }
+
+    bool IoUring::IsInitialized() const
+    {
+        return m_ringFd >= 0;
+    }
+
+    u32 IoUring::GetNumEntries() const
+    {
+        return m_numEntries;
+    }
+
+    io_uring_sqe* IoUring::GetSubmissionEntry()
+    {
+        const u32 head = IoUringInternal::LoadAcquire(m_submissionHead);
+        if (m_localTail - head >= m_numEntries)
+        {
+            return nullptr;
+        }
+
+        io_uring_sqe* entry = &m_sqes[m_localTail & m_submissionMask];
+        ++m_localTail;
+        memset(entry, 0, sizeof(io_uring_sqe));
+        return entry;
+    }
+
+    int IoUring::Submit()
+    {
+        using namespace IoUringInternal;
+
+        // The submission entries are handed out in order, so the indirection array maps one to one.
+        u32 tail = *m_submissionTail;
+        for (; m_localHead != m_localTail; ++m_localHead, ++tail)
+        {
+            m_submissionArray[tail & m_submissionMask] = m_localHead & m_submissionMask;
+        }
+        StoreRelease(m_submissionTail, tail);
+
+        // Include entries that were published before but not consumed, for instance because the kernel returned EBUSY.
+        const u32 toSubmit = tail - LoadAcquire(m_submissionHead);
+        if (toSubmit == 0)
+        {
+            return 0;
+        }
+
+        int result;
+        do
+        {
+            result = static_cast<int>(syscall(__NR_io_uring_enter, m_ringFd, toSubmit, 0, 0, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+        return result < 0 ? -errno : result;
+    }
+
+    u32 IoUring::GetNumUnsubmitted() const
+    {
+        return (m_localTail - m_localHead) + (*m_submissionTail - IoUringInternal::LoadAcquire(m_submissionHead));
+    }
+
+    io_uring_cqe* IoUring::PeekCompletion()
+    {
+        // Only this thread moves the completion head, so it doesn't need to be synchronized.
+        const u32 head = *m_completionHead;
+        if (head == IoUringInternal::LoadAcquire(m_completionTail))
+        {
+            return nullptr;
+        }
+        return &m_cqes[head & m_completionMask];
+    }
+
+    void IoUring::AdvanceCompletion()
+    {
+        IoUringInternal::StoreRelease(m_completionHead, *m_completionHead + 1);
+    }
+
+    bool IoUring::RegisterBuffers(const iovec* buffers, u32 count)
+    {
+        return syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_BUFFERS, buffers, count) == 0;
+    }
+
+    bool IoUring::RegisterEventFd(int eventFd)
+    {
+        return syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_EVENTFD, &eventFd, 1) == 0;
+    }
+
+    void IoUring::UnregisterEventFd()
+    {
+        syscall(__NR_io_uring_register, m_ringFd, IORING_UNREGISTER_EVENTFD, nullptr, 0);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <linux/io_uring.h>
+
+struct iovec;
+
+namespace AZ::IO
+{
+    //! Minimal wrapper around a Linux io_uring instance. The rings are set up directly through the io_uring system calls so
+    //! there's no dependency on liburing. The ring is not thread safe and is expected to be used from a single thread, which
+    //! for Streamer is the scheduler thread.
+    class IoUring
+    {
+    public:
+        IoUring() = default;
+        ~IoUring();
+
+        IoUring(const IoUring&) = delete;
+        IoUring& operator=(const IoUring&) = delete;
+
+        //! Returns true if the kernel supports io_uring. The result is determined once and cached.
+        static bool IsSupported();
+
+        //! Creates the submission and completion rings with room for at least the given number of entries.
+        bool Initialize(u32 entries);
+        void Shutdown();
+        bool IsInitialized() const;
+        //! The number of submission entries the kernel created, which can be more than was requested.
+        u32 GetNumEntries() const;
+
+        //! Returns a cleared submission entry or null if the submission ring is full. The entry will be send to the kernel
+        //! on the next call to Submit.
+        io_uring_sqe* GetSubmissionEntry();
+        //! Submits all entries retrieved with GetSubmissionEntry since the last call.
+        //! Returns the number of submitted entries or a negative error code.
+        int Submit();
+        //! Returns the number of entries that have been retrieved but not submitted yet.
+        u32 GetNumUnsubmitted() const;
+
+        //! Retrieves the oldest completion without removing it from the completion ring. Returns null if there are no completions.
+        io_uring_cqe* PeekCompletion();
+        //! Removes the oldest completion from the ring after it has been processed.
+        void AdvanceCompletion();
+
+        //! Registers a set of buffers with the kernel that can be used with IORING_OP_READ_FIXED.
+        bool RegisterBuffers(const iovec* buffers, u32 count);
+        //! Registers an eventfd that is signaled whenever a completion is posted.
+        bool RegisterEventFd(int eventFd);
+        void UnregisterEventFd();
+
+    private:
+        static int Setup(u32 entries, io_uring_params& params);
+
+        io_uring_sqe* m_sqes{ nullptr };
+        io_uring_cqe* m_cqes{ nullptr };
+        void* m_submissionRing{ nullptr };
+        void* m_completionRing{ nullptr };
+        size_t m_submissionRingSize{ 0 };
+        size_t m_completionRingSize{ 0 };
+
+        u32* m_submissionHead{ nullptr };
+        u32* m_submissionTail{ nullptr };
+        u32* m_submissionArray{ nullptr };
+        u32* m_completionHead{ nullptr };
+        u32* m_completionTail{ nullptr };
+        u32 m_submissionMask{ 0 };
+        u32 m_completionMask{ 0 };
+        u32 m_numEntries{ 0 };
+
+        u32 m_localHead{ 0 }; //!< First entry that has been retrieved but not yet been pushed to the kernel.
+        u32 m_localTail{ 0 }; //!< Next entry to hand out with GetSubmissionEntry.
+
+        int m_ringFd{ -1 };
+    };
+} // namespace AZ::IO
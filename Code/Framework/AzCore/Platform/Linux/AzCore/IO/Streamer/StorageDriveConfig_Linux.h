@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxStorageDriveConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxStorageDriveConfig, "{9A4F0C55-6E1D-4C8B-A3D2-3B7E5F1C8D04}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxStorageDriveConfig, SystemAllocator, 0);
+
+        ~LinuxStorageDriveConfig() override = default;
+        //! Adds a StorageDriveLinux to the stack. If io_uring isn't available, for instance because the kernel is too old or
+        //! io_uring is blocked by the sandbox, the regular StorageDrive is added instead.
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxFileHandles{ 32 };
+        AZ::u32 m_maxMetaDataCache{ 32 };
+        AZ::u32 m_queueDepth{ 0 }; //!< Zero uses the queue depth reported by the device.
+        AZ::s32 m_overcommit{ 8 };
+        AZ::u32 m_registeredBufferSizeKib{ 64 };
+        bool m_enableDirectReads{ true };
+        bool m_minimalReporting{ false };
+    };
+} // namespace AZ::IO
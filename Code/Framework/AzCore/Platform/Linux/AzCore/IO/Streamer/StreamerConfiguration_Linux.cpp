@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/std/string/conversions.h>
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    static bool ReadQueueValue(const char* devicePath, const char* property, AZ::u64& value)
+    {
+        // Partitions don't have their own queue information, it's stored with the parent disk.
+        constexpr const char* queueFolders[] = { "queue", "../queue" };
+        for (const char* queueFolder : queueFolders)
+        {
+            AZStd::string path = AZStd::string::format("%s/%s/%s", devicePath, queueFolder, property);
+            if (FILE* file = fopen(path.c_str(), "r"); file != nullptr)
+            {
+                unsigned long long result = 0;
+                bool success = fscanf(file, "%llu", &result) == 1;
+                fclose(file);
+                if (success)
+                {
+                    value = result;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool reportHardware)
+    {
+        // Assets are read relative to the working directory, so use the device that holds it. Virtual devices, such as
+        // the overlay file systems used by containers, don't have a block device and use the defaults.
+        struct stat attributes;
+        if (stat(".", &attributes) != 0 || major(attributes.st_dev) == 0)
+        {
+            return false;
+        }
+
+        AZStd::string devicePath = AZStd::string::format("/sys/dev/block/%u:%u", major(attributes.st_dev), minor(attributes.st_dev));
+
+        DriveInformation info;
+        AZ::u64 value = 0;
+        if (!ReadQueueValue(devicePath.c_str(), "logical_block_size", value) || !IStreamerTypes::IsPowerOf2(value))
+        {
+            return false;
+        }
+        info.m_logicalSectorSize = aznumeric_caster(value);
+        info.m_physicalSectorSize = ReadQueueValue(devicePath.c_str(), "physical_block_size", value) && IStreamerTypes::IsPowerOf2(value)
+            ? aznumeric_caster(value) : info.m_logicalSectorSize;
+        info.m_maxTransfer = ReadQueueValue(devicePath.c_str(), "max_sectors_kb", value) ? aznumeric_caster(value * 1_kib) : 512_kib;
+        info.m_ioChannelCount = ReadQueueValue(devicePath.c_str(), "nr_requests", value) ? aznumeric_caster(value) : 0;
+        info.m_hasSeekPenalty = ReadQueueValue(devicePath.c_str(), "rotational", value) ? value != 0 : true;
+        info.m_profile = info.m_hasSeekPenalty ? "Hdd" : "Ssd";
+        info.m_deviceName = devicePath;
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "Drive '%s':\n"
+                "    Type: %s\n"
+                "    Physical sector size: %zu\n"
+                "    Logical sector size: %zu\n"
+                "    Max transfer: %zu kb\n"
+                "    Queue depth: %u\n",
+                info.m_deviceName.c_str(), info.m_profile.c_str(), info.m_physicalSectorSize, info.m_logicalSectorSize,
+                info.m_maxTransfer / 1_kib, info.m_ioChannelCount);
+        }
+
+        long pageSize = sysconf(_SC_PAGESIZE);
+        hardwareInfo.m_maxPageSize = pageSize > 0 ? aznumeric_cast<size_t>(pageSize) : 4096;
+        hardwareInfo.m_maxTransfer = info.m_maxTransfer;
+        hardwareInfo.m_maxPhysicalSectorSize = info.m_physicalSectorSize;
+        hardwareInfo.m_maxLogicalSectorSize = info.m_logicalSectorSize;
+        hardwareInfo.m_profile = "Generic";
+        hardwareInfo.m_platformData = AZStd::make_any<DriveInformation>(AZStd::move(info));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+    }
+} // namespace AZ::IO
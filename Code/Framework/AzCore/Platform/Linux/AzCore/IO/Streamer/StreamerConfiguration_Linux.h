@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO
+{
+    //! Information about the block device that holds the application's working directory, as reported by sysfs.
+    struct DriveInformation
+    {
+        AZ_TYPE_INFO(AZ::IO::DriveInformation, "{5C0E3B8A-27D4-4F61-9E0B-8A1F6D2C4E73}");
+
+        AZStd::string m_deviceName;
+        AZStd::string m_profile;
+        size_t m_physicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_logicalSectorSize{ AZCORE_GLOBAL_NEW_ALIGNMENT };
+        size_t m_maxTransfer{ 0 };
+        u32 m_ioChannelCount{ 0 };
+        bool m_hasSeekPenalty{ true };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Puts the scheduler thread to sleep until either an external wake up call is made or one of the event handles
+    //! that the Streamer's internals have created is signaled. Event handles are eventfd descriptors, which allows
+    //! them to be registered with the kernel (e.g. io_uring) so asynchronous completions can wake up the scheduler thread.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 63;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Creates a non-blocking eventfd that will wake up the scheduler thread when signaled.
+        //! Returns -1 if no more events are available or the event couldn't be created.
+        int CreateEventHandle();
+        //! Closes an event previously created with CreateEventHandle.
+        void DestroyEventHandle(int event);
+        size_t GetEventHandleCount() const;
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // Note: The first event handle is reserved for the synchronization of the
+        // scheduler thread with the rest of the engine. The remaining event handles
+        // can be freely used by Streamer's internals.
+        int m_events[MaxIoEvents + 1];
+        size_t m_handleCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/EBusProfiler.h>
+#include <AzCore/EBus/EBus.h>
+#include <AzCore/EBus/Event.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class ProfiledRequests
+        : public EBusTraits
+    {
+    public:
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ById;
+        using BusIdType = int;
+
+        virtual void Update() = 0;
+        virtual void Forward() = 0;
+    };
+    using ProfiledRequestBus = EBus<ProfiledRequests>;
+
+    class ProfiledHandler
+        : public ProfiledRequestBus::Handler
+    {
+    public:
+        void Update() override
+        {
+            ++m_numUpdates;
+        }
+
+        void Forward() override
+        {
+            ProfiledRequestBus::Broadcast(&ProfiledRequests::Update);
+        }
+
+        int m_numUpdates = 0;
+    };
+
+    class EBusProfilerTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            Debug::EBusProfiler::Reset();
+            Debug::EBusProfiler::Start();
+        }
+
+        void TearDown() override
+        {
+            Debug::EBusProfiler::Stop();
+            Debug::EBusProfiler::Reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        static const Debug::EBusDispatchStats* FindStats(
+            const AZStd::vector<Debug::EBusDispatchStats>& stats, const char* busName, AZ::u64 numDispatches)
+        {
+            for (const Debug::EBusDispatchStats& entry : stats)
+            {
+                if (entry.m_busName.find(busName) != AZStd::string::npos && entry.GetNumDispatches() == numDispatches)
+                {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+    };
+
+#if AZ_EBUS_PROFILER_ENABLED
+    TEST_F(EBusProfilerTests, Dispatch_ProfilerRunning_CountsDispatchesAndHandlers)
+    {
+        ProfiledHandler handlers[4];
+        for (int i = 0; i < 4; ++i)
+        {
+            handlers[i].BusConnect(i % 2);
+        }
+
+        for (int i = 0; i < 3; ++i)
+        {
+            ProfiledRequestBus::Broadcast(&ProfiledRequests::Update);
+        }
+        ProfiledRequestBus::Event(1, &ProfiledRequests::Update);
+
+        AZStd::vector<Debug::EBusDispatchStats> stats = Debug::EBusProfiler::GetStats();
+        const Debug::EBusDispatchStats* updateStats = FindStats(stats, "ProfiledRequests", 4);
+        ASSERT_NE(nullptr, updateStats);
+        EXPECT_EQ(3, updateStats->m_numBroadcasts);
+        EXPECT_EQ(1, updateStats->m_numEvents);
+        EXPECT_EQ(3 * 4 + 2, updateStats->m_numHandlersVisited);
+        EXPECT_GE(updateStats->m_totalTimeUs, updateStats->m_selfTimeUs);
+    }
+
+    TEST_F(EBusProfilerTests, Dispatch_DifferentEvents_RecordedSeparately)
+    {
+        ProfiledHandler handler;
+        handler.BusConnect(0);
+
+        ProfiledRequestBus::Event(0, &ProfiledRequests::Forward);
+
+        AZStd::vector<Debug::EBusDispatchStats> stats = Debug::EBusProfiler::GetStats();
+        AZStd::erase_if(stats, [](const Debug::EBusDispatchStats& entry) { return entry.m_busName.find("ProfiledRequests") == AZStd::string::npos; });
+        ASSERT_EQ(2, stats.size());
+        EXPECT_NE(stats[0].m_eventName, stats[1].m_eventName);
+        for (const Debug::EBusDispatchStats& entry : stats)
+        {
+            EXPECT_EQ(1, entry.GetNumDispatches());
+            EXPECT_EQ(1, entry.m_numHandlersVisited);
+        }
+    }
+
+    TEST_F(EBusProfilerTests, EnumerateHandlers_StoppedEarly_CountsOnlyVisitedHandlers)
+    {
+        ProfiledHandler handlers[3];
+        for (ProfiledHandler& handler : handlers)
+        {
+            handler.BusConnect(0);
+        }
+
+        int numVisited = 0;
+        ProfiledRequestBus::EnumerateHandlersId(0, [&numVisited](ProfiledRequests*)
+            {
+                return ++numVisited < 2;
+            });
+
+        AZStd::vector<Debug::EBusDispatchStats> stats = Debug::EBusProfiler::GetStats();
+        const Debug::EBusDispatchStats* enumerateStats = FindStats(stats, "ProfiledRequests", 1);
+        ASSERT_NE(nullptr, enumerateStats);
+        EXPECT_EQ(1, enumerateStats->m_numEnumerations);
+        EXPECT_EQ(2, enumerateStats->m_numHandlersVisited);
+    }
+
+    TEST_F(EBusProfilerTests, Signal_ProfilerRunning_CountsSignalsAndHandlers)
+    {
+        AZ::Event<int> event;
+        int sum = 0;
+        AZ::Event<int>::Handler first([&sum](int value) { sum += value; });
+        AZ::Event<int>::Handler second([&sum](int value) { sum += value; });
+        first.Connect(event);
+        second.Connect(event);
+
+        event.Signal(1);
+        event.Signal(2);
+
+        AZStd::vector<Debug::EBusDispatchStats> stats = Debug::EBusProfiler::GetStats();
+        const Debug::EBusDispatchStats* signalStats = FindStats(stats, "Event", 2);
+        ASSERT_NE(nullptr, signalStats);
+        EXPECT_EQ(2, signalStats->m_numBroadcasts);
+        EXPECT_EQ(4, signalStats->m_numHandlersVisited);
+        EXPECT_EQ(6, sum);
+    }
+#endif // AZ_EBUS_PROFILER_ENABLED
+
+    TEST_F(EBusProfilerTests, Dispatch_ProfilerStopped_NothingRecorded)
+    {
+        Debug::EBusProfiler::Stop();
+
+        ProfiledHandler handler;
+        handler.BusConnect(0);
+        ProfiledRequestBus::Broadcast(&ProfiledRequests::Update);
+
+        EXPECT_EQ(1, handler.m_numUpdates);
+        EXPECT_TRUE(Debug::EBusProfiler::GetStats().empty());
+    }
+
+    TEST_F(EBusProfilerTests, Reset_AfterDispatch_ClearsStats)
+    {
+        ProfiledHandler handler;
+        handler.BusConnect(0);
+        ProfiledRequestBus::Broadcast(&ProfiledRequests::Update);
+
+        Debug::EBusProfiler::Reset();
+        EXPECT_TRUE(Debug::EBusProfiler::GetStats().empty());
+    }
+} // namespace UnitTest
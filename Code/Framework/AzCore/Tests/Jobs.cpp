@@ -13,6 +13,7 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/Jobs/Algorithms.h>
+#include <AzCore/Jobs/Internal/WorkStealingDeque.h>
 #include <AzCore/std/delegate/delegate.h>
 #include <AzCore/std/bind/bind.h>
 
@@ -22,11 +23,13 @@
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_list.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
 
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/time.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/UnitTest/TestTypes.h>
@@ -1651,6 +1654,308 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class JobLaneTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobLaneTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize job execution
+        {
+        }
+
+    protected:
+        // Starts a job that doesn't complete until the semaphore is released, see JobPriorityTestFixture
+        void StartJob(const char* name, JobLane lane, JobContext* context = nullptr)
+        {
+            Job* job = aznew TestJobWithPriority(0, name, context ? context : m_jobContext, m_binarySemaphore, m_namesOfProcessedJobs);
+            job->SetLane(lane);
+            job->Start();
+        }
+
+        void WaitForJobs()
+        {
+            m_binarySemaphore.release();
+            while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+        }
+
+        AZStd::binary_semaphore m_binarySemaphore;
+        AZStd::vector<AZStd::string> m_namesOfProcessedJobs;
+    };
+
+    TEST_F(JobLaneTestFixture, StartJobs_DifferentLanes_HigherLanesRunFirst)
+    {
+        JobContext backgroundContext(*m_jobManager);
+        backgroundContext.SetLane(JobLane::Background);
+
+        // the first job blocks the only worker until all the other jobs are queued
+        StartJob("FirstJobQueued", JobLane::Critical);
+        StartJob("Background1", JobLane::Background);
+        StartJob("Frame1", JobLane::Frame);
+        StartJob("Critical1", JobLane::Critical);
+        StartJob("BackgroundContext", JobLane::Inherit, &backgroundContext);
+        StartJob("Frame2", JobLane::Inherit);
+        StartJob("Critical2", JobLane::Critical);
+        WaitForJobs();
+
+        const AZStd::vector<AZStd::string> expectedOrder = { "FirstJobQueued", "Critical1", "Critical2", "Frame1", "Frame2", "Background1", "BackgroundContext" };
+        EXPECT_EQ(m_namesOfProcessedJobs, expectedOrder);
+    }
+
+    TEST_F(JobLaneTestFixture, StartJobs_SaturatedHigherLanes_BackgroundJobIsNotStarved)
+    {
+        const unsigned int starvationLimit = JobManagerDesc().m_backgroundLaneStarvationLimit;
+        ASSERT_GT(starvationLimit, 0u);
+
+        StartJob("FirstJobQueued", JobLane::Critical);
+        StartJob("Background", JobLane::Background);
+        for (unsigned int i = 0; i < starvationLimit * 2; ++i)
+        {
+            StartJob("Frame", JobLane::Frame);
+        }
+        WaitForJobs();
+
+        // the background job runs once the worker ran starvationLimit jobs from the other lanes in a row, including the first job
+        ASSERT_EQ(m_namesOfProcessedJobs.size(), starvationLimit * 2 + 2);
+        EXPECT_EQ(m_namesOfProcessedJobs[starvationLimit], "Background");
+    }
+
+    class WorkStealingDequeTest
+        : public AllocatorsTestFixture
+    {
+    };
+
+    TEST_F(WorkStealingDequeTest, PushAndSteal_SingleThread_ElementsComeOutInPushOrder)
+    {
+        // start small so the ring buffer has to grow
+        AZ::Internal::WorkStealingDeque<AZ::u32> deque(4);
+        EXPECT_TRUE(deque.IsEmpty());
+
+        for (AZ::u32 i = 0; i < 100; ++i)
+        {
+            deque.Push(i);
+        }
+        EXPECT_FALSE(deque.IsEmpty());
+
+        for (AZ::u32 i = 0; i < 100; ++i)
+        {
+            AZ::u32 value = 0;
+            ASSERT_TRUE(deque.Steal(value));
+            EXPECT_EQ(i, value);
+        }
+
+        AZ::u32 value = 0;
+        EXPECT_FALSE(deque.Steal(value));
+        EXPECT_TRUE(deque.IsEmpty());
+        deque.CollectGarbage();
+    }
+
+    TEST_F(WorkStealingDequeTest, PushAndSteal_ConcurrentThieves_EveryElementTakenOnce)
+    {
+        constexpr AZ::u32 numElements = 100000;
+        constexpr AZ::u32 numThieves = 4;
+
+        AZ::Internal::WorkStealingDeque<AZ::u32> deque(8);
+        AZStd::vector<AZStd::atomic<AZ::u32>> timesTaken(numElements);
+        AZStd::atomic<AZ::u32> numTaken{ 0 };
+
+        auto takeElements = [&deque, &timesTaken, &numTaken]()
+        {
+            while (numTaken.load() < numElements)
+            {
+                AZ::u32 value = 0;
+                if (deque.Steal(value))
+                {
+                    timesTaken[value].fetch_add(1);
+                    numTaken.fetch_add(1);
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> thieves;
+        for (AZ::u32 i = 0; i < numThieves; ++i)
+        {
+            thieves.emplace_back(takeElements);
+        }
+
+        // the owner keeps some of its own work, like a worker does
+        for (AZ::u32 i = 0; i < numElements; ++i)
+        {
+            deque.Push(i);
+            if ((i % 3) == 0)
+            {
+                AZ::u32 value = 0;
+                if (deque.Steal(value))
+                {
+                    timesTaken[value].fetch_add(1);
+                    numTaken.fetch_add(1);
+                }
+            }
+        }
+
+        for (AZStd::thread& thief : thieves)
+        {
+            thief.join();
+        }
+
+        EXPECT_TRUE(deque.IsEmpty());
+        for (AZ::u32 i = 0; i < numElements; ++i)
+        {
+            EXPECT_EQ(1, timesTaken[i].load());
+        }
+    }
+
+    class JobWorkerParkingTest
+        : public DefaultJobManagerSetupFixture
+    {
+    public:
+        static constexpr AZ::u32 NumIterations = 2000;
+        static constexpr AZ::u32 MaxGapMicroseconds = 100; // twice the default worker spin time
+
+        JobWorkerParkingTest() : DefaultJobManagerSetupFixture(4)
+        {
+        }
+
+    protected:
+        // Shared with the jobs, so a job that is picked up after the test gave up on it doesn't touch a dead stack frame
+        struct JobFlags
+        {
+            AZStd::atomic<bool> m_childRan{ false };
+            AZStd::atomic<bool> m_childWasStolen{ false };
+            AZStd::atomic<bool> m_parentDone{ false };
+        };
+
+        // Waits until the flag is set, returns false if that takes longer than any job should ever wait for a worker
+        static bool WaitForFlag(const AZStd::atomic<bool>& flag)
+        {
+            const AZStd::chrono::system_clock::time_point timeout = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(1);
+            while (!flag.load(AZStd::memory_order_acquire))
+            {
+                if (AZStd::chrono::system_clock::now() > timeout)
+                {
+                    return false;
+                }
+                AZStd::this_thread::yield();
+            }
+            return true;
+        }
+
+        static void BusyWait(AZ::u32 microseconds)
+        {
+            const AZStd::sys_time_t end = AZStd::GetTimeNowTicks() + microseconds * AZStd::GetTimeTicksPerSecond() / 1000000;
+            while (AZStd::GetTimeNowTicks() < end)
+            {
+                AZStd::this_thread::pause(8);
+            }
+        }
+
+        // A random time around the worker spin time, so the next job races workers that are giving up spinning,
+        // announcing they are available or parking
+        AZ::u32 GetRandomGap()
+        {
+            return m_random.GetRandom() % (MaxGapMicroseconds + 1);
+        }
+
+        AZ::SimpleLcgRandom m_random;
+    };
+
+    TEST_F(JobWorkerParkingTest, StartJob_GlobalJobWhileWorkersPark_JobRunsWithinBoundedTime)
+    {
+        for (AZ::u32 i = 0; i < NumIterations; ++i)
+        {
+            BusyWait(GetRandomGap());
+
+            AZStd::shared_ptr<JobFlags> flags = AZStd::make_shared<JobFlags>();
+            Job* job = CreateJobFunction([flags]() { flags->m_parentDone.store(true, AZStd::memory_order_release); }, true, m_jobContext);
+            job->Start();
+            ASSERT_TRUE(WaitForFlag(flags->m_parentDone)) << "global job " << i << " was not picked up by any worker";
+        }
+    }
+
+    TEST_F(JobWorkerParkingTest, StartJob_StealableJobWhileWorkersPark_JobRunsWithinBoundedTime)
+    {
+        for (AZ::u32 i = 0; i < NumIterations; ++i)
+        {
+            BusyWait(GetRandomGap());
+
+            // the parent queues the child in its worker's local queue and keeps that worker busy until the child ran,
+            // so the child only runs if another worker is woken up to steal it
+            AZStd::shared_ptr<JobFlags> flags = AZStd::make_shared<JobFlags>();
+            JobContext* jobContext = m_jobContext;
+            const AZ::u32 gap = GetRandomGap();
+            Job* parent = CreateJobFunction([flags, jobContext, gap]()
+                {
+                    BusyWait(gap);
+                    Job* child = CreateJobFunction([flags]() { flags->m_childRan.store(true, AZStd::memory_order_release); }, true, jobContext);
+                    child->Start();
+                    flags->m_childWasStolen.store(WaitForFlag(flags->m_childRan), AZStd::memory_order_release);
+                    flags->m_parentDone.store(true, AZStd::memory_order_release);
+                }, true, m_jobContext);
+            parent->Start();
+
+            ASSERT_TRUE(WaitForFlag(flags->m_parentDone)) << "parent job " << i << " was not picked up by any worker";
+            ASSERT_TRUE(flags->m_childWasStolen.load(AZStd::memory_order_acquire)) << "stealable job " << i << " was not stolen by any worker";
+        }
+    }
+
+    class JobManagerTelemetryTest
+        : public DefaultJobManagerSetupFixture
+    {
+    };
+
+    TEST_F(JobManagerTelemetryTest, GetTelemetry_AfterRunningJobs_CountsEveryJob)
+    {
+        constexpr AZ::u64 numJobs = 1000;
+
+        m_jobManager->ClearStats();
+
+        JobCompletion completion(m_jobContext);
+        for (AZ::u64 i = 0; i < numJobs; ++i)
+        {
+            Job* job = CreateJobFunction([]() {}, true, m_jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        completion.StartAndWaitForCompletion();
+
+        // workers record a job after it completed, give the last ones a moment to do so
+        JobManagerTelemetry telemetry = m_jobManager->GetTelemetry();
+        const AZStd::chrono::system_clock::time_point timeout = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(5);
+        while (telemetry.GetTotals().m_jobsDone < numJobs && AZStd::chrono::system_clock::now() < timeout)
+        {
+            AZStd::this_thread::yield();
+            telemetry = m_jobManager->GetTelemetry();
+        }
+
+        ASSERT_GE(telemetry.m_threads.size(), m_numWorkerThreads);
+        for (unsigned int i = 0; i < m_numWorkerThreads; ++i)
+        {
+            EXPECT_TRUE(telemetry.m_threads[i].m_isWorker);
+            EXPECT_EQ(i, telemetry.m_threads[i].m_workerId);
+        }
+
+        const JobManagerThreadTelemetry totals = telemetry.GetTotals();
+        EXPECT_GE(totals.m_jobsDone, numJobs);
+        EXPECT_LE(totals.m_jobsStolen, totals.m_stealAttempts);
+
+        AZ::u64 jobsInHistogram = 0;
+        for (AZ::u64 bucketCount : totals.m_jobDurations)
+        {
+            jobsInHistogram += bucketCount;
+        }
+        EXPECT_GE(jobsInHistogram, numJobs);
+        EXPECT_LE(jobsInHistogram, totals.m_jobsDone);
+    }
+
+    TEST(JobManagerThreadTelemetry, GetJobDurationBucket_PowersOfTwoMicroseconds)
+    {
+        EXPECT_EQ(0, JobManagerThreadTelemetry::GetJobDurationBucket(0));
+        EXPECT_EQ(1, JobManagerThreadTelemetry::GetJobDurationBucket(1));
+        EXPECT_EQ(2, JobManagerThreadTelemetry::GetJobDurationBucket(2));
+        EXPECT_EQ(2, JobManagerThreadTelemetry::GetJobDurationBucket(3));
+        EXPECT_EQ(11, JobManagerThreadTelemetry::GetJobDurationBucket(1024));
+        EXPECT_EQ(JobManagerThreadTelemetry::NumJobDurationBuckets - 1, JobManagerThreadTelemetry::GetJobDurationBucket(~AZ::u64(0)));
+        EXPECT_LT(1024, JobManagerThreadTelemetry::GetJobDurationBucketUpperBound(11));
+        EXPECT_GE(1024, JobManagerThreadTelemetry::GetJobDurationBucketUpperBound(10));
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -2011,6 +2316,102 @@ namespace Benchmark
             RunMultipleCalculatePiJobsWithRandomDepthAndRandomPriority(LARGE_NUMBER_OF_JOBS);
         }
     }
+
+    //! Measures how the job system scales with the number of workers (the benchmark argument) for fine grained jobs,
+    //! both when they are queued from outside the job system and when they are forked by other jobs.
+    class JobWorkerScalingBenchmarkFixture : public ::benchmark::Fixture
+    {
+    public:
+        static const AZ::u32 NUMBER_OF_JOBS = 16384;
+        static const AZ::u32 FORKS_PER_JOB = 64;
+        static const AZ::s32 JOB_CALCULATE_PI_DEPTH = 64;
+
+        static void WorkerCounts(::benchmark::internal::Benchmark* benchmark)
+        {
+            const int maxWorkerThreads = static_cast<int>(AZStd::max(AZStd::thread::hardware_concurrency(), 1u));
+            for (int numWorkerThreads = 1; numWorkerThreads < maxWorkerThreads; numWorkerThreads *= 2)
+            {
+                benchmark->Arg(numWorkerThreads);
+            }
+            benchmark->Arg(maxWorkerThreads);
+        }
+
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorInstance<PoolAllocator>::Create();
+            AllocatorInstance<ThreadPoolAllocator>::Create();
+
+            JobManagerDesc desc;
+            JobManagerThreadDesc threadDesc;
+            for (int64_t i = 0; i < state.range(0); ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
+
+            m_jobManager = aznew JobManager(desc);
+            m_jobContext = aznew JobContext(*m_jobManager);
+        }
+
+        void TearDown([[maybe_unused]] ::benchmark::State& state) override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AllocatorInstance<ThreadPoolAllocator>::Destroy();
+            AllocatorInstance<PoolAllocator>::Destroy();
+        }
+
+    protected:
+        JobManager* m_jobManager = nullptr;
+        JobContext* m_jobContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(JobWorkerScalingBenchmarkFixture, QueueLightWeightJobsFromUserThread)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            JobCompletion completion(m_jobContext);
+            for (AZ::u32 i = 0; i < NUMBER_OF_JOBS; ++i)
+            {
+                Job* job = CreateJobFunction([]() { benchmark::DoNotOptimize(CalculatePi(JOB_CALCULATE_PI_DEPTH)); }, true, m_jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * NUMBER_OF_JOBS);
+    }
+    BENCHMARK_REGISTER_F(JobWorkerScalingBenchmarkFixture, QueueLightWeightJobsFromUserThread)
+        ->Apply(JobWorkerScalingBenchmarkFixture::WorkerCounts)
+        ->UseRealTime();
+
+    BENCHMARK_DEFINE_F(JobWorkerScalingBenchmarkFixture, ForkLightWeightJobsFromWorkers)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            JobCompletion completion(m_jobContext);
+            for (AZ::u32 i = 0; i < NUMBER_OF_JOBS / FORKS_PER_JOB; ++i)
+            {
+                // each job forks its children onto the local queue of the worker running it, idle workers have to steal them
+                Job* job = CreateJobFunction([this]()
+                    {
+                        Job* parent = m_jobContext->GetJobManager().GetCurrentJob();
+                        for (AZ::u32 fork = 0; fork < FORKS_PER_JOB; ++fork)
+                        {
+                            parent->StartAsChild(CreateJobFunction([]() { benchmark::DoNotOptimize(CalculatePi(JOB_CALCULATE_PI_DEPTH)); }, true, m_jobContext));
+                        }
+                        parent->WaitForChildren();
+                    }, true, m_jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+        }
+        state.SetItemsProcessed(state.iterations() * NUMBER_OF_JOBS);
+    }
+    BENCHMARK_REGISTER_F(JobWorkerScalingBenchmarkFixture, ForkLightWeightJobsFromWorkers)
+        ->Apply(JobWorkerScalingBenchmarkFixture::WorkerCounts)
+        ->UseRealTime();
 } // Benchmark
 
 #endif // HAVE_BENCHMARK
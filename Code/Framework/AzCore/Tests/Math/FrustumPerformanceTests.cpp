@@ -38,6 +38,22 @@ namespace Benchmark
                 data.aabbMax = AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetAbs() * 10.0f + data.aabbMin;
                 return data;
             });
+
+            // The same volumes split into an array per component for the batched intersection tests
+            for (const Data& data : m_dataArray)
+            {
+                m_sphereCenterX.push_back(data.sphereCenter.GetX());
+                m_sphereCenterY.push_back(data.sphereCenter.GetY());
+                m_sphereCenterZ.push_back(data.sphereCenter.GetZ());
+                m_sphereRadius.push_back(data.sphereRadius);
+                m_aabbMinX.push_back(data.aabbMin.GetX());
+                m_aabbMinY.push_back(data.aabbMin.GetY());
+                m_aabbMinZ.push_back(data.aabbMin.GetZ());
+                m_aabbMaxX.push_back(data.aabbMax.GetX());
+                m_aabbMaxY.push_back(data.aabbMax.GetY());
+                m_aabbMaxZ.push_back(data.aabbMax.GetZ());
+            }
+            m_results.resize(m_dataArray.size());
         }
 
         struct Data
@@ -49,6 +65,17 @@ namespace Benchmark
         };
 
         std::vector<Data> m_dataArray;
+        std::vector<float> m_sphereCenterX;
+        std::vector<float> m_sphereCenterY;
+        std::vector<float> m_sphereCenterZ;
+        std::vector<float> m_sphereRadius;
+        std::vector<float> m_aabbMinX;
+        std::vector<float> m_aabbMinY;
+        std::vector<float> m_aabbMinZ;
+        std::vector<float> m_aabbMaxX;
+        std::vector<float> m_aabbMaxY;
+        std::vector<float> m_aabbMaxZ;
+        std::vector<AZ::IntersectResult> m_results;
         AZ::Frustum m_testFrustum;
     };
 
@@ -75,6 +102,28 @@ namespace Benchmark
             }
         }
     }
+
+    BENCHMARK_F(BM_MathFrustum, SphereIntersectBatched)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_testFrustum.IntersectSpheres(
+                m_sphereCenterX.data(), m_sphereCenterY.data(), m_sphereCenterZ.data(), m_sphereRadius.data(), m_results.size(),
+                m_results.data());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathFrustum, AabbIntersectBatched)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_testFrustum.IntersectAabbs(
+                m_aabbMinX.data(), m_aabbMinY.data(), m_aabbMinZ.data(), m_aabbMaxX.data(), m_aabbMaxY.data(), m_aabbMaxZ.data(),
+                m_results.size(), m_results.data());
+            benchmark::DoNotOptimize(m_results.data());
+        }
+    }
 }
 
 #endif
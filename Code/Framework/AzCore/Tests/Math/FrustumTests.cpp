@@ -285,6 +285,53 @@ namespace UnitTest
         EXPECT_NEAR(viewFrustumAttributes.m_farClip, farClip, 1e-3f);
     }
 
+    TEST(MATH_Frustum, TestFrustumIntersectSpheresMatchesIntersectSphere)
+    {
+        // Seven spheres, so both the batches of four and the remaining spheres are tested
+        constexpr size_t Count = 7;
+        const float centerX[] = { 0.0f, 0.0f, 0.0f, 0.0f, 25.0f, 0.0f, 0.0f };
+        const float centerY[] = { 50.0f, 5.0f, 10.0f, 50.0f, 50.0f, 100.0f, 89.5f };
+        const float centerZ[] = { 0.0f, 0.0f, 0.0f, 100.0f, 0.0f, 0.0f, 0.0f };
+        const float radius[] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+        const AZ::IntersectResult expected[] = { AZ::IntersectResult::Interior, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps };
+
+        AZ::IntersectResult results[Count];
+        testFrustum2.IntersectSpheres(centerX, centerY, centerZ, radius, Count, results);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_EQ(expected[i], results[i]);
+            EXPECT_EQ(testFrustum2.IntersectSphere(AZ::Vector3(centerX[i], centerY[i], centerZ[i]), radius[i]), results[i]);
+        }
+    }
+
+    TEST(MATH_Frustum, TestFrustumIntersectAabbsMatchesIntersectAabb)
+    {
+        // Seven boxes, so both the batches of four and the remaining boxes are tested
+        constexpr size_t Count = 7;
+        const float minX[] = { -1.0f, -1.0f, -1.0f, -1.0f, 24.0f, -1.0f, -1.0f };
+        const float minY[] = { 49.0f, 4.0f, 9.0f, 49.0f, 49.0f, 99.0f, 89.0f };
+        const float minZ[] = { -1.0f, -1.0f, -1.0f, 99.0f, -1.0f, -1.0f, -1.0f };
+        const float maxX[] = { 1.0f, 1.0f, 1.0f, 1.0f, 26.0f, 1.0f, 1.0f };
+        const float maxY[] = { 51.0f, 6.0f, 11.0f, 51.0f, 51.0f, 101.0f, 91.0f };
+        const float maxZ[] = { 1.0f, 1.0f, 1.0f, 101.0f, 1.0f, 1.0f, 1.0f };
+        const AZ::IntersectResult expected[] = { AZ::IntersectResult::Interior, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps, AZ::IntersectResult::Exterior,
+                                                 AZ::IntersectResult::Overlaps };
+
+        AZ::IntersectResult results[Count];
+        testFrustum2.IntersectAabbs(minX, minY, minZ, maxX, maxY, maxZ, Count, results);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            EXPECT_EQ(expected[i], results[i]);
+            EXPECT_EQ(
+                testFrustum2.IntersectAabb(AZ::Vector3(minX[i], minY[i], minZ[i]), AZ::Vector3(maxX[i], maxY[i], maxZ[i])), results[i]);
+        }
+    }
+
     TEST(MATH_Frustum, TestGetSetPlane)
     {
         // Assumes +x runs to the 'right', +y runs 'out' and +z points 'up'
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class AllocationRecordsSamplingTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_records = AllocatorInstance<SystemAllocator>::GetAllocator().GetRecords();
+            m_samplingInterval = Debug::AllocationRecords::GetSamplingInterval();
+            if (m_records)
+            {
+                m_records->SetMode(Debug::AllocationRecords::RECORD_SAMPLED);
+            }
+        }
+
+        void TearDown() override
+        {
+            if (m_records)
+            {
+                m_records->SetMode(Debug::AllocationRecords::RECORD_FULL);
+            }
+            Debug::AllocationRecords::SetSamplingInterval(m_samplingInterval);
+            AllocatorsFixture::TearDown();
+        }
+
+        /// Restarts the countdown of the calling thread with the current sampling interval.
+        static void RestartSampling()
+        {
+            Debug::AllocationRecords::ShouldSampleAllocation(size_t(1) << 40);
+        }
+
+        Debug::SampledStackInfo GetSampledTotals()
+        {
+            Debug::SampledStackInfo totals;
+            m_records->EnumerateSampledStacks([&totals](const Debug::SampledStackInfo& info, unsigned char)
+            {
+                totals.m_numLiveAllocations += info.m_numLiveAllocations;
+                totals.m_liveBytes += info.m_liveBytes;
+                totals.m_numAllocations += info.m_numAllocations;
+                totals.m_allocatedBytes += info.m_allocatedBytes;
+                return true;
+            });
+            return totals;
+        }
+
+    protected:
+        Debug::AllocationRecords* m_records = nullptr;
+        size_t m_samplingInterval = 0;
+    };
+
+    TEST_F(AllocationRecordsSamplingTest, ShouldSampleAllocation_LargeAllocations_AlwaysSampled)
+    {
+        Debug::AllocationRecords::SetSamplingInterval(1024);
+        RestartSampling();
+        size_t numSampled = 0;
+        for (int i = 0; i < 100; ++i)
+        {
+            numSampled += Debug::AllocationRecords::ShouldSampleAllocation(1024 * 1024) ? 1 : 0;
+        }
+        EXPECT_EQ(100, numSampled);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, ShouldSampleAllocation_SmallAllocations_SampledByBytes)
+    {
+        Debug::AllocationRecords::SetSamplingInterval(4096);
+        RestartSampling();
+        size_t numSampled = 0;
+        const size_t numAllocations = 100000;
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            numSampled += Debug::AllocationRecords::ShouldSampleAllocation(64) ? 1 : 0;
+        }
+        // 6.4MB allocated, one sample per 4KB on average
+        const size_t expectedSamples = numAllocations * 64 / 4096;
+        EXPECT_GT(numSampled, expectedSamples / 2);
+        EXPECT_LT(numSampled, expectedSamples * 2);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, SampledMode_AllocateAndFree_TracksLiveSamples)
+    {
+        ASSERT_NE(nullptr, m_records);
+
+        // with a 1 byte interval every allocation is sampled
+        Debug::AllocationRecords::SetSamplingInterval(1);
+        IAllocatorAllocate& allocator = AllocatorInstance<SystemAllocator>::Get();
+        AZStd::vector<void*, OSStdAllocator> allocations;
+        allocations.reserve(10);
+        RestartSampling();
+        const Debug::SampledStackInfo before = GetSampledTotals();
+
+        for (int i = 0; i < 10; ++i)
+        {
+            allocations.push_back(allocator.Allocate(256, 16));
+        }
+
+        Debug::SampledStackInfo totals = GetSampledTotals();
+        EXPECT_EQ(before.m_numLiveAllocations + 10, totals.m_numLiveAllocations);
+        EXPECT_EQ(before.m_liveBytes + 10 * 256, totals.m_liveBytes);
+
+        for (void* allocation : allocations)
+        {
+            allocator.DeAllocate(allocation);
+        }
+
+        totals = GetSampledTotals();
+        EXPECT_EQ(before.m_numLiveAllocations, totals.m_numLiveAllocations);
+        EXPECT_EQ(before.m_liveBytes, totals.m_liveBytes);
+        EXPECT_GE(totals.m_numAllocations, before.m_numAllocations + 10);
+        EXPECT_GE(totals.m_allocatedBytes, before.m_allocatedBytes + 10 * 256);
+    }
+
+    TEST_F(AllocationRecordsSamplingTest, WriteSampledHeapProfile_SampledAllocations_WritesPprofHeader)
+    {
+        ASSERT_NE(nullptr, m_records);
+
+        Debug::AllocationRecords::SetSamplingInterval(1);
+        RestartSampling();
+        IAllocatorAllocate& allocator = AllocatorInstance<SystemAllocator>::Get();
+        void* allocation = allocator.Allocate(128, 16);
+
+        AZStd::vector<char, OSStdAllocator> profile;
+        IO::ByteContainerStream<AZStd::vector<char, OSStdAllocator>> profileStream(&profile);
+        EXPECT_TRUE(AllocatorManager::Instance().WriteSampledHeapProfile(profileStream));
+        allocator.DeAllocate(allocation);
+
+        const AZStd::string_view profileText(profile.data(), profile.size());
+        EXPECT_TRUE(profileText.starts_with("heap profile: "));
+        EXPECT_NE(AZStd::string_view::npos, profileText.find("@ heap_v2/1\n"));
+    }
+} // namespace UnitTest
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AllocatorInstance<FrameArenaAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+
+        FrameArenaAllocator& GetArena()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_SequentialAllocations_AlignedAndCounted)
+    {
+        IAllocatorAllocate& arena = AllocatorInstance<FrameArenaAllocator>::Get();
+        void* first = arena.Allocate(10, 8);
+        void* second = arena.Allocate(100, 64);
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(first) % 8);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) % 64);
+        EXPECT_GE(reinterpret_cast<char*>(second), reinterpret_cast<char*>(first) + 10);
+        EXPECT_EQ(110, arena.NumAllocatedBytes());
+        EXPECT_GT(arena.Capacity(), 0);
+    }
+
+    TEST_F(FrameArenaAllocatorTest, DeAllocate_LastAllocation_RollsBack)
+    {
+        IAllocatorAllocate& arena = AllocatorInstance<FrameArenaAllocator>::Get();
+        void* first = arena.Allocate(32, 8);
+        void* second = arena.Allocate(32, 8);
+        arena.DeAllocate(second);
+        EXPECT_EQ(32, arena.NumAllocatedBytes());
+
+        // only the last allocation can be given back
+        arena.DeAllocate(first);
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+        EXPECT_EQ(first, arena.Allocate(32, 8));
+    }
+
+    TEST_F(FrameArenaAllocatorTest, ResetFrame_ReusesPagesAndTracksPeak)
+    {
+        IAllocatorAllocate& arena = AllocatorInstance<FrameArenaAllocator>::Get();
+        void* first = arena.Allocate(1024, 16);
+        arena.Allocate(200 * 1024, 16); // larger than a page
+        const size_t frameBytes = arena.NumAllocatedBytes();
+        const size_t capacity = arena.Capacity();
+
+        GetArena().ResetFrame();
+        EXPECT_EQ(0, arena.NumAllocatedBytes());
+        EXPECT_EQ(frameBytes, GetArena().GetPeakFrameBytes());
+        EXPECT_LT(arena.Capacity(), capacity); // the large page is released, the regular one is kept
+
+        EXPECT_EQ(first, arena.Allocate(1024, 16));
+        GetArena().ResetFrame();
+        EXPECT_EQ(frameBytes, GetArena().GetPeakFrameBytes());
+
+        arena.GarbageCollect();
+        EXPECT_EQ(0, arena.Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, StdAllocator_VectorGrowth_AllocatesFromArena)
+    {
+        AZStd::vector<int, FrameArenaStdAllocator> values;
+        for (int i = 0; i < 10000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(9999, values.back());
+        EXPECT_GE(AllocatorInstance<FrameArenaAllocator>::Get().NumAllocatedBytes(), values.size() * sizeof(int));
+
+        values = AZStd::vector<int, FrameArenaStdAllocator>();
+        GetArena().ResetFrame();
+        EXPECT_EQ(0, AllocatorInstance<FrameArenaAllocator>::Get().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_MultipleThreads_UseSeparatePages)
+    {
+        static const int NumThreads = 4;
+        static const int NumAllocations = 1000;
+        AZStd::thread threads[NumThreads];
+        bool isValid[NumThreads] = {};
+        for (int threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex, &isValid]()
+            {
+                IAllocatorAllocate& arena = AllocatorInstance<FrameArenaAllocator>::Get();
+                AZStd::vector<int*> allocations;
+                for (int i = 0; i < NumAllocations; ++i)
+                {
+                    int* value = reinterpret_cast<int*>(arena.Allocate(sizeof(int) * 16, alignof(int)));
+                    *value = threadIndex * NumAllocations + i;
+                    allocations.push_back(value);
+                }
+                isValid[threadIndex] = true;
+                for (int i = 0; i < NumAllocations; ++i)
+                {
+                    isValid[threadIndex] &= *allocations[i] == threadIndex * NumAllocations + i;
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (bool threadValid : isValid)
+        {
+            EXPECT_TRUE(threadValid);
+        }
+        EXPECT_EQ(NumThreads * NumAllocations * sizeof(int) * 16, AllocatorInstance<FrameArenaAllocator>::Get().NumAllocatedBytes());
+        GetArena().ResetFrame();
+        EXPECT_EQ(NumThreads * NumAllocations * sizeof(int) * 16, GetArena().GetPeakFrameBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, AllocatorManager_FrameArena_IsRegistered)
+    {
+        AllocatorManager& manager = AllocatorManager::Instance();
+        bool isRegistered = false;
+        for (int i = 0; i < manager.GetNumAllocators(); ++i)
+        {
+            isRegistered |= manager.GetAllocator(i) == &GetArena();
+        }
+        EXPECT_TRUE(isRegistered);
+    }
+} // namespace UnitTest
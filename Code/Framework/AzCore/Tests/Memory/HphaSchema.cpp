@@ -7,7 +7,9 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -110,6 +112,96 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            HphaSchema_TestAllocator::Descriptor desc;
+            desc.m_isThreadCacheAllocations = true;
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        static size_t GetThreadCacheStats(AZ::AllocatorThreadCacheStats* outStats, size_t maxStats)
+        {
+            return AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GetSchema()->GetThreadCacheStats(outStats, maxStats);
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, AllocateAfterFree_SameThread_ServedFromCache)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        void* first = allocator.Allocate(32, 8);
+        allocator.DeAllocate(first);
+        void* second = allocator.Allocate(32, 8);
+        EXPECT_EQ(first, second);
+        allocator.DeAllocate(second);
+
+        // Cached blocks are free for the user
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+
+        AZ::AllocatorThreadCacheStats stats[4];
+        ASSERT_EQ(1, GetThreadCacheStats(stats, AZ_ARRAY_SIZE(stats)));
+        EXPECT_EQ(AZStd::this_thread::get_id(), stats[0].m_threadId);
+        EXPECT_EQ(1, stats[0].m_numMisses);
+        EXPECT_EQ(1, stats[0].m_numHits);
+        EXPECT_LT(0, stats[0].m_cachedBytes);
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadExit_CacheReturnedToPools)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+
+        AZStd::thread thread([&allocator]()
+        {
+            void* allocations[256];
+            for (void*& allocation : allocations)
+            {
+                allocation = allocator.Allocate(16, 8);
+            }
+            for (void* allocation : allocations)
+            {
+                allocator.DeAllocate(allocation);
+            }
+        });
+        thread.join();
+
+        AZ::AllocatorThreadCacheStats stats[4];
+        EXPECT_EQ(0, GetThreadCacheStats(stats, AZ_ARRAY_SIZE(stats)));
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, GetThreadCacheStats_AllocatorManager_ReportsHitRatePerThread)
+    {
+        auto& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        for (int i = 0; i < 10; ++i)
+        {
+            allocator.DeAllocate(allocator.Allocate(100, 8));
+        }
+
+        AZStd::vector<AZ::AllocatorManager::ThreadCacheStats> stats;
+        AZ::AllocatorManager::Instance().GetThreadCacheStats(stats);
+        auto testStats = AZStd::find_if(stats.begin(), stats.end(), [](const AZ::AllocatorManager::ThreadCacheStats& entry)
+        {
+            return entry.m_allocatorName == "HphaSchema_TestAllocator";
+        });
+        ASSERT_NE(stats.end(), testStats);
+        EXPECT_EQ(9, testStats->m_cacheStats.m_numHits);
+        EXPECT_EQ(1, testStats->m_cacheStats.m_numMisses);
+        EXPECT_FLOAT_EQ(0.9f, testStats->GetHitRate());
+    }
 }
 
 
@@ -8,6 +8,7 @@
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Name/NameJsonSerializer.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Name/NameLiteral.h>
 #include <Tests/Serialization/Json/BaseJsonSerializerFixture.h>
 #include <Tests/Serialization/Json/JsonSerializerConformityTests.h>
 
@@ -190,4 +191,29 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Success, result.GetOutcome());
         EXPECT_STREQ("3.141500", convertedValue.GetStringView().data());
     }
+
+    TEST_F(NameJsonSerializerTests, StoreAndLoad_NameLiteral_LoadedNameEqualsLiteral)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        const AZ::Name& literalName = AZ_NAME_LITERAL("Hello literal");
+        ResultCode result = m_serializer->Store(*m_jsonDocument, &literalName, nullptr, azrtti_typeid<AZ::Name>(), *m_jsonSerializationContext);
+        EXPECT_EQ(Outcomes::Success, result.GetOutcome());
+        EXPECT_STREQ("Hello literal", m_jsonDocument->GetString());
+
+        AZ::Name convertedValue{};
+        result = m_serializer->Load(&convertedValue, azrtti_typeid<AZ::Name>(), *m_jsonDocument, *m_jsonDeserializationContext);
+        EXPECT_EQ(Outcomes::Success, result.GetOutcome());
+        EXPECT_EQ(literalName, convertedValue);
+    }
+
+    TEST_F(NameJsonSerializerTests, Store_NameLiteralAsDefault_DefaultsUsed)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        const AZ::Name& defaultName = AZ_NAME_LITERAL("Default literal");
+        const AZ::Name runtimeName{ "Default literal" };
+        ResultCode result = m_serializer->Store(*m_jsonDocument, &runtimeName, &defaultName, azrtti_typeid<AZ::Name>(), *m_jsonSerializationContext);
+        EXPECT_EQ(Outcomes::DefaultsUsed, result.GetOutcome());
+    }
 } // namespace JsonSerializationTests
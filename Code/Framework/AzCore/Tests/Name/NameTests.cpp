@@ -17,6 +17,7 @@
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/Name/NameLiteral.h>
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Memory/MemoryComponent.h>
@@ -24,6 +25,9 @@
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <thread>
 #include <stdlib.h>
@@ -47,14 +51,14 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static AZStd::vector<AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntries();
         }
         
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -269,9 +273,9 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
+            const AZStd::vector<AZ::Internal::NameData*> globalDictionary = NameDictionaryTester::GetDictionary();
+            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](const AZ::Internal::NameData* entry) {
+                return entry->GetName() == nameString;
             });
             EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
@@ -559,6 +563,101 @@ namespace UnitTest
         delete serializeContext;
     }
     
+    static const AZ::Name& GetTestNameLiteral()
+    {
+        return AZ_NAME_LITERAL("MyNameLiteral");
+    }
+
+    TEST_F(NameTest, NameLiteral_ComputeHash_MatchesDictionaryHash)
+    {
+        static_assert(AZ::Name::ComputeHash("MyNameLiteral") != 0, "Name hashes should be computed at compile time");
+        EXPECT_EQ(AZ::Name::ComputeHash("MyNameLiteral"), NameDictionaryTester::CalcDirectHashValue("MyNameLiteral"));
+    }
+
+    TEST_F(NameTest, NameLiteral_FirstUse_EqualsRuntimeName)
+    {
+        const AZ::Name& literalName = GetTestNameLiteral();
+        EXPECT_EQ(literalName.GetStringView(), "MyNameLiteral");
+        EXPECT_EQ(literalName, AZ::Name("MyNameLiteral"));
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_RepeatedUse_ReturnsSameBoundName)
+    {
+        const AZ::Name* firstUse = &GetTestNameLiteral();
+        const AZ::Name* secondUse = &GetTestNameLiteral();
+        EXPECT_EQ(firstUse, secondUse);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_DictionaryRecreated_BindsToNewDictionary)
+    {
+        AZ::Name::Hash hashBefore = 0;
+        {
+            const AZ::Name nameBefore = GetTestNameLiteral();
+            hashBefore = nameBefore.GetHash();
+        }
+
+        // The literal holds a reference, the entry stays in the dictionary without any other Name
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        // Destroying the dictionary unbinds the literal instead of reporting it as a leak
+        NameDictionaryTester::Destroy();
+        NameDictionaryTester::Create();
+
+        EXPECT_EQ(GetTestNameLiteral(), AZ::Name("MyNameLiteral"));
+        EXPECT_EQ(GetTestNameLiteral().GetHash(), hashBefore);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_FirstUseFromManyThreads_AllThreadsGetSameName)
+    {
+        constexpr size_t ThreadCount = 8;
+        AZStd::vector<AZStd::thread> threads;
+        AZStd::vector<const AZ::Name*> names(ThreadCount, nullptr);
+        for (size_t i = 0; i < ThreadCount; ++i)
+        {
+            threads.emplace_back([&names, i]()
+            {
+                names[i] = &AZ_NAME_LITERAL("ThreadedNameLiteral");
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (const AZ::Name* name : names)
+        {
+            EXPECT_EQ(name, names[0]);
+            EXPECT_EQ(*name, AZ::Name("ThreadedNameLiteral"));
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_SerializedWithObjectStream_LoadsEqualName)
+    {
+        AZ::SerializeContext* serializeContext = aznew AZ::SerializeContext();
+        AZ::Name::Reflect(serializeContext);
+
+        AZStd::vector<char, AZ::OSStdAllocator> nameBuffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char, AZ::OSStdAllocator> > outStream(&nameBuffer);
+        {
+            AZ::ObjectStream* objStream = AZ::ObjectStream::Create(&outStream, *serializeContext, AZ::ObjectStream::ST_BINARY);
+            ASSERT_TRUE(objStream->WriteClass(&GetTestNameLiteral()));
+            ASSERT_TRUE(objStream->Finalize());
+        }
+        outStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+
+        AZ::ObjectStream::FilterDescriptor filterDesc;
+        AZ::Name* serializedName = AZ::Utils::LoadObjectFromStream<AZ::Name>(outStream, serializeContext, filterDesc);
+        ASSERT_NE(serializedName, nullptr);
+        EXPECT_EQ(*serializedName, GetTestNameLiteral());
+        delete serializedName;
+
+        delete serializeContext;
+    }
+
     TEST_F(NameTest, NameContanerTest)
     {
         AZStd::unordered_set<AZ::Name> nameSet;
@@ -621,6 +720,36 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, NameDictionary_ManyNames_AllNamesFoundAfterGrowingAndReleasing)
+    {
+        // Enough names to grow the dictionary table several times
+        constexpr size_t NameCount = 10000;
+
+        AZStd::vector<AZ::Name> names;
+        names.reserve(NameCount);
+        for (size_t i = 0; i < NameCount; ++i)
+        {
+            names.push_back(AZ::Name{ AZStd::string::format("name%zu", i) });
+        }
+        EXPECT_EQ(NameCount, NameDictionaryTester::GetEntryCount());
+
+        // Release every other name, leaving removed entries in between the remaining ones
+        for (size_t i = 0; i < NameCount; i += 2)
+        {
+            names[i] = AZ::Name{};
+        }
+        EXPECT_EQ(NameCount / 2, NameDictionaryTester::GetEntryCount());
+
+        for (size_t i = 1; i < NameCount; i += 2)
+        {
+            EXPECT_EQ(names[i], AZ::Name{ AZStd::string::format("name%zu", i) });
+            EXPECT_EQ(names[i], AZ::Name{ names[i].GetHash() });
+        }
+
+        names.clear();
+        EXPECT_EQ(0, NameDictionaryTester::GetEntryCount());
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = AZ_TRAIT_UNIT_TEST_NAME_COUNT;
@@ -832,3 +961,133 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    //! Looks up existing names the way the NameDictionary did before lookups became lock-free,
+    //! with a hash map behind a shared mutex, to compare against the current implementation.
+    class SharedMutexNameLookup
+    {
+    public:
+        void Add(const AZ::Name& name)
+        {
+            m_entries.emplace(name.GetHash(), Entry{ name.GetStringView() });
+        }
+
+        bool Find(AZStd::string_view nameString)
+        {
+            const AZ::Name::Hash hash = AZStd::hash<AZStd::string_view>()(nameString) & 0xFFFFFFFF;
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+            auto iter = m_entries.find(hash);
+            if (iter != m_entries.end() && iter->second.m_name == nameString)
+            {
+                // Taking and dropping the reference a Name would hold
+                ++iter->second.m_useCount;
+                --iter->second.m_useCount;
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        struct Entry
+        {
+            Entry(AZStd::string_view name) : m_name(name) {}
+            Entry(const Entry& rhs) : m_name(rhs.m_name) {}
+
+            AZStd::string_view m_name;
+            AZStd::atomic_int m_useCount{ 0 };
+        };
+
+        AZStd::unordered_map<AZ::Name::Hash, Entry> m_entries;
+        AZStd::shared_mutex m_sharedMutex;
+    };
+
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        // SetUp and TearDown run on every benchmark thread, only the first one sets up the shared state.
+        // The other threads don't touch it before the benchmark loop starts, which waits for all threads.
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+
+                m_nameStrings.reserve(NameCount);
+                m_names.reserve(NameCount);
+                m_sharedMutexLookup = AZStd::make_unique<SharedMutexNameLookup>();
+                for (int i = 0; i < NameCount; ++i)
+                {
+                    m_nameStrings.push_back(AZStd::string::format("Benchmark name %d", i));
+                    m_names.push_back(AZ::Name{ m_nameStrings.back() });
+                    m_sharedMutexLookup->Add(m_names.back());
+                }
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                m_sharedMutexLookup.reset();
+                m_names = {};
+                m_nameStrings = {};
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+    protected:
+        static constexpr int NameCount = 1024;
+
+        AZStd::vector<AZStd::string> m_nameStrings;
+        AZStd::vector<AZ::Name> m_names;
+        AZStd::unique_ptr<SharedMutexNameLookup> m_sharedMutexLookup;
+    };
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeName_ExistingNames)(benchmark::State& state)
+    {
+        // every thread walks the names from a different starting point
+        int index = (state.thread_index * 97) % NameCount;
+        for (auto _ : state)
+        {
+            AZ::Name name{ m_nameStrings[index] };
+            benchmark::DoNotOptimize(name);
+            index = (index + 1) % NameCount;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeName_ExistingNames)->ThreadRange(1, 16)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, SharedMutexLookup_ExistingNames)(benchmark::State& state)
+    {
+        int index = (state.thread_index * 97) % NameCount;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(m_sharedMutexLookup->Find(m_nameStrings[index]));
+            index = (index + 1) % NameCount;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, SharedMutexLookup_ExistingNames)->ThreadRange(1, 16)->UseRealTime();
+
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, FindName_ExistingHashes)(benchmark::State& state)
+    {
+        int index = (state.thread_index * 97) % NameCount;
+        for (auto _ : state)
+        {
+            AZ::Name name{ m_names[index].GetHash() };
+            benchmark::DoNotOptimize(name);
+            index = (index + 1) % NameCount;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, FindName_ExistingHashes)->ThreadRange(1, 16)->UseRealTime();
+}
+#endif // HAVE_BENCHMARK
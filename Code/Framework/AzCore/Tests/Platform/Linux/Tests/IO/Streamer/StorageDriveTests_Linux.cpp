@@ -0,0 +1,545 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/IoUring_Linux.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    constexpr size_t TestRegisteredBufferSize = 8_kib;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+            return StorageDriveLinux(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestQueueDepth, TestOverCommit, TestRegisteredBufferSize, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_beginCharacter = 'B';
+        static constexpr char s_endCharacter = 'E';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+        AZStd::vector<AZStd::string> m_dummyFiles;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+            m_context = new AZ::IO::StreamerContext();
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, TestRegisteredBufferSize, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            for (auto& dummyFile : m_dummyFiles)
+            {
+                AZ::IO::SystemFile::Delete(dummyFile.c_str());
+            }
+            m_dummyFiles.clear();
+        }
+
+        //! io_uring can be unavailable on older kernels or be blocked by a sandbox, in which case the drive forwards everything.
+        bool IsIoUringAvailable() const
+        {
+            return IoUring::IsSupported() && m_storageDrive->IsValid();
+        }
+
+        // Create a file filled with a single character.
+        // If chunkOffset is non-zero, it will write in a specific character every chunkOffset bytes till the end of file.
+        // If beginEndMarkers is true, it will write in specific bytes to mark the begin and end of the file.
+        void CreateDummyFile(AZStd::string path, size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(path.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+            m_dummyFiles.push_back(AZStd::move(path));
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            if (beginEndMarkers)
+            {
+                buffer[0] = s_beginCharacter;
+                buffer[fileSize - 1] = s_endCharacter;
+            }
+
+            auto bytesWritten = file.Write(buffer.get(), fileSize);
+            file.Close();
+            ASSERT_EQ(bytesWritten, fileSize);
+        }
+
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0, bool beginEndMarkers = false)
+        {
+            CreateDummyFile(m_dummyFilepath, fileSize, chunkOffset, beginEndMarkers);
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()) && !AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+            {
+                return;
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidSizes_ErrorsAreReported)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_minimalReporting = true;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, 0, 0,
+            TestQueueDepth, TestOverCommit, TestRegisteredBufferSize, options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_InvalidOvercommit_ErrorIsReportedAndSizeAdjusted)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_minimalReporting = true;
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+            TestLogicalSectorSize, TestQueueDepth, -(aznumeric_cast<s32>(TestQueueDepth) + 2), TestRegisteredBufferSize, options);
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::IO::StreamStackEntry::Status status{};
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_EQ(1, status.m_numAvailableSlots);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath("/Invalid/Dummy.bin");
+
+        bool completed = false;
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([&completed](const FileRequest& request)
+            {
+                auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_FALSE(fileExists.m_found);
+                completed = true;
+            });
+
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+        EXPECT_TRUE(completed);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_AlignedRead_ReturnsCorrectData)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        char* buffer = reinterpret_cast<char*>(azmalloc(fileSize, TestPhysicalSectorSize));
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, fileSize, m_dummyRequestPath, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_beginCharacter);
+        EXPECT_EQ(buffer[1], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 2], s_fileCharacter);
+        EXPECT_EQ(buffer[fileSize - 1], s_endCharacter);
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedRead_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        // Small enough to use the registered buffers.
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t fileSize = 16_kib;
+        constexpr char unexpectedChar = 'Z';
+
+        // Deliberately misalign the output buffer.
+        AZStd::unique_ptr<char[]> allocation(new char[unalignedSize + 8]);
+        char* buffer = allocation.get() + 1;
+        buffer[unalignedSize] = unexpectedChar;
+
+        CreateDummyFile(fileSize, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, unalignedSize, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_chunkCharacter);
+        for (size_t offset = 1; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(buffer[(offset * unalignedOffset) - 1], s_fileCharacter);
+            EXPECT_EQ(buffer[offset * unalignedOffset], s_chunkCharacter);
+        }
+        EXPECT_EQ(buffer[unalignedSize - 1], s_fileCharacter);
+        EXPECT_EQ(buffer[unalignedSize], unexpectedChar);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedReadLargerThanRegisteredBuffer_ReturnsCorrectData)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 64_kib;
+        constexpr AZ::u64 readSize = TestRegisteredBufferSize * 4 + 3;
+        AZStd::unique_ptr<char[]> buffer(new char[readSize]);
+
+        CreateDummyFile(fileSize, 0, true);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        // Read up to and including the end marker from an unaligned offset.
+        request->CreateRead(nullptr, buffer.get(), readSize, m_dummyRequestPath, fileSize - readSize, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(buffer[0], s_fileCharacter);
+        EXPECT_EQ(buffer[readSize - 1], s_endCharacter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanQueueDepth_AllDataIsCorrect)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 3;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        // All slots should be filled by a single batch.
+        m_storageDrive->ExecuteRequests();
+        AZ::IO::StreamStackEntry::Status status;
+        m_storageDrive->UpdateStatus(status);
+        EXPECT_FALSE(status.m_isIdle);
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numChunks, numCompleted);
+        EXPECT_EQ(buffers[0][0], s_beginCharacter);
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_EQ(buffers[i][0], s_chunkCharacter);
+            EXPECT_EQ(buffers[i][chunkSize - 2], s_fileCharacter);
+        }
+        EXPECT_EQ(buffers[numChunks - 1][chunkSize - 1], s_endCharacter);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_ReadPastEndOfFile_ResubmitsRemainderAndFails)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        // The first read returns the bytes up to the end of the file, reading the remainder then returns nothing.
+        constexpr size_t fileSize = TestPhysicalSectorSize;
+        constexpr size_t readSize = fileSize * 2;
+        AZStd::unique_ptr<u8[]> buffer(new u8[readSize]);
+
+        CreateDummyFile(fileSize);
+
+        bool isCompleted = false;
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), readSize, m_dummyRequestPath, 0, readSize);
+        request->SetCompletionCallback([&isCompleted](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+                isCompleted = true;
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+        EXPECT_TRUE(isCompleted);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Destructor_ReadsInFlight_AllRequestsAreCompletedBeforeBuffersAreReleased)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = TestQueueDepth * 3;
+        constexpr size_t fileSize = numChunks * chunkSize;
+        AZStd::array<AZStd::unique_ptr<u8[]>, numChunks> buffers;
+
+        CreateDummyFile(fileSize, chunkSize, true);
+
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i].reset(new u8[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers[i].get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    // Reads the device already finished can't be canceled anymore.
+                    const AZ::IO::IStreamerTypes::RequestStatus status = request.GetStatus();
+                    EXPECT_TRUE(status == AZ::IO::IStreamerTypes::RequestStatus::Canceled ||
+                        status == AZ::IO::IStreamerTypes::RequestStatus::Completed);
+                    numCompleted++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        // Submit the first batch, the remaining reads stay pending in the drive.
+        m_storageDrive->ExecuteRequests();
+        m_storageDrive.reset();
+
+        m_context->FinalizeCompletedRequests();
+        EXPECT_EQ(numChunks, numCompleted);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_InvalidFilePath_RequestIsForwardedAndFails)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t readSize = 4_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[readSize]);
+
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath("/Invalid/Dummy.bin");
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), readSize, path, 0, readSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_ReadDone_MoreThanZeroStatisticsReturned)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        EXPECT_FALSE(statistics.empty());
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, UpdateCompletionEstimates_QueuedReads_LaterReadsCompleteLater)
+    {
+        if (!IsIoUringAvailable())
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = 16_kib;
+        constexpr size_t numChunks = TestQueueDepth * 2;
+        CreateDummyFile(chunkSize * numChunks);
+
+        AZStd::unique_ptr<char[]> buffer(new char[chunkSize * numChunks]);
+        AZStd::vector<FileRequest*> requests;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer.get() + i * chunkSize, chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            m_storageDrive->QueueRequest(request);
+            requests.push_back(request);
+        }
+
+        AZStd::vector<FileRequest*> internalPending;
+        StreamerContext::PreparedQueue pending;
+        auto now = AZStd::chrono::system_clock::now();
+        m_storageDrive->UpdateCompletionEstimates(now, internalPending, pending.begin(), pending.end());
+
+        for (size_t i = 1; i < numChunks; ++i)
+        {
+            EXPECT_LT(requests[i - 1]->GetEstimatedCompletion(), requests[i]->GetEstimatedCompletion());
+        }
+
+        WaitTillCompleted();
+    }
+} // namespace AZ::IO
@@ -1849,6 +1849,19 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             IO::FileIOStream stream(testBinFilePath.c_str(), IO::OpenMode::ModeRead);
             TestLoad(&stream);
         }
+
+        // Compact binary version
+        AZ::IO::Path testCompactBinFilePath = serializeTestFilePath / "serializebasictest_compact.bin";
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Writing as Compact Binary...\n");
+            IO::FileIOStream stream(testCompactBinFilePath.c_str(), IO::OpenMode::ModeWrite);
+            TestSave(&stream, ObjectStream::ST_BINARY_COMPACT);
+        }
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Loading as Compact Binary...\n");
+            IO::FileIOStream stream(testCompactBinFilePath.c_str(), IO::OpenMode::ModeRead);
+            TestLoad(&stream);
+        }
     }
     /*
     * Test serialization of built-in container types
@@ -4491,6 +4504,11 @@ namespace UnitTest
         TestFileUtilsStream(ObjectStream::ST_BINARY);
     }
 
+    TEST_F(SerializationFileUtil, TestFileUtilsStream_CompactBinary)
+    {
+        TestFileUtilsStream(ObjectStream::ST_BINARY_COMPACT);
+    }
+
     TEST_F(SerializationFileUtil, DISABLED_TestFileUtilsFile_XML)
     {
         TestFileUtilsFile(ObjectStream::ST_XML);
@@ -6515,6 +6533,234 @@ namespace UnitTest
         AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get());
     }
 
+    struct CompactPlainDataStruct
+    {
+        AZ_TYPE_INFO(CompactPlainDataStruct, "{6C5F3B1E-2D7A-4E0B-9A8C-41F2E7D3B5A9}");
+        AZ_CLASS_ALLOCATOR(CompactPlainDataStruct, AZ::SystemAllocator, 0);
+
+        static void Reflect(SerializeContext& sc)
+        {
+            sc.Class<CompactPlainDataStruct>()
+                ->Field("int", &CompactPlainDataStruct::m_int)
+                ->Field("float", &CompactPlainDataStruct::m_float)
+                ->Field("bool", &CompactPlainDataStruct::m_bool)
+                ->Field("double", &CompactPlainDataStruct::m_double)
+                ;
+        }
+
+        int m_int = 0;
+        float m_float = 0.0f;
+        bool m_bool = false;
+        double m_double = 0.0;
+    };
+
+    struct CompactMixedStruct
+    {
+        AZ_TYPE_INFO(CompactMixedStruct, "{0B8E9D42-7F13-4C6A-B5E2-93D1A6F8C071}");
+        AZ_CLASS_ALLOCATOR(CompactMixedStruct, AZ::SystemAllocator, 0);
+
+        static void Reflect(SerializeContext& sc)
+        {
+            sc.Class<CompactMixedStruct>()
+                ->Field("name", &CompactMixedStruct::m_name)
+                ->Field("single", &CompactMixedStruct::m_single)
+                ->Field("values", &CompactMixedStruct::m_values)
+                ->Field("flag", &CompactMixedStruct::m_flag)
+                ;
+        }
+
+        AZStd::string m_name;
+        CompactPlainDataStruct m_single;
+        AZStd::vector<CompactPlainDataStruct> m_values;
+        bool m_flag = false;
+    };
+
+    class CompactBinaryObjectStream
+        : public ObjectStreamSerialization
+    {
+    public:
+        void SetUp() override
+        {
+            ObjectStreamSerialization::SetUp();
+            CompactPlainDataStruct::Reflect(*m_serializeContext);
+            CompactMixedStruct::Reflect(*m_serializeContext);
+        }
+
+        void TearDown() override
+        {
+            m_serializeContext->EnableRemoveReflection();
+            CompactMixedStruct::Reflect(*m_serializeContext);
+            CompactPlainDataStruct::Reflect(*m_serializeContext);
+            m_serializeContext->DisableRemoveReflection();
+
+            ObjectStreamSerialization::TearDown();
+        }
+
+        static CompactMixedStruct CreateTestObject()
+        {
+            CompactMixedStruct object;
+            object.m_name = "Compact";
+            object.m_single = { -17, 3.5f, true, 1.0e100 };
+            for (int i = 0; i < 64; ++i)
+            {
+                object.m_values.push_back({ i, i * 0.25f, (i & 1) != 0, i * -2.0 });
+            }
+            object.m_flag = true;
+            return object;
+        }
+
+        static void ExpectEqual(const CompactPlainDataStruct& expected, const CompactPlainDataStruct& actual)
+        {
+            EXPECT_EQ(expected.m_int, actual.m_int);
+            EXPECT_EQ(expected.m_float, actual.m_float);
+            EXPECT_EQ(expected.m_bool, actual.m_bool);
+            EXPECT_EQ(expected.m_double, actual.m_double);
+        }
+
+        void ReflectReorderedPlainDataStruct()
+        {
+            m_serializeContext->EnableRemoveReflection();
+            CompactPlainDataStruct::Reflect(*m_serializeContext);
+            m_serializeContext->DisableRemoveReflection();
+
+            // Same fields, but in a different order than they were saved in, so the stored layout doesn't match anymore.
+            m_serializeContext->Class<CompactPlainDataStruct>()
+                ->Field("double", &CompactPlainDataStruct::m_double)
+                ->Field("int", &CompactPlainDataStruct::m_int)
+                ->Field("bool", &CompactPlainDataStruct::m_bool)
+                ;
+        }
+    };
+
+    TEST_F(CompactBinaryObjectStream, RoundTrip_PlainDataAndContainers_AreLoaded)
+    {
+        CompactMixedStruct saveObject = CreateTestObject();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY_COMPACT, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        CompactMixedStruct loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+
+        EXPECT_EQ(saveObject.m_name, loadObject.m_name);
+        EXPECT_EQ(saveObject.m_flag, loadObject.m_flag);
+        ExpectEqual(saveObject.m_single, loadObject.m_single);
+        ASSERT_EQ(saveObject.m_values.size(), loadObject.m_values.size());
+        for (size_t i = 0; i < saveObject.m_values.size(); ++i)
+        {
+            ExpectEqual(saveObject.m_values[i], loadObject.m_values[i]);
+        }
+    }
+
+    TEST_F(CompactBinaryObjectStream, Save_IsSmallerThanBinary)
+    {
+        CompactMixedStruct saveObject = CreateTestObject();
+
+        AZStd::vector<AZ::u8> binaryBuffer;
+        AZ::IO::ByteContainerStream<decltype(binaryBuffer)> binaryStream(&binaryBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(binaryStream, AZ::DataStream::ST_BINARY, &saveObject, m_serializeContext.get()));
+
+        AZStd::vector<AZ::u8> compactBuffer;
+        AZ::IO::ByteContainerStream<decltype(compactBuffer)> compactStream(&compactBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(compactStream, AZ::DataStream::ST_BINARY_COMPACT, &saveObject, m_serializeContext.get()));
+
+        EXPECT_LT(compactBuffer.size() * 2, binaryBuffer.size());
+    }
+
+    TEST_F(CompactBinaryObjectStream, Load_ChangedLayout_LoadsFieldsByName)
+    {
+        CompactMixedStruct saveObject = CreateTestObject();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY_COMPACT, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        ReflectReorderedPlainDataStruct();
+
+        CompactMixedStruct loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+
+        // The float field is no longer reflected, so it keeps its default value.
+        EXPECT_EQ(saveObject.m_name, loadObject.m_name);
+        EXPECT_EQ(saveObject.m_single.m_int, loadObject.m_single.m_int);
+        EXPECT_EQ(saveObject.m_single.m_bool, loadObject.m_single.m_bool);
+        EXPECT_EQ(saveObject.m_single.m_double, loadObject.m_single.m_double);
+        EXPECT_EQ(0.0f, loadObject.m_single.m_float);
+        ASSERT_EQ(saveObject.m_values.size(), loadObject.m_values.size());
+        for (size_t i = 0; i < saveObject.m_values.size(); ++i)
+        {
+            EXPECT_EQ(saveObject.m_values[i].m_int, loadObject.m_values[i].m_int);
+            EXPECT_EQ(saveObject.m_values[i].m_double, loadObject.m_values[i].m_double);
+        }
+        EXPECT_EQ(saveObject.m_flag, loadObject.m_flag);
+    }
+
+    TEST_F(CompactBinaryObjectStream, Load_OldVersion_RunsVersionConverter)
+    {
+        CompactMixedStruct saveObject = CreateTestObject();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY_COMPACT, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        auto versionConverter = [](AZ::SerializeContext& context, AZ::SerializeContext::DataElementNode& classElement) -> bool
+        {
+            int value = 0;
+            if (!classElement.FindSubElementAndGetData(AZ_CRC("int"), value))
+            {
+                return false;
+            }
+            AZ::SerializeContext::DataElementNode* intNode = classElement.FindSubElement(AZ_CRC("int"));
+            return intNode->SetData(context, value + 1000);
+        };
+
+        m_serializeContext->EnableRemoveReflection();
+        CompactPlainDataStruct::Reflect(*m_serializeContext);
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<CompactPlainDataStruct>()
+            ->Version(1, versionConverter)
+            ->Field("int", &CompactPlainDataStruct::m_int)
+            ->Field("float", &CompactPlainDataStruct::m_float)
+            ->Field("bool", &CompactPlainDataStruct::m_bool)
+            ->Field("double", &CompactPlainDataStruct::m_double)
+            ;
+
+        CompactMixedStruct loadObject;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+
+        EXPECT_EQ(saveObject.m_single.m_int + 1000, loadObject.m_single.m_int);
+        EXPECT_EQ(saveObject.m_single.m_float, loadObject.m_single.m_float);
+        ASSERT_EQ(saveObject.m_values.size(), loadObject.m_values.size());
+        for (size_t i = 0; i < saveObject.m_values.size(); ++i)
+        {
+            EXPECT_EQ(saveObject.m_values[i].m_int + 1000, loadObject.m_values[i].m_int);
+            EXPECT_EQ(saveObject.m_values[i].m_double, loadObject.m_values[i].m_double);
+        }
+        EXPECT_EQ(saveObject.m_flag, loadObject.m_flag);
+    }
+
+    TEST_F(CompactBinaryObjectStream, Load_DifferentByteOrder_Fails)
+    {
+        CompactMixedStruct saveObject = CreateTestObject();
+
+        AZStd::vector<AZ::u8> byteBuffer;
+        AZ::IO::ByteContainerStream<decltype(byteBuffer)> byteStream(&byteBuffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(byteStream, AZ::DataStream::ST_BINARY_COMPACT, &saveObject, m_serializeContext.get()));
+        byteStream.Seek(0, AZ::IO::GenericStream::SeekMode::ST_SEEK_BEGIN);
+
+        // The byte order mark follows the stream tag and the version.
+        AZStd::swap(byteBuffer[5], byteBuffer[6]);
+
+        CompactMixedStruct loadObject;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(AZ::Utils::LoadObjectFromStreamInPlace(byteStream, loadObject, m_serializeContext.get()));
+        AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+    }
+
     class GenericClassInfoExplicitReflectFixture
         : public AllocatorsFixture
     {
@@ -5,6 +5,10 @@
  *
  */
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Serialization/Json/BasicContainerSerializer.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/list.h>
@@ -431,4 +435,167 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Unavailable, result.GetOutcome());
         EXPECT_NE(instance.end(), instance.find(188));
     }
+
+    // Tests for loading the elements of a basic container on the job system
+
+    class JsonParallelVectorSerializerTests
+        : public JsonBasicContainerSerializerTests
+    {
+    public:
+        using Container = AZStd::vector<SimpleClass*>;
+        static constexpr int ElementCount = 64;
+        static constexpr int InvalidElementInterval = 8;
+
+        void SetUp() override
+        {
+            JsonBasicContainerSerializerTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+        }
+
+        void TearDown() override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            JsonBasicContainerSerializerTests::TearDown();
+        }
+
+        void RegisterAdditional(AZStd::unique_ptr<AZ::SerializeContext>& serializeContext) override
+        {
+            SimpleClass::Reflect(serializeContext, true);
+            serializeContext->RegisterGenericType<Container>();
+        }
+
+        //! Creates an array of objects where every few objects have a field that can't be loaded, so issues are reported.
+        void CreateInput(rapidjson::Value& input)
+        {
+            auto& allocator = m_jsonDocument->GetAllocator();
+            input.SetArray();
+            for (int i = 0; i < ElementCount; ++i)
+            {
+                rapidjson::Value element(rapidjson::kObjectType);
+                if (i % InvalidElementInterval == 0)
+                {
+                    element.AddMember("var1", rapidjson::StringRef("invalid"), allocator);
+                }
+                else
+                {
+                    element.AddMember("var1", i, allocator);
+                }
+                element.AddMember("var2", aznumeric_cast<double>(i) * 0.5, allocator);
+                input.PushBack(AZStd::move(element), allocator);
+            }
+        }
+
+        AZ::JsonSerializationResult::ResultCode Load(Container& instance, const rapidjson::Value& input,
+            AZStd::vector<AZStd::string>& reports, bool loadInParallel)
+        {
+            using namespace AZ::JsonSerializationResult;
+
+            m_deserializationSettings->m_reporting = [&reports](AZStd::string_view message, ResultCode result, AZStd::string_view path)
+            {
+                reports.push_back(AZStd::string::format("%.*s: %.*s", AZ_STRING_ARG(path), AZ_STRING_ARG(message)));
+                return result;
+            };
+            m_deserializationSettings->m_jobContext = loadInParallel ? m_jobContext : nullptr;
+            m_deserializationSettings->m_parallelLoadThreshold = loadInParallel ? 2 : 0;
+            ResetJsonContexts();
+
+            return m_serializer->Load(&instance, azrtti_typeid(&instance), input, *m_jsonDeserializationContext);
+        }
+
+        static void Clear(Container& instance)
+        {
+            for (SimpleClass* element : instance)
+            {
+                delete element;
+            }
+            instance.clear();
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(JsonParallelVectorSerializerTests, Load_LoadInParallel_SameValuesAsSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value input;
+        CreateInput(input);
+
+        Container sequential;
+        AZStd::vector<AZStd::string> sequentialReports;
+        ResultCode sequentialResult = Load(sequential, input, sequentialReports, false);
+
+        Container parallel;
+        AZStd::vector<AZStd::string> parallelReports;
+        ResultCode parallelResult = Load(parallel, input, parallelReports, true);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        ASSERT_EQ(sequential.size(), parallel.size());
+        for (size_t i = 0; i < parallel.size(); ++i)
+        {
+            ASSERT_NE(nullptr, parallel[i]);
+            EXPECT_EQ(*sequential[i], *parallel[i]);
+        }
+
+        Clear(sequential);
+        Clear(parallel);
+    }
+
+    TEST_F(JsonParallelVectorSerializerTests, Load_LoadInParallel_IssuesReportedInDocumentOrder)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        rapidjson::Value input;
+        CreateInput(input);
+
+        Container sequential;
+        AZStd::vector<AZStd::string> sequentialReports;
+        Load(sequential, input, sequentialReports, false);
+
+        Container parallel;
+        AZStd::vector<AZStd::string> parallelReports;
+        Load(parallel, input, parallelReports, true);
+
+        EXPECT_FALSE(parallelReports.empty());
+        EXPECT_EQ(sequentialReports, parallelReports);
+
+        Clear(sequential);
+        Clear(parallel);
+    }
+
+    TEST_F(JsonParallelVectorSerializerTests, ShouldLoadInParallel_BelowThreshold_ReturnsFalse)
+    {
+        m_deserializationSettings->m_jobContext = m_jobContext;
+        m_deserializationSettings->m_parallelLoadThreshold = ElementCount;
+        ResetJsonContexts();
+
+        EXPECT_FALSE(m_jsonDeserializationContext->ShouldLoadInParallel(ElementCount - 1));
+        EXPECT_TRUE(m_jsonDeserializationContext->ShouldLoadInParallel(ElementCount));
+    }
+
+    TEST_F(JsonParallelVectorSerializerTests, ShouldLoadInParallel_NoThreshold_ReturnsFalse)
+    {
+        m_deserializationSettings->m_jobContext = m_jobContext;
+        m_deserializationSettings->m_parallelLoadThreshold = 0;
+        ResetJsonContexts();
+
+        EXPECT_FALSE(m_jsonDeserializationContext->ShouldLoadInParallel(ElementCount));
+    }
 } // namespace JsonSerializationTests
@@ -6,6 +6,9 @@
  */
 
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/Serialization/Json/MapSerializer.h>
 #include <AzCore/std/containers/map.h>
 #include <AzCore/std/string/string.h>
@@ -906,4 +909,87 @@ namespace JsonSerializationTests
                 { "Key": 32, "Value": 32 }
             ])");
     }
+
+    class JsonParallelMapSerializerTests
+        : public JsonMapSerializerTests
+    {
+    public:
+        static constexpr int ElementCount = 64;
+
+        void SetUp() override
+        {
+            JsonMapSerializerTests::SetUp();
+
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            jobDesc.m_workerThreads.push_back(threadDesc);
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+        }
+
+        void TearDown() override
+        {
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+
+            JsonMapSerializerTests::TearDown();
+        }
+
+        AZ::JsonSerializationResult::ResultCode Load(TestStringMap& instance, AZStd::vector<AZStd::string>& reports, bool loadInParallel)
+        {
+            using namespace AZ::JsonSerializationResult;
+
+            m_deserializationSettings->m_reporting = [&reports](AZStd::string_view message, ResultCode result, AZStd::string_view path)
+            {
+                reports.push_back(AZStd::string::format("%.*s: %.*s", AZ_STRING_ARG(path), AZ_STRING_ARG(message)));
+                return result;
+            };
+            m_deserializationSettings->m_jobContext = loadInParallel ? m_jobContext : nullptr;
+            m_deserializationSettings->m_parallelLoadThreshold = loadInParallel ? 2 : 0;
+            ResetJsonContexts();
+
+            return m_unorderedMapSerializer.Load(&instance, azrtti_typeid(&instance), *m_jsonDocument, *m_jsonDeserializationContext);
+        }
+
+    protected:
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    TEST_F(JsonParallelMapSerializerTests, Load_LoadInParallel_SameValuesAndReportsAsSequentialLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->SetObject();
+        for (int i = 0; i < ElementCount; ++i)
+        {
+            // Every few entries reuses an earlier key so duplicates are reported as well.
+            const int key = (i % 8 == 7) ? i - 1 : i;
+            m_jsonDocument->AddMember(
+                rapidjson::Value(AZStd::string::format("Key%i", key).c_str(), m_jsonDocument->GetAllocator()),
+                rapidjson::Value(AZStd::string::format("Value%i", i).c_str(), m_jsonDocument->GetAllocator()),
+                m_jsonDocument->GetAllocator());
+        }
+
+        TestStringMap sequential;
+        AZStd::vector<AZStd::string> sequentialReports;
+        ResultCode sequentialResult = Load(sequential, sequentialReports, false);
+
+        TestStringMap parallel;
+        AZStd::vector<AZStd::string> parallelReports;
+        ResultCode parallelResult = Load(parallel, parallelReports, true);
+
+        EXPECT_EQ(sequentialResult.GetProcessing(), parallelResult.GetProcessing());
+        EXPECT_EQ(sequentialResult.GetOutcome(), parallelResult.GetOutcome());
+        EXPECT_EQ(sequential, parallel);
+        EXPECT_FALSE(parallelReports.empty());
+        EXPECT_EQ(sequentialReports, parallelReports);
+    }
 } // namespace JsonSerializationTests
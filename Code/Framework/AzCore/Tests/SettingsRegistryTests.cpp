@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1755,4 +1756,137 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    //
+    // Snapshots
+    //
+
+    class SettingsRegistrySnapshotTest
+        : public SettingsRegistryTest
+    {
+    public:
+        void MergeTestFolderWithSnapshot()
+        {
+            m_snapshotKey = m_registry->GetSnapshotKey({ "editor" }, "Special");
+            const size_t historyStart = m_registry->GetFileHistoryCount();
+
+            AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, { "editor" }, "Special"));
+            m_snapshotPath = AZStd::string::format("%s/Registry.snapshot", m_testFolder->c_str());
+            ASSERT_TRUE(m_registry->SaveSnapshot(m_snapshotPath.c_str(), m_snapshotKey, historyStart, "Special"));
+        }
+
+    protected:
+        AZStd::string m_snapshotPath;
+        AZ::u64 m_snapshotKey = 0;
+    };
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_UnchangedFiles_RestoresAllValueTypes)
+    {
+        CreateTestFile("Values.setreg", R"({ "Values": { "Bool": true, "Negative": -42, "Large": 18446744073709551615,
+            "Double": 0.5, "String": "Hello", "Array": [ 1, null, { "Nested": false } ] } })");
+        CreateTestFile("Values.editor.setreg", R"({ "Values": { "Editor": "Yes" } })");
+        CreateTestFile("Platform/Special/Values.setreg", R"({ "Values": { "Platform": 3 } })");
+        MergeTestFolderWithSnapshot();
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_EQ(m_snapshotKey, registry.GetSnapshotKey({ "editor" }, "Special"));
+        ASSERT_TRUE(registry.LoadSnapshot(m_snapshotPath.c_str(), m_snapshotKey));
+
+        bool boolValue = false;
+        AZ::s64 negativeValue = 0;
+        AZ::u64 largeValue = 0;
+        double doubleValue = 0.0;
+        AZStd::string stringValue;
+        AZ::s64 platformValue = 0;
+        EXPECT_TRUE(registry.Get(boolValue, "/Values/Bool"));
+        EXPECT_TRUE(boolValue);
+        EXPECT_TRUE(registry.Get(negativeValue, "/Values/Negative"));
+        EXPECT_EQ(-42, negativeValue);
+        EXPECT_TRUE(registry.Get(largeValue, "/Values/Large"));
+        EXPECT_EQ((std::numeric_limits<AZ::u64>::max)(), largeValue);
+        EXPECT_TRUE(registry.Get(doubleValue, "/Values/Double"));
+        EXPECT_DOUBLE_EQ(0.5, doubleValue);
+        EXPECT_TRUE(registry.Get(stringValue, "/Values/String"));
+        EXPECT_STREQ("Hello", stringValue.c_str());
+        EXPECT_TRUE(registry.Get(stringValue, "/Values/Editor"));
+        EXPECT_STREQ("Yes", stringValue.c_str());
+        EXPECT_TRUE(registry.Get(platformValue, "/Values/Platform"));
+        EXPECT_EQ(3, platformValue);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, registry.GetType("/Values/Array/1"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, registry.GetType("/Values/Array/2/Nested"));
+        EXPECT_EQ(m_registry->GetFileHistoryCount(), registry.GetFileHistoryCount());
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_ChangedFile_ReturnsFalse)
+    {
+        CreateTestFile("Values.setreg", R"({ "Values": { "Number": 1 } })");
+        MergeTestFolderWithSnapshot();
+        CreateTestFile("Values.setreg", R"({ "Values": { "Number": 2 } })");
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.LoadSnapshot(m_snapshotPath.c_str(), m_snapshotKey));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Values"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_AddedPlatformFile_ReturnsFalse)
+    {
+        CreateTestFile("Values.setreg", R"({ "Values": { "Number": 1 } })");
+        MergeTestFolderWithSnapshot();
+        CreateTestFile("Platform/Special/Values.setreg", R"({ "Values": { "Number": 2 } })");
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.LoadSnapshot(m_snapshotPath.c_str(), m_snapshotKey));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_DifferentRegistryState_ReturnsFalse)
+    {
+        CreateTestFile("Values.setreg", R"({ "Values": { "Number": 1 } })");
+        MergeTestFolderWithSnapshot();
+
+        AZ::SettingsRegistryImpl registry;
+        registry.Set("/Override", true);
+        const AZ::u64 key = registry.GetSnapshotKey({ "editor" }, "Special");
+        EXPECT_NE(m_snapshotKey, key);
+        EXPECT_FALSE(registry.LoadSnapshot(m_snapshotPath.c_str(), key));
+        EXPECT_NE(m_snapshotKey, AZ::SettingsRegistryImpl().GetSnapshotKey({ "editor", "test" }, "Special"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_MissingOrCorruptSnapshot_ReturnsFalse)
+    {
+        CreateTestFile("Values.setreg", R"({ "Values": { "Number": 1 } })");
+        MergeTestFolderWithSnapshot();
+
+        AZ::SettingsRegistryImpl registry;
+        AZStd::string missingPath = AZStd::string::format("%s/Missing.snapshot", m_testFolder->c_str());
+        EXPECT_FALSE(registry.LoadSnapshot(missingPath.c_str(), m_snapshotKey));
+
+        // Cut the snapshot short so the settings can't be read completely.
+        const AZ::u64 snapshotSize = AZ::IO::SystemFile::Length(m_snapshotPath.c_str());
+        AZStd::vector<char> snapshot(snapshotSize);
+        AZ::IO::SystemFile::Read(m_snapshotPath.c_str(), snapshot.data(), snapshotSize);
+        AZ::IO::SystemFile file;
+        ASSERT_TRUE(file.Open(m_snapshotPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+        file.Write(snapshot.data(), snapshotSize - 4);
+        file.Close();
+        EXPECT_FALSE(registry.LoadSnapshot(m_snapshotPath.c_str(), m_snapshotKey));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Values"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, Read_ArrayCountLargerThanSnapshot_ReturnsFalseWithoutReserving)
+    {
+        rapidjson::Document settings;
+        settings.SetArray();
+        settings.PushBack(true, settings.GetAllocator());
+
+        AZStd::vector<char> buffer;
+        AZ::SettingsRegistrySnapshot::Write(buffer, 0, {}, settings);
+
+        // The snapshot ends with the array count followed by the tag of its only element.
+        constexpr AZ::u32 corruptCount = (std::numeric_limits<AZ::u32>::max)();
+        memcpy(buffer.data() + buffer.size() - sizeof(AZ::u8) - sizeof(AZ::u32), &corruptCount, sizeof(corruptCount));
+
+        rapidjson::Document restored;
+        EXPECT_FALSE(AZ::SettingsRegistrySnapshot::Read(restored, reinterpret_cast<const AZ::u8*>(buffer.data()), buffer.size(), 0));
+    }
 } // namespace SettingsRegistryTests
@@ -11,6 +11,8 @@
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -93,13 +95,13 @@ namespace AZ::IO
             UnitTest::AllocatorsFixture::TearDown();
         }
 
-        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs)
+        void SetupEnvironment(u32 maxNumReads, u32 maxNumJobs, bool useSharedJobPool = false)
         {
             m_buffer = new u32[m_fakeFileLength >> 2];
 
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_decompressor = AZStd::make_shared<FullFileDecompressor>(maxNumReads, maxNumJobs,
-                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment);
+                FullFileDecompressorTestDescription::m_arbitrarilyLargeAlignment, useSharedJobPool);
 
             m_context = new StreamerContext();
             m_decompressor->SetContext(*m_context);
@@ -393,4 +395,50 @@ namespace AZ::IO
         SetupEnvironment(4, 4);
         ProcessMultipleCompressedReads();
     }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_MultipleRequestsOnSharedJobPool_AllRequestsComplete)
+    {
+        JobManagerDesc jobDesc;
+        jobDesc.m_workerThreads.resize(2);
+        JobManager jobManager(jobDesc);
+        JobContext jobContext(jobManager);
+        JobContext::SetGlobalContext(&jobContext);
+
+        SetupEnvironment(4, 4, true);
+        ProcessMultipleCompressedReads();
+
+        // The decompressor uses the global job manager, so release it before the job manager goes out of scope.
+        m_decompressor.reset();
+        JobContext::SetGlobalContext(nullptr);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, CollectStatistics_MultipleRequests_ReadBuffersAreReusedAndThroughputIsReported)
+    {
+        using ::testing::_;
+
+        SetupEnvironment(1, 1);
+        ProcessMultipleCompressedReads();
+
+        EXPECT_CALL(*m_mock, CollectStatistics(_)).Times(1);
+        AZStd::vector<Statistic> statistics;
+        m_decompressor->CollectStatistics(statistics);
+
+        bool foundReuse = false;
+        bool foundThroughput = false;
+        for (const Statistic& statistic : statistics)
+        {
+            if (statistic.GetName() == "Reused read buffers")
+            {
+                foundReuse = true;
+                EXPECT_LT(0.0, statistic.GetPercentage());
+            }
+            else if (statistic.GetName() == "Decompression throughput (avg. mbps)")
+            {
+                foundThroughput = true;
+                EXPECT_LT(0.0, statistic.GetFloatValue());
+            }
+        }
+        EXPECT_TRUE(foundReuse);
+        EXPECT_TRUE(foundThroughput);
+    }
 } // namespace AZ::IO
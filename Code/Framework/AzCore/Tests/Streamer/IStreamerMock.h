@@ -23,6 +23,10 @@ public:
         size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
     MOCK_METHOD7(Read, FileRequestPtr& (FileRequestPtr&, AZStd::string_view, IStreamerTypes::RequestMemoryAllocator&,
         size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
+    MOCK_METHOD6(ReadView, FileRequestPtr(AZStd::string_view, IStreamerTypes::RequestMemoryAllocator&,
+        size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
+    MOCK_METHOD7(ReadView, FileRequestPtr& (FileRequestPtr&, AZStd::string_view, IStreamerTypes::RequestMemoryAllocator&,
+        size_t, AZStd::chrono::microseconds, IStreamerTypes::Priority, size_t));
     MOCK_METHOD1(Cancel, FileRequestPtr(FileRequestPtr));
     MOCK_METHOD2(Cancel, FileRequestPtr& (FileRequestPtr&, FileRequestPtr));
     MOCK_METHOD3(RescheduleRequest, FileRequestPtr(FileRequestPtr, AZStd::chrono::microseconds, IStreamerTypes::Priority));
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/AzTest.h>
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/IStreamerTypesMock.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class MemoryMappedReaderTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<MemoryMappedReader>
+    {
+    public:
+        MemoryMappedReader CreateInstance() override
+        {
+            return MemoryMappedReader(4, AZCORE_GLOBAL_NEW_ALIGNMENT, 1);
+        }
+
+        bool UsesSlots() const override
+        {
+            return false;
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_MemoryMappedReaderConformityTests, StreamStackEntryConformityTests, MemoryMappedReaderTestDescription);
+
+    class Streamer_MemoryMappedReaderTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_archiveFilename[] = "MemoryMappedReaderArchive.bin";
+        static constexpr u64 s_archiveSize = 64_kib;
+
+        Streamer_MemoryMappedReaderTest()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+        }
+
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+
+            m_context = new StreamerContext();
+            m_reader = AZStd::make_shared<MemoryMappedReader>(2, AZCORE_GLOBAL_NEW_ALIGNMENT, 1);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_reader->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_reader->SetContext(*m_context);
+
+            EXPECT_CALL(m_allocator, LockAllocator()).Times(AnyNumber());
+            EXPECT_CALL(m_allocator, UnlockAllocator()).Times(AnyNumber());
+            ON_CALL(m_allocator, Allocate(_, _, _))
+                .WillByDefault(Invoke(&m_allocator, &IStreamerTypes::RequestMemoryAllocatorMock::ForwardAllocate));
+            ON_CALL(m_allocator, Release(_))
+                .WillByDefault(Invoke(&m_allocator, &IStreamerTypes::RequestMemoryAllocatorMock::ForwardRelease));
+
+            CreateArchive();
+        }
+
+        void TearDown() override
+        {
+            m_reader.reset();
+            m_mock.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            if (!m_archivePath.empty())
+            {
+                SystemFile::Delete(m_archivePath.c_str());
+            }
+        }
+
+        void CreateArchive()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            ASSERT_EQ(AZ::Utils::ExecutablePathResult::Success, result.m_pathStored);
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!SystemFile::Exists(filePath.c_str()))
+            {
+                ASSERT_TRUE(SystemFile::CreateDir(filePath.c_str()));
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_archiveFilename, m_archivePath);
+
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_archivePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_READ_WRITE));
+            AZStd::vector<u8> data(s_archiveSize);
+            for (u64 i = 0; i < s_archiveSize; ++i)
+            {
+                data[i] = aznumeric_cast<u8>(i & 0xff);
+            }
+            ASSERT_EQ(s_archiveSize, file.Write(data.data(), data.size()));
+            file.Close();
+        }
+
+        //! Creates the chain of requests that the FullFileDecompressor creates for an uncompressed file in an archive.
+        FileRequest* CreateArchiveRead(u64 offset, u64 size, bool allowView)
+        {
+            FileRequest* readRequest = CreateReadRequest(offset, size, allowView);
+
+            FileRequest* pathStore = m_context->GetNewInternalRequest();
+            RequestPath archivePath;
+            archivePath.InitFromAbsolutePath(m_archivePath);
+            pathStore->CreateRequestPathStore(readRequest, AZStd::move(archivePath));
+            auto& storedPath = AZStd::get<FileRequest::RequestPathStoreData>(pathStore->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            auto& readRequestData = AZStd::get<FileRequest::ReadRequestData>(readRequest->GetCommand());
+            read->CreateRead(pathStore, readRequestData.m_output, readRequestData.m_outputSize, storedPath.m_path, offset, size);
+            return read;
+        }
+
+        //! Creates the chain of requests that's created for a loose file.
+        FileRequest* CreateLooseFileRead(u64 offset, u64 size, bool allowView)
+        {
+            FileRequest* readRequest = CreateReadRequest(offset, size, allowView);
+            auto& readRequestData = AZStd::get<FileRequest::ReadRequestData>(readRequest->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(readRequest, nullptr, 0, readRequestData.m_path, offset, size);
+            return read;
+        }
+
+        FileRequest* CreateReadRequest(u64 offset, u64 size, bool allowView)
+        {
+            RequestPath path;
+            path.InitFromAbsolutePath(m_archivePath);
+
+            FileRequest* readRequest = m_context->GetNewInternalRequest();
+            readRequest->CreateReadRequest(AZStd::move(path), &m_allocator, offset, size, FileRequest::s_noDeadlineTime,
+                IStreamerTypes::s_priorityMedium, allowView);
+            readRequest->SetCompletionCallback([this](FileRequest& request)
+            {
+                auto& data = AZStd::get<FileRequest::ReadRequestData>(request.GetCommand());
+                m_status = request.GetStatus();
+                m_memoryType = data.m_memoryType;
+                m_output = reinterpret_cast<const u8*>(data.m_output);
+                m_dataIsCorrect = m_output != nullptr;
+                for (u64 i = 0; i < data.m_size && m_dataIsCorrect; ++i)
+                {
+                    m_dataIsCorrect = m_output[i] == aznumeric_cast<u8>((data.m_offset + i) & 0xff);
+                }
+            });
+            return readRequest;
+        }
+
+        void CompleteForwardedRead(FileRequest* request)
+        {
+            auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+            SystemFile file;
+            bool success = data.m_output != nullptr && file.Open(data.m_path.GetAbsolutePath(), SystemFile::SF_OPEN_READ_ONLY);
+            if (success)
+            {
+                file.Seek(data.m_offset, SystemFile::SF_SEEK_BEGIN);
+                success = file.Read(data.m_size, data.m_output) == data.m_size;
+            }
+            request->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        void CompleteRequest(FileRequest* request)
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+    protected:
+        UnitTest::TestFileIOBase m_fileIO;
+        ::testing::NiceMock<IStreamerTypes::RequestMemoryAllocatorMock> m_allocator;
+        AZStd::string m_archivePath;
+        StreamerContext* m_context{ nullptr };
+        AZStd::shared_ptr<MemoryMappedReader> m_reader;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+
+        IStreamerTypes::RequestStatus m_status{ IStreamerTypes::RequestStatus::Pending };
+        IStreamerTypes::MemoryType m_memoryType{ IStreamerTypes::MemoryType::ReadWrite };
+        const u8* m_output{ nullptr };
+        bool m_dataIsCorrect{ false };
+    };
+
+    TEST_F(Streamer_MemoryMappedReaderTest, SetContext_ReaderIsInStack_ReadOnlyViewsAreEnabled)
+    {
+        EXPECT_TRUE(m_context->AreReadOnlyViewsEnabled());
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_ArchiveReadAllowsView_ServedAsViewWithoutCopying)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(m_allocator, Allocate(_, _, _)).Times(0);
+
+        m_reader->QueueRequest(CreateArchiveRead(1_kib, 4_kib, true));
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_status);
+        EXPECT_EQ(IStreamerTypes::MemoryType::ReadOnlyView, m_memoryType);
+        EXPECT_TRUE(m_dataIsCorrect);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_ArchiveReadDoesNotAllowView_RequestIsForwarded)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1).WillOnce(Invoke(this, &Streamer_MemoryMappedReaderTest::CompleteRequest));
+        EXPECT_CALL(m_allocator, Allocate(_, _, _)).Times(0);
+
+        m_reader->QueueRequest(CreateArchiveRead(0, 4_kib, false));
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_status);
+        EXPECT_NE(IStreamerTypes::MemoryType::ReadOnlyView, m_memoryType);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_LooseFileAllowsView_MemoryIsAllocatedAndRequestIsForwarded)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1).WillOnce(Invoke(this, &Streamer_MemoryMappedReaderTest::CompleteForwardedRead));
+        EXPECT_CALL(m_allocator, Allocate(_, _, _)).Times(1);
+
+        m_reader->QueueRequest(CreateLooseFileRead(2_kib, 4_kib, true));
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_status);
+        EXPECT_EQ(IStreamerTypes::MemoryType::ReadWrite, m_memoryType);
+        EXPECT_TRUE(m_dataIsCorrect);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_ReadPastEndOfArchive_MemoryIsAllocatedAndRequestIsForwarded)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1).WillOnce(Invoke(this, &Streamer_MemoryMappedReaderTest::CompleteRequest));
+        EXPECT_CALL(m_allocator, Allocate(_, _, _)).Times(1);
+
+        m_reader->QueueRequest(CreateArchiveRead(s_archiveSize - 1_kib, 4_kib, true));
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_NE(IStreamerTypes::MemoryType::ReadOnlyView, m_memoryType);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_AllocationFails_RequestFails)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(0);
+        EXPECT_CALL(m_allocator, Allocate(_, _, _))
+            .Times(1)
+            .WillOnce(Return(IStreamerTypes::RequestMemoryAllocatorResult{ nullptr, 0, IStreamerTypes::MemoryType::ReadWrite }));
+
+        m_reader->QueueRequest(CreateLooseFileRead(0, 4_kib, true));
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, m_status);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, QueueRequest_FlushAllWhileViewIsInUse_ViewRemainsValid)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, QueueRequest(_)).Times(1).WillOnce(Invoke(this, &Streamer_MemoryMappedReaderTest::CompleteRequest));
+
+        m_reader->QueueRequest(CreateArchiveRead(8_kib, 16_kib, true));
+
+        FileRequest* flush = m_context->GetNewInternalRequest();
+        flush->CreateFlushAll();
+        m_reader->QueueRequest(flush);
+
+        // The completion callback reads from the view after the archive was removed from the reader.
+        m_context->FinalizeCompletedRequests();
+
+        EXPECT_EQ(IStreamerTypes::MemoryType::ReadOnlyView, m_memoryType);
+        EXPECT_TRUE(m_dataIsCorrect);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderTest, CollectStatistics_ReadServedAsView_ReportsViewPercentage)
+    {
+        using ::testing::_;
+
+        EXPECT_CALL(*m_mock, CollectStatistics(_)).Times(1);
+
+        m_reader->QueueRequest(CreateArchiveRead(0, 1_kib, true));
+        m_context->FinalizeCompletedRequests();
+
+        AZStd::vector<Statistic> statistics;
+        m_reader->CollectStatistics(statistics);
+
+        bool found = false;
+        for (const Statistic& statistic : statistics)
+        {
+            if (statistic.GetName() == "Reads served as views")
+            {
+                found = true;
+                EXPECT_DOUBLE_EQ(1.0, statistic.GetPercentage());
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+} // namespace AZ::IO
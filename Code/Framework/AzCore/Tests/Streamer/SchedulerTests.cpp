@@ -250,6 +250,39 @@ namespace AZ::IO
         allocatorMock.ForwardRelease(buffer);
     }
 
+    TEST_F(Streamer_SchedulerTest, GetReadRequestResult_ClaimMemoryFromReadView_ClaimIsRejectedAndMemoryStaysWithRequest)
+    {
+        MockForRead();
+
+        AZStd::binary_semaphore allocatorSync;
+        IStreamerTypes::RequestMemoryAllocatorMock allocatorMock;
+        MockAllocatorForUnclaimedMemory(allocatorMock, allocatorSync);
+
+        AZStd::binary_semaphore readSync;
+        auto wait = [&readSync](FileRequestHandle)
+        {
+            readSync.release();
+        };
+
+        {
+            FileRequestPtr read = m_streamer->ReadView("TestPath", allocatorMock, 8);
+            m_streamer->SetRequestCompleteCallback(read, wait);
+            m_streamer->QueueRequest(read);
+            ASSERT_TRUE(readSync.try_acquire_for(AZStd::chrono::seconds(5)));
+
+            void* buffer = nullptr;
+            u64 readSize = 0;
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            EXPECT_FALSE(m_streamer->GetReadRequestResult(read, buffer, readSize, IStreamerTypes::ClaimMemory::Yes));
+            AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+            EXPECT_EQ(nullptr, buffer);
+            EXPECT_EQ(0, readSize);
+        }
+
+        // The request still owns the memory, so releasing the request releases the memory and unlocks the allocator.
+        ASSERT_TRUE(allocatorSync.try_acquire_for(AZStd::chrono::seconds(5)));
+    }
+
     TEST_F(Streamer_SchedulerTest, ProcessCancelRequest_CancelReadRequest_MockDoesNotReceiveReadRequest)
     {
         using ::testing::_;
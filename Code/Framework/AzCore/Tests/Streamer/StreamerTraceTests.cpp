@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzTest/AzTest.h>
+
+namespace AZ::IO
+{
+    class Streamer_StreamerTraceTest
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr char s_traceFilename[] = "StreamerTraceTest.azstrace";
+
+        void SetUp() override
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            ASSERT_EQ(AZ::Utils::ExecutablePathResult::Success, result.m_pathStored);
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_traceFilename, m_tracePath);
+        }
+
+        void TearDown() override
+        {
+            if (SystemFile::Exists(m_tracePath.c_str()))
+            {
+                SystemFile::Delete(m_tracePath.c_str());
+            }
+        }
+
+        FileRequest::ReadRequestData CreateReadRequest(const char* path, u64 offset, u64 size,
+            AZStd::chrono::system_clock::time_point deadline = FileRequest::s_noDeadlineTime)
+        {
+            RequestPath requestPath;
+            requestPath.InitFromRelativePath(path);
+            return FileRequest::ReadRequestData(AZStd::move(requestPath), m_buffer, sizeof(m_buffer), offset, size, deadline,
+                IStreamerTypes::s_priorityHigh);
+        }
+
+    protected:
+        AZStd::string m_tracePath;
+        u8 m_buffer[64];
+    };
+
+    TEST_F(Streamer_StreamerTraceTest, AddPath_SamePathAddedTwice_PathIsStoredOnce)
+    {
+        StreamerTrace trace;
+        u32 first = trace.AddPath("Streamer/first.bin");
+        u32 second = trace.AddPath("Streamer/second.bin");
+        u32 again = trace.AddPath("Streamer/first.bin");
+
+        EXPECT_NE(first, second);
+        EXPECT_EQ(first, again);
+        EXPECT_EQ(2, trace.GetPaths().size());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, SaveAndLoad_TraceWithRecords_LoadedTraceMatchesOriginal)
+    {
+        StreamerTrace trace;
+        StreamerTraceRecord record;
+        record.m_issueTimeUs = 10;
+        record.m_completionTimeUs = 250;
+        record.m_offset = 4096;
+        record.m_size = 1024;
+        record.m_deadlineUs = 500;
+        record.m_pathIndex = trace.AddPath("Streamer/first.bin");
+        record.m_priority = IStreamerTypes::s_priorityLow;
+        record.m_flags = StreamerTraceRecord::s_flagCompleted;
+        trace.AddRecord(record);
+
+        record.m_issueTimeUs = 20;
+        record.m_deadlineUs = StreamerTraceRecord::s_noDeadline;
+        record.m_pathIndex = trace.AddPath("Streamer/second.bin");
+        record.m_flags = StreamerTraceRecord::s_flagAllowReadOnlyView;
+        trace.AddRecord(record);
+
+        ASSERT_TRUE(trace.Save(m_tracePath.c_str()));
+
+        StreamerTrace loaded;
+        ASSERT_TRUE(loaded.Load(m_tracePath.c_str()));
+        ASSERT_EQ(trace.GetPaths().size(), loaded.GetPaths().size());
+        for (u32 i = 0; i < trace.GetPaths().size(); ++i)
+        {
+            EXPECT_STREQ(trace.GetPath(i).c_str(), loaded.GetPath(i).c_str());
+        }
+        ASSERT_EQ(trace.GetRecords().size(), loaded.GetRecords().size());
+        for (size_t i = 0; i < trace.GetRecords().size(); ++i)
+        {
+            EXPECT_EQ(0, memcmp(&trace.GetRecords()[i], &loaded.GetRecords()[i], sizeof(StreamerTraceRecord)));
+        }
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Load_FileIsNotATrace_ReturnsFalse)
+    {
+        SystemFile file;
+        ASSERT_TRUE(file.Open(m_tracePath.c_str(),
+            SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY));
+        constexpr char content[] = "This is not a Streamer trace, but it's long enough to contain a header.";
+        file.Write(content, sizeof(content));
+        file.Close();
+
+        StreamerTrace trace;
+        EXPECT_FALSE(trace.Load(m_tracePath.c_str()));
+        EXPECT_TRUE(trace.GetRecords().empty());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, Stop_NoRecordingStarted_ReturnsFalse)
+    {
+        StreamerTraceRecorder recorder;
+        StreamerTrace trace;
+        EXPECT_FALSE(recorder.IsRecording());
+        EXPECT_FALSE(recorder.Stop(trace));
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, RecordIssue_RequestCompleted_RecordContainsRequestAndCompletion)
+    {
+        StreamerTraceRecorder recorder;
+        recorder.Start();
+        EXPECT_TRUE(recorder.IsRecording());
+
+        FileRequest::ReadRequestData request = CreateReadRequest("Streamer/file.bin", 128, 32);
+        StreamerTraceRecorder::Ticket ticket = recorder.RecordIssue(request);
+        recorder.RecordCompletion(ticket, IStreamerTypes::RequestStatus::Completed);
+
+        StreamerTrace trace;
+        ASSERT_TRUE(recorder.Stop(trace));
+        EXPECT_FALSE(recorder.IsRecording());
+
+        ASSERT_EQ(1, trace.GetRecords().size());
+        const StreamerTraceRecord& record = trace.GetRecords()[0];
+        EXPECT_STREQ("Streamer/file.bin", trace.GetPath(record.m_pathIndex).c_str());
+        EXPECT_EQ(128, record.m_offset);
+        EXPECT_EQ(32, record.m_size);
+        EXPECT_EQ(StreamerTraceRecord::s_noDeadline, record.m_deadlineUs);
+        EXPECT_EQ(IStreamerTypes::s_priorityHigh, record.m_priority);
+        EXPECT_EQ(static_cast<u8>(IStreamerTypes::RequestStatus::Completed), record.m_status);
+        EXPECT_NE(0, record.m_flags & StreamerTraceRecord::s_flagCompleted);
+        EXPECT_GE(record.m_completionTimeUs, record.m_issueTimeUs);
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, RecordIssue_RequestWithDeadline_DeadlineIsRelativeToIssueTime)
+    {
+        StreamerTraceRecorder recorder;
+        recorder.Start();
+
+        auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(10);
+        recorder.RecordIssue(CreateReadRequest("Streamer/file.bin", 0, 32, deadline));
+
+        StreamerTrace trace;
+        ASSERT_TRUE(recorder.Stop(trace));
+        ASSERT_EQ(1, trace.GetRecords().size());
+        EXPECT_GT(trace.GetRecords()[0].m_deadlineUs, 0);
+        EXPECT_LE(trace.GetRecords()[0].m_deadlineUs, AZStd::chrono::microseconds(AZStd::chrono::seconds(10)).count());
+    }
+
+    TEST_F(Streamer_StreamerTraceTest, RecordCompletion_RequestFromPreviousSession_CompletionIsIgnored)
+    {
+        StreamerTraceRecorder recorder;
+        recorder.Start();
+        StreamerTraceRecorder::Ticket oldTicket = recorder.RecordIssue(CreateReadRequest("Streamer/old.bin", 0, 32));
+
+        recorder.Start();
+        recorder.RecordIssue(CreateReadRequest("Streamer/new.bin", 0, 32));
+        recorder.RecordCompletion(oldTicket, IStreamerTypes::RequestStatus::Completed);
+
+        StreamerTrace trace;
+        ASSERT_TRUE(recorder.Stop(trace));
+        ASSERT_EQ(1, trace.GetRecords().size());
+        EXPECT_EQ(0, trace.GetRecords()[0].m_flags & StreamerTraceRecord::s_flagCompleted);
+    }
+} // namespace AZ::IO
@@ -5,7 +5,16 @@
  *
  */
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Component/TickDispatcher.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -65,3 +74,201 @@ TEST_F(OrderedTickBus, OnTick_HandlersFireInSortedOrder)
     // check the order they actually fired in
     EXPECT_EQ(actualTickOrder, sortedOrder);
 }
+
+// TickBus handler that opts in to parallel ticking with the provided access.
+struct ParallelTicker : public TickBus::Handler
+{
+    int m_order = TICK_DEFAULT;
+    TickAccess m_access;
+    bool m_isParallel = true;
+    AZStd::function<void()> m_onTick;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // TickBus
+    int GetTickOrder() override { return m_order; }
+
+    bool GetTickAccess(TickAccess& access) override
+    {
+        access = m_access;
+        return m_isParallel;
+    }
+
+    void OnTick(float /*deltaTime*/, ScriptTimePoint /*time*/) override
+    {
+        if (m_onTick)
+        {
+            m_onTick();
+        }
+    }
+    ///////////////////////////////////////////////////////////////////////////
+};
+
+class ParallelTickBus : public UnitTest::AllocatorsFixture
+{
+public:
+    void SetUp() override
+    {
+        UnitTest::AllocatorsFixture::SetUp();
+
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+
+        JobManagerDesc desc;
+        JobManagerThreadDesc threadDesc;
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            desc.m_workerThreads.push_back(threadDesc);
+        }
+        m_jobManager = aznew JobManager(desc);
+        m_jobContext = aznew JobContext(*m_jobManager);
+        m_dispatcher.SetJobContext(m_jobContext);
+        m_dispatcher.SetParallelTickEnabled(true);
+    }
+
+    void TearDown() override
+    {
+        m_tickers.clear();
+
+        delete m_jobContext;
+        delete m_jobManager;
+
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+
+        UnitTest::AllocatorsFixture::TearDown();
+    }
+
+    ParallelTicker& AddTicker(int order, bool isParallel, AZStd::function<void()> onTick)
+    {
+        m_tickers.emplace_back();
+        ParallelTicker& ticker = m_tickers.back();
+        ticker.m_order = order;
+        ticker.m_isParallel = isParallel;
+        ticker.m_onTick = AZStd::move(onTick);
+        ticker.TickBus::Handler::BusConnect();
+        return ticker;
+    }
+
+protected:
+    JobManager* m_jobManager = nullptr;
+    JobContext* m_jobContext = nullptr;
+    TickDispatcher m_dispatcher;
+    AZStd::list<ParallelTicker> m_tickers;
+};
+
+TEST_F(ParallelTickBus, ConflictsWith_OverlappingWrites_Conflict)
+{
+    TickAccess reader;
+    reader.m_reads.push_back(AZ_CRC_CE("Transforms"));
+    TickAccess otherReader = reader;
+    TickAccess writer;
+    writer.m_writes.push_back(AZ_CRC_CE("Transforms"));
+    TickAccess unrelatedWriter;
+    unrelatedWriter.m_writes.push_back(AZ_CRC_CE("Physics"));
+
+    EXPECT_FALSE(reader.ConflictsWith(otherReader));
+    EXPECT_TRUE(reader.ConflictsWith(writer));
+    EXPECT_TRUE(writer.ConflictsWith(reader));
+    EXPECT_TRUE(writer.ConflictsWith(writer));
+    EXPECT_FALSE(writer.ConflictsWith(unrelatedWriter));
+}
+
+TEST_F(ParallelTickBus, Tick_IndependentHandlers_AllTickedOnceBeforeLaterHandlers)
+{
+    constexpr int numParallelHandlers = 64;
+    AZStd::atomic_int numTicked{ 0 };
+    for (int i = 0; i < numParallelHandlers; ++i)
+    {
+        AddTicker(TICK_GAME, true, [&numTicked]() { ++numTicked; });
+    }
+
+    int numTickedBeforeLater = -1;
+    AddTicker(TICK_DEFAULT, false, [&numTicked, &numTickedBeforeLater]() { numTickedBeforeLater = numTicked; });
+
+    m_dispatcher.Tick(0.f, ScriptTimePoint{});
+
+    EXPECT_EQ(numParallelHandlers, numTicked);
+    EXPECT_EQ(numParallelHandlers, numTickedBeforeLater);
+}
+
+TEST_F(ParallelTickBus, Tick_ConflictingHandlersInSamePhase_TickedInConnectionOrder)
+{
+    constexpr int numIterations = 32;
+    for (int iteration = 0; iteration < numIterations; ++iteration)
+    {
+        m_tickers.clear();
+
+        AZStd::atomic_int value{ 0 };
+        int observedByReader = -1;
+        ParallelTicker& writer = AddTicker(TICK_GAME, true, [&value]()
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::microseconds(100));
+                value = 1;
+            });
+        writer.m_access.m_writes.push_back(AZ_CRC_CE("Value"));
+
+        ParallelTicker& reader = AddTicker(TICK_GAME, true, [&value, &observedByReader]() { observedByReader = value; });
+        reader.m_access.m_reads.push_back(AZ_CRC_CE("Value"));
+
+        for (int i = 0; i < 8; ++i)
+        {
+            AddTicker(TICK_GAME, true, []() {});
+        }
+
+        m_dispatcher.Tick(0.f, ScriptTimePoint{});
+        EXPECT_EQ(1, observedByReader);
+    }
+}
+
+TEST_F(ParallelTickBus, Tick_HandlerWithoutAccessInBetween_SplitsPhase)
+{
+    AZStd::vector<int> tickOrder;
+    AZStd::mutex tickOrderLock;
+    auto record = [&tickOrder, &tickOrderLock](int value)
+    {
+        return [&tickOrder, &tickOrderLock, value]()
+        {
+            AZStd::scoped_lock lock(tickOrderLock);
+            tickOrder.push_back(value);
+        };
+    };
+
+    AddTicker(TICK_PLACEMENT, true, record(TICK_PLACEMENT));
+    AddTicker(TICK_PLACEMENT, true, record(TICK_PLACEMENT));
+    AddTicker(TICK_GAME, false, record(TICK_GAME));
+    AddTicker(TICK_ANIMATION, true, record(TICK_ANIMATION));
+    AddTicker(TICK_ANIMATION, true, record(TICK_ANIMATION));
+    AddTicker(TICK_UI, false, record(TICK_UI));
+
+    m_dispatcher.Tick(0.f, ScriptTimePoint{});
+
+    AZStd::vector<int> expected = { TICK_PLACEMENT, TICK_PLACEMENT, TICK_GAME, TICK_ANIMATION, TICK_ANIMATION, TICK_UI };
+    EXPECT_EQ(expected, tickOrder);
+}
+
+TEST_F(ParallelTickBus, Constructor_ParallelTickDisabledByDefault)
+{
+    TickDispatcher dispatcher;
+    EXPECT_FALSE(dispatcher.IsParallelTickEnabled());
+}
+
+TEST_F(ParallelTickBus, Tick_ParallelTickDisabled_HandlersTickedOnCallingThread)
+{
+    m_dispatcher.SetParallelTickEnabled(false);
+
+    AZStd::thread::id callingThread = AZStd::this_thread::get_id();
+    int numOnOtherThreads = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        AddTicker(TICK_GAME, true, [callingThread, &numOnOtherThreads]()
+            {
+                if (AZStd::this_thread::get_id() != callingThread)
+                {
+                    ++numOnOtherThreads;
+                }
+            });
+    }
+
+    m_dispatcher.Tick(0.f, ScriptTimePoint{});
+    EXPECT_EQ(0, numOnOtherThreads);
+}
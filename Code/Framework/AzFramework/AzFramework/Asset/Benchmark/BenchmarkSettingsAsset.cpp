@@ -38,6 +38,7 @@ namespace AzFramework
                     ->DataElement(AZ::Edit::UIHandlers::Default, &BenchmarkSettingsAsset::m_numAssetsPerDependency, "Assets Per Dependency", "Number of assets to generate for each dependency in the tree")
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &BenchmarkSettingsAsset::m_assetStorageType, "Asset Storage", "Serializaton format to use for each asset (binary, text)")
                         ->EnumAttribute(AZ::DataStream::StreamType::ST_BINARY, "Binary")
+                        ->EnumAttribute(AZ::DataStream::StreamType::ST_BINARY_COMPACT, "Compact Binary")
                         ->EnumAttribute(AZ::DataStream::StreamType::ST_XML, "XML")
                         ->EnumAttribute(AZ::DataStream::StreamType::ST_JSON, "JSON")
                     ;
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/limits.h>
+
+namespace AzFramework
+{
+    using TransformHierarchyNodeId = AZ::u32;
+    static constexpr TransformHierarchyNodeId InvalidTransformHierarchyNodeId = AZStd::numeric_limits<TransformHierarchyNodeId>::max();
+
+    //! Receives the world transforms that the transform hierarchy computed for a node.
+    class TransformHierarchyListener
+    {
+    public:
+        //! Called from ITransformHierarchy::UpdateHierarchy when the world transform of the node changed because one of
+        //! its ancestors moved. Listeners are called in hierarchy order, so parents are notified before their children.
+        virtual void OnHierarchyWorldTMChanged(const AZ::Transform& worldTM) = 0;
+
+    protected:
+        ~TransformHierarchyListener() = default;
+    };
+
+    //! Stores the local and world transforms of entity hierarchies in flat arrays sorted so parents come before
+    //! their children. Moving a node only marks its descendants out of date. Their world transforms are recomputed
+    //! in one pass per frame, after which the listeners of the nodes that moved are notified. Reading the world
+    //! transform of an out of date node computes it on demand.
+    //! @note The hierarchy is not thread safe and is expected to be used from the main thread, like the TransformBus.
+    class ITransformHierarchy
+    {
+    public:
+        AZ_RTTI(ITransformHierarchy, "{6C1F4E8B-7A0D-4C55-9F1B-2E6D3A9C58B4}");
+
+        //! Adds a node without a parent.
+        virtual TransformHierarchyNodeId AddNode(
+            TransformHierarchyListener* listener, const AZ::Transform& localTM, const AZ::Transform& worldTM) = 0;
+        //! Removes a node. Children of the node become roots until they're given a new parent.
+        virtual void RemoveNode(TransformHierarchyNodeId node) = 0;
+
+        //! Sets the parent of a node. The world transform of a node with a parent is computed by the hierarchy, while
+        //! the world transform of a root is only updated through SetTransforms.
+        virtual void SetParent(TransformHierarchyNodeId node, TransformHierarchyNodeId parent) = 0;
+        virtual TransformHierarchyNodeId GetParent(TransformHierarchyNodeId node) const = 0;
+
+        //! Stores the transforms of a node that were computed by its owner and marks the descendants out of date.
+        //! The owner is responsible for signaling its own change, its listener won't be called for this change.
+        virtual void SetTransforms(TransformHierarchyNodeId node, const AZ::Transform& localTM, const AZ::Transform& worldTM) = 0;
+
+        //! Returns true if an ancestor of the node moved since its world transform was last computed.
+        virtual bool IsWorldTMOutOfDate(TransformHierarchyNodeId node) const = 0;
+        //! Returns the world transform of the node, computing it and those of its out of date ancestors if needed.
+        virtual const AZ::Transform& GetWorldTM(TransformHierarchyNodeId node) = 0;
+
+        //! Recomputes all out of date world transforms and notifies the listeners of the nodes that changed.
+        //! @note During normal operation this is called every frame in OnTick, but can also be called explicitly.
+        virtual void UpdateHierarchy() = 0;
+
+    protected:
+        ~ITransformHierarchy() = default;
+    };
+} // namespace AzFramework
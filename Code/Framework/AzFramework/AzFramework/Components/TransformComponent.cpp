@@ -151,6 +151,12 @@ namespace AzFramework
         AZ::TransformBus::Handler::BusConnect(m_entity->GetId());
         AZ::TransformNotificationBus::Bind(m_notificationBus, m_entity->GetId());
 
+        m_hierarchy = AZ::Interface<ITransformHierarchy>::Get();
+        if (m_hierarchy)
+        {
+            m_hierarchyNode = m_hierarchy->AddNode(this, m_localTM, m_worldTM);
+        }
+
         const bool keepWorldTm = (m_parentActivationTransformMode == ParentActivationTransformMode::MaintainCurrentWorldTransform || !m_parentId.IsValid());
         SetParentImpl(m_parentId, keepWorldTm);
     }
@@ -172,6 +178,16 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
         }
         AZ::TransformBus::Handler::BusDisconnect();
+
+        if (m_hierarchy)
+        {
+            // Keep the last world transform that was computed for this entity.
+            GetWorldTM();
+            m_hierarchy->RemoveNode(m_hierarchyNode);
+            m_hierarchy = nullptr;
+            m_hierarchyNode = InvalidTransformHierarchyNodeId;
+            m_isHierarchyChild = false;
+        }
     }
 
     void TransformComponent::BindTransformChangedEventHandler(AZ::TransformChangedEvent::Handler& handler)
@@ -194,6 +210,22 @@ namespace AzFramework
         m_childChangedEvent.Signal(changeType, entityId);
     }
 
+    const AZ::Transform& TransformComponent::GetWorldTM()
+    {
+        if (m_isHierarchyChild)
+        {
+            // The world transform is only updated once per frame by the hierarchy, so make sure it's up to date.
+            m_worldTM = m_hierarchy->GetWorldTM(m_hierarchyNode);
+        }
+        return m_worldTM;
+    }
+
+    void TransformComponent::GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM)
+    {
+        localTM = m_localTM;
+        worldTM = GetWorldTM();
+    }
+
     void TransformComponent::SetLocalTM(const AZ::Transform& tm)
     {
         if (AreMoveRequestsAllowed())
@@ -222,7 +254,7 @@ namespace AzFramework
 
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
@@ -236,7 +268,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
@@ -246,25 +278,25 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -324,19 +356,19 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
@@ -421,7 +453,7 @@ namespace AzFramework
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -500,6 +532,7 @@ namespace AzFramework
         if (parentEntity)
         {
             m_parentTM = parentEntity->GetTransform();
+            UpdateHierarchyParent();
 
             AZ_Warning("TransformComponent", !m_isStatic || m_parentTM->IsStaticTransform(),
                 "Entity '%s' %s has static transform, but parent has non-static transform. This may lead to unexpected movement.",
@@ -519,8 +552,10 @@ namespace AzFramework
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        GetWorldTM();
         m_parentTM = nullptr;
         m_parentActive = false;
+        UpdateHierarchyParent();
         ComputeLocalTM();
     }
 
@@ -540,6 +575,13 @@ namespace AzFramework
             AZ::EntityBus::Handler::BusDisconnect();
             m_parentActive = false;
         }
+        if (m_isHierarchyChild)
+        {
+            // Detach from the old parent's node, the new parent is linked once it's active.
+            GetWorldTM();
+            m_hierarchy->SetParent(m_hierarchyNode, InvalidTransformHierarchyNodeId);
+            m_isHierarchyChild = false;
+        }
 
         m_parentId = parentId;
         if (m_parentId.IsValid())
@@ -611,9 +653,11 @@ namespace AzFramework
     {
         // Called when our parent transform changes
         // Ignore the event until we've already derived our local transform.
-        if (m_parentTM)
+        // When the parent is part of the same transform hierarchy, the hierarchy updates the world transform instead.
+        if (m_parentTM && !m_isHierarchyChild)
         {
             m_worldTM = parentWorldTM * m_localTM;
+            SyncHierarchyTransforms();
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
         }
@@ -630,6 +674,7 @@ namespace AzFramework
             m_localTM = m_worldTM;
         }
 
+        SyncHierarchyTransforms();
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
 
@@ -651,6 +696,39 @@ namespace AzFramework
             m_worldTM = m_localTM;
         }
 
+        SyncHierarchyTransforms();
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::UpdateHierarchyParent()
+    {
+        if (!m_hierarchy)
+        {
+            return;
+        }
+
+        TransformHierarchyNodeId parentNode = InvalidTransformHierarchyNodeId;
+        if (auto parentTransform = azrtti_cast<TransformComponent*>(m_parentTM); parentTransform && parentTransform->m_hierarchy == m_hierarchy)
+        {
+            parentNode = parentTransform->m_hierarchyNode;
+        }
+
+        m_hierarchy->SetParent(m_hierarchyNode, parentNode);
+        m_isHierarchyChild = (parentNode != InvalidTransformHierarchyNodeId);
+    }
+
+    void TransformComponent::SyncHierarchyTransforms()
+    {
+        if (m_hierarchy)
+        {
+            m_hierarchy->SetTransforms(m_hierarchyNode, m_localTM, m_worldTM);
+        }
+    }
+
+    void TransformComponent::OnHierarchyWorldTMChanged(const AZ::Transform& worldTM)
+    {
+        m_worldTM = worldTM;
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
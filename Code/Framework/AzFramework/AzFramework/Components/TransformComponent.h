@@ -12,6 +12,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Components/ITransformHierarchy.h>
 
 namespace AzToolsFramework
 {
@@ -35,6 +36,7 @@ namespace AzFramework
         , public AZ::TransformBus::Handler
         , public AZ::TransformNotificationBus::Handler
         , private AZ::TransformHierarchyInformationBus::Handler
+        , private TransformHierarchyListener
     {
     public:
         AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
@@ -55,9 +57,9 @@ namespace AzFramework
         //! Returns true if the tm was set to the local transform.
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override;
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override;
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -164,6 +166,16 @@ namespace AzFramework
         // TransformHierarchyInformationBus
         void GatherChildren(AZStd::vector<AZ::EntityId>& children) override;
 
+        //! Methods for the optional batched transform hierarchy, see ITransformHierarchy.
+        //! @{
+        //! Links the hierarchy node to the node of the parent if the parent is active and part of the same hierarchy.
+        void UpdateHierarchyParent();
+        //! Stores the current transforms in the hierarchy, which marks the descendants out of date.
+        void SyncHierarchyTransforms();
+        // TransformHierarchyListener
+        void OnHierarchyWorldTMChanged(const AZ::Transform& worldTM) override;
+        //! @}
+
         /// \ref ComponentDescriptor::GetProvidedServices
         static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
 
@@ -184,5 +196,9 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+
+        ITransformHierarchy* m_hierarchy = nullptr; ///< Cached - the batched transform hierarchy, if one is active.
+        TransformHierarchyNodeId m_hierarchyNode = InvalidTransformHierarchyNodeId; ///< Node of this transform in m_hierarchy.
+        bool m_isHierarchyChild = false; ///< If true, m_hierarchy computes the world transform from the parent's.
     };
 }   // namespace AZ
@@ -0,0 +1,436 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Components/TransformHierarchySystem.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+
+namespace AzFramework
+{
+    TransformHierarchySystem::~TransformHierarchySystem()
+    {
+        AZ_Assert(AZ::Interface<ITransformHierarchy>::Get() != this, "TransformHierarchySystem destroyed while still connected.");
+    }
+
+    void TransformHierarchySystem::Connect()
+    {
+        AZ::Interface<ITransformHierarchy>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchySystem::Disconnect()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<ITransformHierarchy>::Unregister(this);
+    }
+
+    TransformHierarchyNodeId TransformHierarchySystem::AddNode(
+        TransformHierarchyListener* listener, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        TransformHierarchyNodeId node;
+        if (!m_freeNodes.empty())
+        {
+            node = m_freeNodes.back();
+            m_freeNodes.pop_back();
+        }
+        else
+        {
+            node = aznumeric_caster(m_nodeSlots.size());
+            m_nodeSlots.push_back(InvalidSlot);
+        }
+
+        AZ::u32 slot = aznumeric_caster(m_slotNodes.size());
+        m_localTMs.push_back(localTM);
+        m_worldTMs.push_back(worldTM);
+        m_parentSlots.push_back(InvalidSlot);
+        m_worldVersions.push_back(0);
+        m_parentVersions.push_back(0);
+        m_notify.push_back(0);
+        m_listeners.push_back(listener);
+        m_slotNodes.push_back(node);
+        m_nodeSlots[node] = slot;
+
+        m_isOrderDirty = true;
+        return node;
+    }
+
+    void TransformHierarchySystem::RemoveNode(TransformHierarchyNodeId node)
+    {
+        AZ::u32 slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        // The slot is reclaimed the next time the order is rebuilt. Until then it still holds the last known world
+        // transform, but it's no longer considered as a parent.
+        m_listeners[slot] = nullptr;
+        m_notify[slot] = 0;
+        m_slotNodes[slot] = InvalidTransformHierarchyNodeId;
+        m_nodeSlots[node] = InvalidSlot;
+        m_freeNodes.push_back(node);
+        m_isOrderDirty = true;
+    }
+
+    void TransformHierarchySystem::SetParent(TransformHierarchyNodeId node, TransformHierarchyNodeId parent)
+    {
+        AZ::u32 slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+        AZ_Assert(node != parent, "A transform hierarchy node can't be its own parent.");
+
+        AZ::u32 parentSlot = GetSlot(parent);
+        if (m_parentSlots[slot] == parentSlot)
+        {
+            return;
+        }
+
+        m_parentSlots[slot] = parentSlot;
+        if (parentSlot != InvalidSlot)
+        {
+            // Make sure the world transform is derived from the new parent, even if the owner doesn't provide it.
+            m_parentVersions[slot] = m_worldVersions[parentSlot] - 1;
+            m_hasChanges = true;
+        }
+        m_isOrderDirty = true;
+    }
+
+    TransformHierarchyNodeId TransformHierarchySystem::GetParent(TransformHierarchyNodeId node) const
+    {
+        AZ::u32 slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return InvalidTransformHierarchyNodeId;
+        }
+        AZ::u32 parentSlot = GetParentSlot(slot);
+        return parentSlot != InvalidSlot ? m_slotNodes[parentSlot] : InvalidTransformHierarchyNodeId;
+    }
+
+    void TransformHierarchySystem::SetTransforms(TransformHierarchyNodeId node, const AZ::Transform& localTM, const AZ::Transform& worldTM)
+    {
+        AZ::u32 slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return;
+        }
+
+        m_localTMs[slot] = localTM;
+        m_worldTMs[slot] = worldTM;
+        m_worldVersions[slot]++;
+        m_notify[slot] = 0;
+
+        AZ::u32 parentSlot = GetParentSlot(slot);
+        if (parentSlot != InvalidSlot)
+        {
+            m_parentVersions[slot] = m_worldVersions[parentSlot];
+        }
+        m_hasChanges = true;
+    }
+
+    bool TransformHierarchySystem::IsWorldTMOutOfDate(TransformHierarchyNodeId node) const
+    {
+        AZ::u32 slot = GetSlot(node);
+        if (slot == InvalidSlot)
+        {
+            return false;
+        }
+
+        for (AZ::u32 parentSlot = GetParentSlot(slot); parentSlot != InvalidSlot; slot = parentSlot, parentSlot = GetParentSlot(slot))
+        {
+            if (m_parentVersions[slot] != m_worldVersions[parentSlot])
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    const AZ::Transform& TransformHierarchySystem::GetWorldTM(TransformHierarchyNodeId node)
+    {
+        AZ::u32 slot = GetSlot(node);
+        AZ_Assert(slot != InvalidSlot, "Transform hierarchy node %u doesn't exist.", node);
+
+        // Collect the ancestors and update them from the root down, so every node is computed from an up to date parent.
+        m_ancestors.clear();
+        for (AZ::u32 ancestor = slot; ancestor != InvalidSlot; ancestor = GetParentSlot(ancestor))
+        {
+            m_ancestors.push_back(ancestor);
+        }
+        for (auto it = m_ancestors.rbegin(); it != m_ancestors.rend(); ++it)
+        {
+            // The listeners of the updated nodes are notified in the next UpdateHierarchy.
+            m_hasChanges |= UpdateSlot(*it);
+        }
+        return m_worldTMs[slot];
+    }
+
+    void TransformHierarchySystem::UpdateHierarchy()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        if (m_isOrderDirty)
+        {
+            RebuildOrder();
+        }
+        if (!m_hasChanges)
+        {
+            return;
+        }
+        m_hasChanges = false;
+
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        size_t numWorkers = jobContext ? jobContext->GetJobManager().GetNumWorkerThreads() : 0;
+        size_t numSlots = m_slotNodes.size();
+        size_t numRoots = m_rootRanges.empty() ? 0 : m_rootRanges.size() - 1;
+        if (numSlots < ParallelUpdateThreshold || numWorkers == 0 || numRoots < 2)
+        {
+            UpdateRange(0, aznumeric_caster(numSlots));
+        }
+        else
+        {
+            // Split the arrays at root boundaries into roughly equally sized batches. Each root and its descendants
+            // are contiguous and independent from other roots, so the batches can be updated concurrently.
+            size_t numBatches = AZStd::min(numRoots, numWorkers + 1);
+            size_t targetBatchSize = (numSlots + numBatches - 1) / numBatches;
+
+            AZ::JobCompletion completion(jobContext);
+            AZ::u32 firstBatchEnd = 0;
+            size_t rootIndex = 0;
+            while (rootIndex < numRoots)
+            {
+                AZ::u32 batchBegin = m_rootRanges[rootIndex];
+                while (rootIndex < numRoots && m_rootRanges[rootIndex + 1] - batchBegin < targetBatchSize)
+                {
+                    ++rootIndex;
+                }
+                rootIndex = AZStd::min(rootIndex + 1, numRoots);
+                AZ::u32 batchEnd = m_rootRanges[rootIndex];
+
+                if (batchBegin == 0)
+                {
+                    // The calling thread updates the first batch itself.
+                    firstBatchEnd = batchEnd;
+                    continue;
+                }
+
+                auto updateBatch = [this, batchBegin, batchEnd]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzFramework, "TransformHierarchySystem::UpdateBatch");
+                    UpdateRange(batchBegin, batchEnd);
+                };
+                AZ::Job* job = AZ::CreateJobFunction(updateBatch, true, jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            UpdateRange(0, firstBatchEnd);
+            completion.StartAndWaitForCompletion();
+        }
+
+        NotifyListeners();
+    }
+
+    size_t TransformHierarchySystem::GetNumNodes() const
+    {
+        return m_nodeSlots.size() - m_freeNodes.size();
+    }
+
+    int TransformHierarchySystem::GetTickOrder()
+    {
+        // Run after gameplay, animation and physics moved entities, but before the data is gathered for rendering.
+        return AZ::TICK_PRE_RENDER;
+    }
+
+    void TransformHierarchySystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        UpdateHierarchy();
+    }
+
+    AZ::u32 TransformHierarchySystem::GetSlot(TransformHierarchyNodeId node) const
+    {
+        return node < m_nodeSlots.size() ? m_nodeSlots[node] : InvalidSlot;
+    }
+
+    AZ::u32 TransformHierarchySystem::GetParentSlot(AZ::u32 slot) const
+    {
+        AZ::u32 parentSlot = m_parentSlots[slot];
+        return (parentSlot != InvalidSlot && m_slotNodes[parentSlot] != InvalidTransformHierarchyNodeId) ? parentSlot : InvalidSlot;
+    }
+
+    void TransformHierarchySystem::RebuildOrder()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        const AZ::u32 numSlots = aznumeric_caster(m_slotNodes.size());
+
+        // Gather the children of every slot in a single array, with the children of slot i stored in
+        // [childOffsets[i], childOffsets[i + 1]).
+        AZStd::vector<AZ::u32> childOffsets(numSlots + 1, 0);
+        for (AZ::u32 slot = 0; slot < numSlots; ++slot)
+        {
+            AZ::u32 parentSlot = GetParentSlot(slot);
+            if (m_slotNodes[slot] != InvalidTransformHierarchyNodeId && parentSlot != InvalidSlot)
+            {
+                childOffsets[parentSlot + 1]++;
+            }
+        }
+        for (AZ::u32 slot = 0; slot < numSlots; ++slot)
+        {
+            childOffsets[slot + 1] += childOffsets[slot];
+        }
+        AZStd::vector<AZ::u32> children(childOffsets[numSlots]);
+        AZStd::vector<AZ::u32> childCursors(childOffsets.begin(), childOffsets.end() - 1);
+        for (AZ::u32 slot = 0; slot < numSlots; ++slot)
+        {
+            AZ::u32 parentSlot = GetParentSlot(slot);
+            if (m_slotNodes[slot] != InvalidTransformHierarchyNodeId && parentSlot != InvalidSlot)
+            {
+                children[childCursors[parentSlot]++] = slot;
+            }
+        }
+
+        // Depth first walk from every root to get the new order.
+        AZStd::vector<AZ::u32> order;
+        order.reserve(numSlots);
+        AZStd::vector<AZ::u8> visited(numSlots, 0);
+        AZStd::vector<AZ::u32> stack;
+        m_rootRanges.clear();
+        auto visitRoot = [&](AZ::u32 root)
+        {
+            m_rootRanges.push_back(aznumeric_caster(order.size()));
+            visited[root] = 1;
+            stack.push_back(root);
+            while (!stack.empty())
+            {
+                AZ::u32 slot = stack.back();
+                stack.pop_back();
+                order.push_back(slot);
+                // Push in reverse so the children keep their relative order.
+                for (AZ::u32 child = childOffsets[slot + 1]; child > childOffsets[slot]; --child)
+                {
+                    AZ::u32 childSlot = children[child - 1];
+                    if (!visited[childSlot])
+                    {
+                        visited[childSlot] = 1;
+                        stack.push_back(childSlot);
+                    }
+                }
+            }
+        };
+        for (AZ::u32 slot = 0; slot < numSlots; ++slot)
+        {
+            if (m_slotNodes[slot] != InvalidTransformHierarchyNodeId && GetParentSlot(slot) == InvalidSlot)
+            {
+                visitRoot(slot);
+            }
+        }
+        for (AZ::u32 slot = 0; slot < numSlots; ++slot)
+        {
+            if (m_slotNodes[slot] != InvalidTransformHierarchyNodeId && !visited[slot])
+            {
+                // Only nodes that are part of a parenting cycle can't be reached from a root.
+                AZ_Warning("TransformHierarchySystem", false,
+                    "Transform hierarchy node %u is part of a parenting cycle and is detached from its parent.", m_slotNodes[slot]);
+                m_parentSlots[slot] = InvalidSlot;
+                visitRoot(slot);
+            }
+        }
+        m_rootRanges.push_back(aznumeric_caster(order.size()));
+
+        // Move all data into the new order.
+        AZStd::vector<AZ::u32> newSlots(numSlots, InvalidSlot);
+        for (AZ::u32 newSlot = 0; newSlot < order.size(); ++newSlot)
+        {
+            newSlots[order[newSlot]] = newSlot;
+        }
+
+        const size_t numNodes = order.size();
+        AZStd::vector<AZ::Transform> localTMs(numNodes);
+        AZStd::vector<AZ::Transform> worldTMs(numNodes);
+        AZStd::vector<AZ::u32> parentSlots(numNodes);
+        AZStd::vector<AZ::u32> worldVersions(numNodes);
+        AZStd::vector<AZ::u32> parentVersions(numNodes);
+        AZStd::vector<AZ::u8> notify(numNodes);
+        AZStd::vector<TransformHierarchyListener*> listeners(numNodes);
+        AZStd::vector<TransformHierarchyNodeId> slotNodes(numNodes);
+        for (size_t newSlot = 0; newSlot < numNodes; ++newSlot)
+        {
+            AZ::u32 oldSlot = order[newSlot];
+            AZ::u32 oldParentSlot = GetParentSlot(oldSlot);
+
+            localTMs[newSlot] = m_localTMs[oldSlot];
+            worldTMs[newSlot] = m_worldTMs[oldSlot];
+            parentSlots[newSlot] = oldParentSlot != InvalidSlot ? newSlots[oldParentSlot] : InvalidSlot;
+            worldVersions[newSlot] = m_worldVersions[oldSlot];
+            parentVersions[newSlot] = m_parentVersions[oldSlot];
+            notify[newSlot] = m_notify[oldSlot];
+            listeners[newSlot] = m_listeners[oldSlot];
+            slotNodes[newSlot] = m_slotNodes[oldSlot];
+            m_nodeSlots[m_slotNodes[oldSlot]] = aznumeric_caster(newSlot);
+        }
+
+        m_localTMs = AZStd::move(localTMs);
+        m_worldTMs = AZStd::move(worldTMs);
+        m_parentSlots = AZStd::move(parentSlots);
+        m_worldVersions = AZStd::move(worldVersions);
+        m_parentVersions = AZStd::move(parentVersions);
+        m_notify = AZStd::move(notify);
+        m_listeners = AZStd::move(listeners);
+        m_slotNodes = AZStd::move(slotNodes);
+
+        m_isOrderDirty = false;
+    }
+
+    void TransformHierarchySystem::UpdateRange(AZ::u32 begin, AZ::u32 end)
+    {
+        for (AZ::u32 slot = begin; slot < end; ++slot)
+        {
+            UpdateSlot(slot);
+        }
+    }
+
+    bool TransformHierarchySystem::UpdateSlot(AZ::u32 slot)
+    {
+        AZ::u32 parentSlot = GetParentSlot(slot);
+        if (parentSlot != InvalidSlot && m_parentVersions[slot] != m_worldVersions[parentSlot])
+        {
+            m_worldTMs[slot] = m_worldTMs[parentSlot] * m_localTMs[slot];
+            m_parentVersions[slot] = m_worldVersions[parentSlot];
+            m_worldVersions[slot]++;
+            m_notify[slot] = 1;
+            return true;
+        }
+        return false;
+    }
+
+    void TransformHierarchySystem::NotifyListeners()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        // Listeners can add nodes, which appends slots and can reallocate the arrays, so only the slots that existed
+        // at the start are visited and the transform is copied before the listener is called.
+        const size_t numSlots = m_slotNodes.size();
+        for (size_t slot = 0; slot < numSlots; ++slot)
+        {
+            if (m_notify[slot])
+            {
+                m_notify[slot] = 0;
+                if (TransformHierarchyListener* listener = m_listeners[slot])
+                {
+                    AZ::Transform worldTM = m_worldTMs[slot];
+                    listener->OnHierarchyWorldTMChanged(worldTM);
+                }
+            }
+        }
+    }
+} // namespace AzFramework
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzFramework/Components/ITransformHierarchy.h>
+
+namespace AzFramework
+{
+    //! Batched implementation of the transform hierarchy.
+    //! Every node lives in a slot of a set of parallel arrays. When nodes are added or reparented the slots are
+    //! re-sorted into depth first order at the start of the next update, so parents are always processed before their
+    //! children and every root with its descendants forms a contiguous range. A node is out of date when the world
+    //! version of its parent differs from the one its world transform was computed with. This makes moving a node
+    //! O(1) and lets the update run as a single linear pass over the arrays, split per root over the job system
+    //! for large hierarchies.
+    class TransformHierarchySystem
+        : public ITransformHierarchy
+        , private AZ::TickBus::Handler
+    {
+    public:
+        //! Hierarchies with fewer nodes than this are updated on the calling thread.
+        static constexpr size_t ParallelUpdateThreshold = 4096;
+
+        TransformHierarchySystem() = default;
+        ~TransformHierarchySystem();
+
+        void Connect();
+        void Disconnect();
+
+        // ITransformHierarchy overrides ...
+        TransformHierarchyNodeId AddNode(
+            TransformHierarchyListener* listener, const AZ::Transform& localTM, const AZ::Transform& worldTM) override;
+        void RemoveNode(TransformHierarchyNodeId node) override;
+        void SetParent(TransformHierarchyNodeId node, TransformHierarchyNodeId parent) override;
+        TransformHierarchyNodeId GetParent(TransformHierarchyNodeId node) const override;
+        void SetTransforms(TransformHierarchyNodeId node, const AZ::Transform& localTM, const AZ::Transform& worldTM) override;
+        bool IsWorldTMOutOfDate(TransformHierarchyNodeId node) const override;
+        const AZ::Transform& GetWorldTM(TransformHierarchyNodeId node) override;
+        void UpdateHierarchy() override;
+
+        size_t GetNumNodes() const;
+
+    private:
+        static constexpr AZ::u32 InvalidSlot = AZStd::numeric_limits<AZ::u32>::max();
+
+        // TickBus overrides ...
+        int GetTickOrder() override;
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        AZ::u32 GetSlot(TransformHierarchyNodeId node) const;
+        //! Returns the slot of the parent, or InvalidSlot if the slot is a root or its parent was removed.
+        AZ::u32 GetParentSlot(AZ::u32 slot) const;
+        //! Sorts the slots in depth first order and removes the slots of removed nodes.
+        void RebuildOrder();
+        //! Recomputes the out of date world transforms in the slot range [begin, end), which must cover complete roots.
+        void UpdateRange(AZ::u32 begin, AZ::u32 end);
+        //! Recomputes the world transform of the slot if it's out of date with its parent. Returns true if it was updated.
+        bool UpdateSlot(AZ::u32 slot);
+        void NotifyListeners();
+
+        // Per slot data, sorted parents first after RebuildOrder.
+        AZStd::vector<AZ::Transform> m_localTMs;
+        AZStd::vector<AZ::Transform> m_worldTMs;
+        AZStd::vector<AZ::u32> m_parentSlots;
+        AZStd::vector<AZ::u32> m_worldVersions; //!< Incremented every time the world transform of the slot changes.
+        AZStd::vector<AZ::u32> m_parentVersions; //!< World version of the parent the world transform was computed with.
+        AZStd::vector<AZ::u8> m_notify; //!< Set if the listener of the slot still has to be told about a new world transform.
+        AZStd::vector<TransformHierarchyListener*> m_listeners;
+        AZStd::vector<TransformHierarchyNodeId> m_slotNodes; //!< InvalidTransformHierarchyNodeId for removed nodes.
+
+        // Per node data.
+        AZStd::vector<AZ::u32> m_nodeSlots;
+        AZStd::vector<TransformHierarchyNodeId> m_freeNodes;
+
+        //! First slot of every root, followed by the total number of slots. Only valid while the order is up to date.
+        AZStd::vector<AZ::u32> m_rootRanges;
+        //! Scratch buffer for the ancestors of a node that's updated on demand.
+        AZStd::vector<AZ::u32> m_ancestors;
+
+        bool m_isOrderDirty = false;
+        bool m_hasChanges = false;
+    };
+} // namespace AzFramework
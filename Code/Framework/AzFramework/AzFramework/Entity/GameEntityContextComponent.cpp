@@ -7,6 +7,7 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -18,6 +19,9 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, bg_batchedTransformHierarchy, false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly,
+        "If set to true, the world transforms of game entity hierarchies are updated in a batched pass once per frame instead of on every parent move");
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -84,6 +88,13 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Activate()
     {
+        if (bg_batchedTransformHierarchy)
+        {
+            // Transform components pick up the hierarchy when they're activated, so it has to be available first.
+            m_transformHierarchySystem.Connect();
+            m_isTransformHierarchyConnected = true;
+        }
+
         m_entityOwnershipService = AZStd::make_unique<SliceGameEntityOwnershipService>(GetContextId(), GetSerializeContext());
 
         InitContext();
@@ -105,6 +116,12 @@ namespace AzFramework
         DestroyContext();
 
         m_entityOwnershipService.reset();
+
+        if (m_isTransformHierarchyConnected)
+        {
+            m_transformHierarchySystem.Disconnect();
+            m_isTransformHierarchyConnected = false;
+        }
     }
 
     //=========================================================================
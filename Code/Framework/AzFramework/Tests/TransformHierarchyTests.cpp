@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AZTestShared/Math/MathTestHelpers.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/functional.h>
+#include <AzFramework/Components/TransformHierarchySystem.h>
+
+using namespace AzFramework;
+
+namespace UnitTest
+{
+    // Records every world transform the hierarchy reports for a node.
+    class HierarchyListener
+        : public TransformHierarchyListener
+    {
+    public:
+        void OnHierarchyWorldTMChanged(const AZ::Transform& worldTM) override
+        {
+            m_lastWorldTM = worldTM;
+            ++m_numChanges;
+            if (m_onChanged)
+            {
+                m_onChanged();
+            }
+        }
+
+        AZ::Transform m_lastWorldTM = AZ::Transform::CreateIdentity();
+        int m_numChanges = 0;
+        AZStd::function<void()> m_onChanged;
+    };
+
+    class TransformHierarchyTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_hierarchy = AZStd::make_unique<TransformHierarchySystem>();
+        }
+
+        void TearDown() override
+        {
+            m_hierarchy.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        // Adds a chain of nodes where every node is offset one unit along X from its parent.
+        AZStd::vector<TransformHierarchyNodeId> AddChain(AZStd::vector<HierarchyListener>& listeners)
+        {
+            const AZ::Transform localTM = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX());
+            AZStd::vector<TransformHierarchyNodeId> nodes;
+            AZ::Transform worldTM = AZ::Transform::CreateIdentity();
+            for (size_t i = 0; i < listeners.size(); ++i)
+            {
+                worldTM = i == 0 ? localTM : worldTM * localTM;
+                nodes.push_back(m_hierarchy->AddNode(&listeners[i], localTM, worldTM));
+                if (i > 0)
+                {
+                    m_hierarchy->SetParent(nodes[i], nodes[i - 1]);
+                }
+            }
+            m_hierarchy->UpdateHierarchy();
+
+            // Linking a node to its parent reports the derived world transform, only count later changes.
+            for (HierarchyListener& listener : listeners)
+            {
+                listener.m_numChanges = 0;
+            }
+            return nodes;
+        }
+
+    protected:
+        AZStd::unique_ptr<TransformHierarchySystem> m_hierarchy;
+    };
+
+    TEST_F(TransformHierarchyTests, UpdateHierarchy_RootMoved_DeepChainUpdated)
+    {
+        constexpr size_t chainLength = 64;
+        AZStd::vector<HierarchyListener> listeners(chainLength);
+        AZStd::vector<TransformHierarchyNodeId> nodes = AddChain(listeners);
+
+        const AZ::Transform rootTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 5.0f, 0.0f));
+        m_hierarchy->SetTransforms(nodes[0], rootTM, rootTM);
+        EXPECT_TRUE(m_hierarchy->IsWorldTMOutOfDate(nodes[chainLength - 1]));
+
+        m_hierarchy->UpdateHierarchy();
+
+        EXPECT_EQ(0, listeners[0].m_numChanges);
+        for (size_t i = 1; i < chainLength; ++i)
+        {
+            EXPECT_FALSE(m_hierarchy->IsWorldTMOutOfDate(nodes[i]));
+            EXPECT_EQ(1, listeners[i].m_numChanges);
+            EXPECT_THAT(listeners[i].m_lastWorldTM.GetTranslation(), IsClose(AZ::Vector3(static_cast<float>(i), 5.0f, 0.0f)));
+        }
+    }
+
+    TEST_F(TransformHierarchyTests, GetWorldTM_OutOfDateNode_ComputedOnDemand)
+    {
+        AZStd::vector<HierarchyListener> listeners(3);
+        AZStd::vector<TransformHierarchyNodeId> nodes = AddChain(listeners);
+
+        const AZ::Transform rootTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 0.0f, 2.0f));
+        m_hierarchy->SetTransforms(nodes[0], rootTM, rootTM);
+
+        EXPECT_THAT(m_hierarchy->GetWorldTM(nodes[2]).GetTranslation(), IsClose(AZ::Vector3(2.0f, 0.0f, 2.0f)));
+        EXPECT_FALSE(m_hierarchy->IsWorldTMOutOfDate(nodes[2]));
+        EXPECT_EQ(0, listeners[2].m_numChanges);
+
+        // Nodes computed on demand are still reported once in the next update.
+        m_hierarchy->UpdateHierarchy();
+        EXPECT_EQ(1, listeners[1].m_numChanges);
+        EXPECT_EQ(1, listeners[2].m_numChanges);
+    }
+
+    TEST_F(TransformHierarchyTests, UpdateHierarchy_ChildAddedBeforeParent_ParentNotifiedFirst)
+    {
+        HierarchyListener parentListener;
+        HierarchyListener childListener;
+        const AZ::Transform localTM = AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisX());
+        TransformHierarchyNodeId child = m_hierarchy->AddNode(&childListener, localTM, localTM);
+        TransformHierarchyNodeId parent = m_hierarchy->AddNode(&parentListener, localTM, localTM);
+        TransformHierarchyNodeId root = m_hierarchy->AddNode(nullptr, localTM, localTM);
+        m_hierarchy->SetParent(child, parent);
+        m_hierarchy->SetParent(parent, root);
+        m_hierarchy->UpdateHierarchy();
+
+        AZStd::vector<TransformHierarchyListener*> notifyOrder;
+        parentListener.m_onChanged = [&notifyOrder, &parentListener]() { notifyOrder.push_back(&parentListener); };
+        childListener.m_onChanged = [&notifyOrder, &childListener]() { notifyOrder.push_back(&childListener); };
+
+        m_hierarchy->SetTransforms(root, AZ::Transform::CreateIdentity(), AZ::Transform::CreateIdentity());
+        m_hierarchy->UpdateHierarchy();
+
+        ASSERT_EQ(2, notifyOrder.size());
+        EXPECT_EQ(&parentListener, notifyOrder[0]);
+        EXPECT_EQ(&childListener, notifyOrder[1]);
+        EXPECT_THAT(childListener.m_lastWorldTM.GetTranslation(), IsClose(AZ::Vector3(2.0f, 0.0f, 0.0f)));
+    }
+
+    TEST_F(TransformHierarchyTests, SetParent_RemovedParent_ChildBecomesRoot)
+    {
+        AZStd::vector<HierarchyListener> listeners(3);
+        AZStd::vector<TransformHierarchyNodeId> nodes = AddChain(listeners);
+
+        m_hierarchy->RemoveNode(nodes[1]);
+        EXPECT_EQ(2, m_hierarchy->GetNumNodes());
+        EXPECT_EQ(InvalidTransformHierarchyNodeId, m_hierarchy->GetParent(nodes[2]));
+
+        // The orphaned node keeps its world transform and no longer follows the old root.
+        const AZ::Transform rootTM = AZ::Transform::CreateTranslation(AZ::Vector3(0.0f, 3.0f, 0.0f));
+        m_hierarchy->SetTransforms(nodes[0], rootTM, rootTM);
+        m_hierarchy->UpdateHierarchy();
+        EXPECT_EQ(0, listeners[2].m_numChanges);
+        EXPECT_THAT(m_hierarchy->GetWorldTM(nodes[2]).GetTranslation(), IsClose(AZ::Vector3(3.0f, 0.0f, 0.0f)));
+
+        // Reparenting derives the world transform from the new parent.
+        m_hierarchy->SetParent(nodes[2], nodes[0]);
+        m_hierarchy->UpdateHierarchy();
+        EXPECT_EQ(nodes[0], m_hierarchy->GetParent(nodes[2]));
+        EXPECT_EQ(1, listeners[2].m_numChanges);
+        EXPECT_THAT(listeners[2].m_lastWorldTM.GetTranslation(), IsClose(AZ::Vector3(1.0f, 3.0f, 0.0f)));
+    }
+} // namespace UnitTest
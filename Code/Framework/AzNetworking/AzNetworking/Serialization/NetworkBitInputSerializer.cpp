@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitInputSerializer::NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity, const QuantizationSettings& settings)
+        : m_bitOffset(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+        , m_settings(settings)
+    {
+        ;
+    }
+
+    bool NetworkBitInputSerializer::SerializeQuaternion(AZ::Quaternion& value, [[maybe_unused]] const char* name)
+    {
+        float components[4];
+        value.StoreToFloat4(components);
+
+        uint32_t largestIndex = 0;
+        for (uint32_t index = 1; index < 4; ++index)
+        {
+            if (AZ::GetAbs(components[index]) > AZ::GetAbs(components[largestIndex]))
+            {
+                largestIndex = index;
+            }
+        }
+
+        // q and -q represent the same rotation, so flip the sign to keep the dropped component positive
+        const float sign = (components[largestIndex] < 0.0f) ? -1.0f : 1.0f;
+        const FloatQuantizer quantizer(-SmallestThreeComponentBound, SmallestThreeComponentBound, m_settings);
+        WriteBits(largestIndex, 2);
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            if (index != largestIndex)
+            {
+                SerializeFloat(components[index] * sign, quantizer);
+            }
+        }
+        return m_serializerValid;
+    }
+
+    SerializerMode NetworkBitInputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::ReadFromObject;
+    }
+
+    bool NetworkBitInputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        return WriteBits(value ? 1 : 0, 1);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitInputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, float minValue, float maxValue)
+    {
+        return SerializeFloat(value, FloatQuantizer(minValue, maxValue, m_settings));
+    }
+
+    bool NetworkBitInputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t rawValue = 0;
+        memcpy(&rawValue, &value, sizeof(double));
+        return WriteBits(rawValue, 64);
+    }
+
+    bool NetworkBitInputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t index = 0; index < outSize; ++index)
+        {
+            if (!WriteBits(buffer[index], 8))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitInputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitInputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitInputSerializer::GetSize() const
+    {
+        // A partially written trailing byte still has to be sent
+        return (m_bitOffset + 7) / 8;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitInputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue)
+    {
+        m_serializerValid &= (inputValue >= minValue);
+        m_serializerValid &= (inputValue <= maxValue);
+        // Wrapping unsigned arithmetic keeps the full signed 64-bit range from overflowing
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        const uint64_t offsetValue = static_cast<uint64_t>(inputValue) - static_cast<uint64_t>(minValue);
+        return WriteBits(offsetValue, GetBitsForRange(valueRange));
+    }
+
+    bool NetworkBitInputSerializer::SerializeFloat(float value, const FloatQuantizer& quantizer)
+    {
+        if (quantizer.IsQuantized())
+        {
+            return WriteBits(quantizer.Quantize(value), quantizer.GetBitCount());
+        }
+
+        uint32_t rawValue = 0;
+        memcpy(&rawValue, &value, sizeof(float));
+        return WriteBits(rawValue, 32);
+    }
+
+    bool NetworkBitInputSerializer::WriteBits(uint64_t value, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitOffset) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        // Bits are written least significant first, so the stream layout does not depend on host endianness
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitOffset / 8;
+            const uint32_t bitIndex = m_bitOffset % 8;
+            const uint32_t writeCount = AZStd::min(8 - bitIndex, bitCount);
+            if (bitIndex == 0)
+            {
+                // Each byte is cleared when the stream first reaches it, so callers don't need to zero the buffer
+                m_buffer[byteIndex] = 0;
+            }
+            m_buffer[byteIndex] |= static_cast<uint8_t>((value & ((1u << writeCount) - 1)) << bitIndex);
+            value >>= writeCount;
+            m_bitOffset += writeCount;
+            bitCount -= writeCount;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/QuantizationSettings.h>
+#include <AzCore/Math/Quaternion.h>
+
+namespace AzNetworking
+{
+    //! @class NetworkBitInputSerializer
+    //! @brief Input serializer for writing an object model into a bit packed stream.
+    //!
+    //! Unlike NetworkInputSerializer, values are not byte aligned. Integers are written using exactly the number of bits
+    //! implied by their min and max bounds, booleans take a single bit, and floats are quantized to the precision in the
+    //! provided QuantizationSettings. Data written by this serializer must be read back with a NetworkBitOutputSerializer
+    //! using the same settings.
+    class NetworkBitInputSerializer final
+        : public ISerializer
+    {
+    public:
+
+        //! Constructor.
+        //! @param buffer         input buffer to write to
+        //! @param bufferCapacity capacity of the buffer in bytes
+        //! @param settings       quantization settings to apply to floating point values
+        NetworkBitInputSerializer(uint8_t* buffer, uint32_t bufferCapacity, const QuantizationSettings& settings);
+
+        //! Serialize a unit quaternion using smallest three compression.
+        //! The largest component is dropped and rebuilt on read, the remaining three are quantized to the configured precision.
+        //! @param value quaternion input value to serialize
+        //! @param name  string name of the value being serialized
+        //! @return boolean true for success, false for serialization failure
+        bool SerializeQuaternion(AZ::Quaternion& value, const char* name);
+
+        // ISerializer interfaces
+        SerializerMode GetSerializerMode() const override;
+        bool Serialize(    bool& value, const char* name) override;
+        bool Serialize(    char& value, const char* name,     char minValue,     char maxValue) override;
+        bool Serialize(  int8_t& value, const char* name,   int8_t minValue,   int8_t maxValue) override;
+        bool Serialize( int16_t& value, const char* name,  int16_t minValue,  int16_t maxValue) override;
+        bool Serialize( int32_t& value, const char* name,  int32_t minValue,  int32_t maxValue) override;
+        bool Serialize( int64_t& value, const char* name,  int64_t minValue,  int64_t maxValue) override;
+        bool Serialize( uint8_t& value, const char* name,  uint8_t minValue,  uint8_t maxValue) override;
+        bool Serialize(uint16_t& value, const char* name, uint16_t minValue, uint16_t maxValue) override;
+        bool Serialize(uint32_t& value, const char* name, uint32_t minValue, uint32_t maxValue) override;
+        bool Serialize(uint64_t& value, const char* name, uint64_t minValue, uint64_t maxValue) override;
+        bool Serialize(   float& value, const char* name,    float minValue,    float maxValue) override;
+        bool Serialize(  double& value, const char* name,   double minValue,   double maxValue) override;
+        bool SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, bool isString, uint32_t& outSize, const char* name) override;
+        bool BeginObject(const char *name, const char* typeName) override;
+        bool EndObject(const char *name, const char* typeName) override;
+
+        const uint8_t* GetBuffer() const override;
+        uint32_t GetCapacity() const override;
+        uint32_t GetSize() const override;
+        void ClearTrackedChangesFlag() override {}
+        bool GetTrackedChangesFlag() const override { return false; }
+        // ISerializer interfaces
+
+    private:
+
+         //! Private copy operator, do not allow copying instances
+        NetworkBitInputSerializer& operator=(const NetworkBitInputSerializer&) = delete;
+
+        template <typename ORIGINAL_TYPE>
+        bool SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE inputValue);
+
+        bool SerializeFloat(float value, const FloatQuantizer& quantizer);
+        bool WriteBits(uint64_t value, uint32_t bitCount);
+
+        uint32_t       m_bitOffset = 0;
+        const uint32_t m_bufferCapacity;
+        uint8_t*       m_buffer;
+        QuantizationSettings m_settings;
+    };
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/Math/MathUtils.h>
+#include <memory>
+
+namespace AzNetworking
+{
+    NetworkBitOutputSerializer::NetworkBitOutputSerializer(const uint8_t* buffer, uint32_t bufferCapacity, const QuantizationSettings& settings)
+        : m_bitOffset(0)
+        , m_bufferCapacity(bufferCapacity)
+        , m_buffer(buffer)
+        , m_settings(settings)
+    {
+        ;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeQuaternion(AZ::Quaternion& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t largestIndex = 0;
+        if (!ReadBits(largestIndex, 2))
+        {
+            return false;
+        }
+
+        float components[4];
+        float sumOfSquares = 0.0f;
+        const FloatQuantizer quantizer(-SmallestThreeComponentBound, SmallestThreeComponentBound, m_settings);
+        for (uint32_t index = 0; index < 4; ++index)
+        {
+            if (index != largestIndex)
+            {
+                components[index] = 0.0f;
+                SerializeFloat(components[index], quantizer);
+                sumOfSquares += components[index] * components[index];
+            }
+        }
+
+        if (m_serializerValid)
+        {
+            // The dropped component was made positive on write, rebuild it from the unit length constraint
+            components[largestIndex] = AZ::Sqrt(AZStd::max(0.0f, 1.0f - sumOfSquares));
+            value = AZ::Quaternion::CreateFromFloat4(components);
+        }
+        return m_serializerValid;
+    }
+
+    SerializerMode NetworkBitOutputSerializer::GetSerializerMode() const
+    {
+        return SerializerMode::WriteToObject;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(bool& value, [[maybe_unused]] const char* name)
+    {
+        uint64_t bitValue = 0;
+        if (ReadBits(bitValue, 1))
+        {
+            value = (bitValue > 0);
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(char& value, [[maybe_unused]] const char* name, char minValue, char maxValue)
+    {
+        return SerializeBoundedValue<char>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int8_t& value, [[maybe_unused]] const char* name, int8_t minValue, int8_t maxValue)
+    {
+        return SerializeBoundedValue<int8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int16_t& value, [[maybe_unused]] const char* name, int16_t minValue, int16_t maxValue)
+    {
+        return SerializeBoundedValue<int16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int32_t& value, [[maybe_unused]] const char* name, int32_t minValue, int32_t maxValue)
+    {
+        return SerializeBoundedValue<int32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(int64_t& value, [[maybe_unused]] const char* name, int64_t minValue, int64_t maxValue)
+    {
+        return SerializeBoundedValue<int64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint8_t& value, [[maybe_unused]] const char* name, uint8_t minValue, uint8_t maxValue)
+    {
+        return SerializeBoundedValue<uint8_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint16_t& value, [[maybe_unused]] const char* name, uint16_t minValue, uint16_t maxValue)
+    {
+        return SerializeBoundedValue<uint16_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint32_t& value, [[maybe_unused]] const char* name, uint32_t minValue, uint32_t maxValue)
+    {
+        return SerializeBoundedValue<uint32_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(uint64_t& value, [[maybe_unused]] const char* name, uint64_t minValue, uint64_t maxValue)
+    {
+        return SerializeBoundedValue<uint64_t>(minValue, maxValue, value);
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(float& value, [[maybe_unused]] const char* name, float minValue, float maxValue)
+    {
+        return SerializeFloat(value, FloatQuantizer(minValue, maxValue, m_settings));
+    }
+
+    bool NetworkBitOutputSerializer::Serialize(double& value, [[maybe_unused]] const char* name, [[maybe_unused]] double minValue, [[maybe_unused]] double maxValue)
+    {
+        uint64_t rawValue = 0;
+        if (ReadBits(rawValue, 64))
+        {
+            memcpy(&value, &rawValue, sizeof(double));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeBytes(uint8_t* buffer, uint32_t bufferCapacity, [[maybe_unused]] bool isString, uint32_t& outSize, [[maybe_unused]] const char* name)
+    {
+        if (!SerializeBoundedValue<uint32_t>(0, bufferCapacity, outSize))
+        {
+            return false;
+        }
+
+        for (uint32_t index = 0; index < outSize; ++index)
+        {
+            uint64_t byteValue = 0;
+            if (!ReadBits(byteValue, 8))
+            {
+                return false;
+            }
+            buffer[index] = static_cast<uint8_t>(byteValue);
+        }
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::BeginObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    bool NetworkBitOutputSerializer::EndObject([[maybe_unused]] const char* name, [[maybe_unused]] const char* typeName)
+    {
+        return true;
+    }
+
+    const uint8_t* NetworkBitOutputSerializer::GetBuffer() const
+    {
+        return m_buffer;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetCapacity() const
+    {
+        return m_bufferCapacity;
+    }
+
+    uint32_t NetworkBitOutputSerializer::GetSize() const
+    {
+        return (m_bitOffset + 7) / 8;
+    }
+
+    template <typename ORIGINAL_TYPE>
+    bool NetworkBitOutputSerializer::SerializeBoundedValue(ORIGINAL_TYPE minValue, ORIGINAL_TYPE maxValue, ORIGINAL_TYPE& outValue)
+    {
+        const uint64_t valueRange = static_cast<uint64_t>(maxValue) - static_cast<uint64_t>(minValue);
+        uint64_t offsetValue = 0;
+        if (ReadBits(offsetValue, GetBitsForRange(valueRange)))
+        {
+            m_serializerValid &= (offsetValue <= valueRange);
+            outValue = m_serializerValid ? static_cast<ORIGINAL_TYPE>(static_cast<uint64_t>(minValue) + offsetValue) : outValue;
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::SerializeFloat(float& outValue, const FloatQuantizer& quantizer)
+    {
+        if (quantizer.IsQuantized())
+        {
+            uint64_t quantizedValue = 0;
+            if (ReadBits(quantizedValue, quantizer.GetBitCount()))
+            {
+                outValue = quantizer.Dequantize(quantizedValue);
+            }
+            return m_serializerValid;
+        }
+
+        uint64_t rawValue = 0;
+        if (ReadBits(rawValue, 32))
+        {
+            const uint32_t rawFloat = static_cast<uint32_t>(rawValue);
+            memcpy(&outValue, &rawFloat, sizeof(float));
+        }
+        return m_serializerValid;
+    }
+
+    bool NetworkBitOutputSerializer::ReadBits(uint64_t& outValue, uint32_t bitCount)
+    {
+        if (!m_serializerValid || (static_cast<uint64_t>(m_bitOffset) + bitCount > static_cast<uint64_t>(m_bufferCapacity) * 8))
+        {
+            // Keep the failed boolean so we can verify serialization success
+            m_serializerValid = false;
+            return false;
+        }
+
+        uint64_t value = 0;
+        uint32_t shift = 0;
+        while (bitCount > 0)
+        {
+            const uint32_t byteIndex = m_bitOffset / 8;
+            const uint32_t bitIndex = m_bitOffset % 8;
+            const uint32_t readCount = AZStd::min(8 - bitIndex, bitCount);
+            const uint64_t bits = (m_buffer[byteIndex] >> bitIndex) & ((1u << readCount) - 1);
+            value |= bits << shift;
+            shift += readCount;
+            m_bitOffset += readCount;
+            bitCount -= readCount;
+        }
+        outValue = value;
+        return true;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <stdint.h>
+
+namespace AzNetworking
+{
+    //! @struct QuantizationSettings
+    //! @brief Controls how the bit packing serializers quantize floating point values.
+    struct QuantizationSettings
+    {
+        //! Quantization step for floats and quaternion components, 0 serializes floats at full width
+        float m_precision = 0.0f;
+
+        //! Range used to quantize floats that are serialized without explicit bounds, values outside of it are clamped
+        float m_minValue = -1.0f;
+        float m_maxValue = 1.0f;
+    };
+
+    //! Every component of a unit quaternion except the largest lies within +/- 1/sqrt(2), used for smallest three compression
+    constexpr float SmallestThreeComponentBound = 0.7071068f;
+
+    //! Returns the number of bits required to represent every value in [0, range].
+    //! @param range the largest value that needs to be represented
+    //! @return the number of bits required to represent every value in [0, range]
+    inline uint32_t GetBitsForRange(uint64_t range)
+    {
+        uint32_t bitCount = 0;
+        while (range != 0)
+        {
+            ++bitCount;
+            range >>= 1;
+        }
+        return bitCount;
+    }
+
+    //! @class FloatQuantizer
+    //! @brief Maps a bounded float onto the smallest integer range that preserves the configured precision.
+    class FloatQuantizer
+    {
+    public:
+
+        //! Largest quantized width, anything wider is cheaper to send as a raw float.
+        static constexpr uint32_t MaxQuantizedBits = 31;
+
+        //! Constructor.
+        //! @param minValue the minimum value expected during serialization
+        //! @param maxValue the maximum value expected during serialization, the settings range is used if the bounds are unset
+        //! @param settings quantization settings to apply
+        FloatQuantizer(float minValue, float maxValue, const QuantizationSettings& settings)
+        {
+            const bool hasBounds = (minValue < maxValue) && (maxValue < AZStd::numeric_limits<float>::max());
+            m_minValue = hasBounds ? minValue : settings.m_minValue;
+            m_maxValue = hasBounds ? maxValue : settings.m_maxValue;
+            if ((settings.m_precision > 0.0f) && (m_minValue < m_maxValue))
+            {
+                m_precision = static_cast<double>(settings.m_precision);
+                const double steps = (static_cast<double>(m_maxValue) - static_cast<double>(m_minValue)) / m_precision;
+                if (steps < static_cast<double>(1u << MaxQuantizedBits))
+                {
+                    m_maxQuantized = static_cast<uint64_t>(steps + 0.5);
+                    m_bitCount = GetBitsForRange(m_maxQuantized);
+                }
+            }
+        }
+
+        //! Returns true if values are quantized, false if they must be serialized at full width.
+        bool IsQuantized() const
+        {
+            return m_bitCount > 0;
+        }
+
+        //! Returns the number of bits each quantized value occupies.
+        uint32_t GetBitCount() const
+        {
+            return m_bitCount;
+        }
+
+        //! Quantizes a value, clamping it to the quantizer bounds.
+        //! @param value the value to quantize
+        //! @return the quantized integral value
+        uint64_t Quantize(float value) const
+        {
+            // Written so that NaN clamps to the minimum value
+            const float clamped = (value >= m_minValue) ? AZStd::min(value, m_maxValue) : m_minValue;
+            const double offset = (static_cast<double>(clamped) - static_cast<double>(m_minValue)) / m_precision;
+            return AZStd::min(static_cast<uint64_t>(offset + 0.5), m_maxQuantized);
+        }
+
+        //! Restores a value from its quantized integral value.
+        //! @param quantized the quantized integral value
+        //! @return the restored value
+        float Dequantize(uint64_t quantized) const
+        {
+            const double value = static_cast<double>(m_minValue) + static_cast<double>(AZStd::min(quantized, m_maxQuantized)) * m_precision;
+            return AZStd::min(static_cast<float>(value), m_maxValue);
+        }
+
+    private:
+
+        float m_minValue = 0.0f;
+        float m_maxValue = 0.0f;
+        double m_precision = 0.0;
+        uint64_t m_maxQuantized = 0;
+        uint32_t m_bitCount = 0;
+    };
+}
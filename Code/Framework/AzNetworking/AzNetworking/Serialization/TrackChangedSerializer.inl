@@ -140,7 +140,7 @@ namespace AzNetworking
             return false;
         }
         const bool result = BASE_TYPE::SerializeBytes(buffer, bufferCapacity, isString, outSize, name);
-        m_hasChanged |= (cached.IsSame(buffer, outSize));
+        m_hasChanged |= !cached.IsSame(buffer, outSize);
         return result;
     }
 
@@ -7,6 +7,7 @@
 
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpConnection.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 
 namespace AzNetworking
 {
@@ -52,10 +53,19 @@ namespace AzNetworking
 
     void UdpConnectionSet::VisitConnections(const ConnectionVisitor& visitor)
     {
+        // Visitors commonly send a packet to each connection, so collect those sends into a single batch
+        if (m_sendBatchSocket != nullptr)
+        {
+            m_sendBatchSocket->BeginSendBatch();
+        }
         for (auto& connection : m_connectionIdMap)
         {
             visitor(*connection.second);
         }
+        if (m_sendBatchSocket != nullptr)
+        {
+            m_sendBatchSocket->EndSendBatch();
+        }
     }
 
     bool UdpConnectionSet::DeleteConnection(ConnectionId connectionId)
@@ -133,4 +143,9 @@ namespace AzNetworking
         }
         return nullptr;
     }
+
+    void UdpConnectionSet::SetSendBatchSocket(UdpSocket* socket)
+    {
+        m_sendBatchSocket = socket;
+    }
 }
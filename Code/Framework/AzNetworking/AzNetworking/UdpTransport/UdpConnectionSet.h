@@ -14,6 +14,7 @@
 namespace AzNetworking
 {
     class UdpConnection;
+    class UdpSocket;
 
     //! @class UdpConnectionSet
     //! @brief Tracks current UDP endpoints and allows fast lookups by connection identifier and remote address.
@@ -53,10 +54,15 @@ namespace AzNetworking
         //! @return pointer to the requested connection instance on success, nullptr on failure
         UdpConnection* GetConnection(const IpAddress& address) const;
 
+        //! Sets the socket the connections send on, so packets sent while visiting the connections are sent as a single batch.
+        //! @param socket the socket the connections send on
+        void SetSendBatchSocket(UdpSocket* socket);
+
     private:
 
         ConnectionId     m_nextConnectionId = InvalidConnectionId;
         ConnectionIdMap  m_connectionIdMap;
         RemoteAddressMap m_remoteAddressMap;
+        UdpSocket*       m_sendBatchSocket = nullptr;
     };
 }
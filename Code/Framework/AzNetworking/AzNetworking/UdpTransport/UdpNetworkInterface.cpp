@@ -64,6 +64,7 @@ namespace AzNetworking
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
         const AZ::Name compressorName = AZ::Name(compressor);
         m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        m_connectionSet.SetSendBatchSocket(m_socket.get());
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -173,6 +174,9 @@ namespace AzNetworking
             return;
         }
 
+        // Acks, resends and heartbeats sent during the update go out together once the update is done
+        m_socket->BeginSendBatch();
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -331,6 +335,8 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        m_socket->EndSendBatch();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -10,6 +10,7 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AzNetworking
 {
@@ -175,7 +176,6 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
                 const uint32_t bufferHead = receiveBuffer.GetSize();
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
@@ -184,18 +184,43 @@ namespace AzNetworking
                     break;
                 }
 
-                uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                // Receive a batch of packets straight into the free space of the receive buffer, one slot per packet
+                const uint32_t freeSlotCount = (receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t freePacketCount = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t slotCount = AZStd::min(AZStd::min(freeSlotCount, freePacketCount), UdpSocket::MaxBatchedDatagrams);
+                if (slotCount == 0)
+                {
+                    break;
+                }
+
+                UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchedDatagrams];
+                uint8_t* slotData = receiveBuffer.GetBufferEnd();
+                receiveBuffer.Resize(bufferHead + slotCount * MaxUdpTransmissionUnit);
+                for (uint32_t i = 0; i < slotCount; ++i)
+                {
+                    datagrams[i].m_buffer = slotData + i * MaxUdpTransmissionUnit;
+                    datagrams[i].m_bufferSize = MaxUdpTransmissionUnit;
+                }
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const uint32_t receivedCount = socket->ReceiveBatch(datagrams, slotCount);
+
+                // Pack the received packets together, so the receive buffer only grows by the received bytes
+                uint32_t bufferTail = bufferHead;
+                for (uint32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    uint8_t* dstData = receiveBuffer.GetBuffer() + bufferTail;
+                    if (dstData != datagrams[i].m_buffer)
+                    {
+                        memmove(dstData, datagrams[i].m_buffer, datagrams[i].m_receivedBytes);
+                    }
+                    receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, dstData, datagrams[i].m_receivedBytes));
+                    bufferTail += datagrams[i].m_receivedBytes;
                 }
-                else
+                receiveBuffer.Resize(bufferTail);
+
+                if (receivedCount < slotCount)
                 {
-                    receiveBuffer.Resize(bufferHead);
+                    // The socket has been drained
                     break;
                 }
             }
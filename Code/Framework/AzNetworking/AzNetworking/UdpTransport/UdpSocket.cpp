@@ -22,6 +22,7 @@ namespace AzNetworking
     AZ_CVAR(int32_t, net_UdpSendBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket send buffer size");
     AZ_CVAR(int32_t, net_UdpRecvBufferSize, 1 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Default UDP socket receive buffer size");
     AZ_CVAR(bool, net_UdpIgnoreWin10054, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, will ignore 10054 socket errors on windows");
+    AZ_CVAR(bool, net_UdpBatchedIo, true, nullptr, AZ::ConsoleFunctorFlags::Null, "If true, UDP sockets read and write multiple packets per system call on platforms that support it");
 
     UdpSocket::~UdpSocket()
     {
@@ -97,6 +98,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        FlushSendBatch();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -224,9 +226,172 @@ namespace AzNetworking
         return receivedBytes;
     }
 
+    uint32_t UdpSocket::ReceiveBatch(ReceivedDatagram* datagrams, uint32_t count) const
+    {
+        AZ_Assert(count <= MaxBatchedDatagrams, "Too many datagrams passed to ReceiveBatch");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (net_UdpBatchedIo)
+        {
+            sockaddr_in from[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            mmsghdr messages[MaxBatchedDatagrams];
+            memset(messages, 0, sizeof(mmsghdr) * count);
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                buffers[i].iov_base = datagrams[i].m_buffer;
+                buffers[i].iov_len = datagrams[i].m_bufferSize;
+                messages[i].msg_hdr.msg_name = &from[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t receivedCount = recvmmsg(static_cast<int32_t>(m_socketFd), messages, count, 0, nullptr);
+            if (receivedCount < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                return 0;
+            }
+
+            uint32_t received = 0;
+            for (int32_t i = 0; i < receivedCount; ++i)
+            {
+                const int32_t receivedBytes = aznumeric_cast<int32_t>(messages[i].msg_len);
+                if (receivedBytes <= 0)
+                {
+                    continue;
+                }
+
+                // Move the payload down over any skipped empty datagrams, so the received payloads stay in order at the front
+                ReceivedDatagram& datagram = datagrams[received];
+                AZStd::swap(datagram, datagrams[i]);
+                datagram.m_address = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+                datagram.m_receivedBytes = receivedBytes;
+                ++received;
+
+                m_recvPackets++;
+                m_recvBytes += receivedBytes;
+            }
+            return received;
+        }
+#endif
+
+        uint32_t received = 0;
+        while (received < count)
+        {
+            ReceivedDatagram& datagram = datagrams[received];
+            datagram.m_receivedBytes = Receive(datagram.m_address, datagram.m_buffer, datagram.m_bufferSize);
+            if (datagram.m_receivedBytes <= 0)
+            {
+                break;
+            }
+            ++received;
+        }
+        return received;
+    }
+
+    void UdpSocket::BeginSendBatch()
+    {
+        ++m_sendBatchDepth;
+    }
+
+    void UdpSocket::EndSendBatch()
+    {
+        AZ_Assert(m_sendBatchDepth > 0, "EndSendBatch called without a matching BeginSendBatch");
+        if (--m_sendBatchDepth == 0)
+        {
+            FlushSendBatch();
+        }
+    }
+
+    void UdpSocket::FlushSendBatch() const
+    {
+        if (m_sendBatch == nullptr || m_sendBatch->m_count == 0)
+        {
+            return;
+        }
+
+        SendBatch& batch = *m_sendBatch;
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (IsOpen())
+        {
+            sockaddr_in destAddr[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            mmsghdr messages[MaxBatchedDatagrams];
+            memset(destAddr, 0, sizeof(sockaddr_in) * batch.m_count);
+            memset(messages, 0, sizeof(mmsghdr) * batch.m_count);
+            for (uint32_t i = 0; i < batch.m_count; ++i)
+            {
+                destAddr[i].sin_family = AF_INET;
+                destAddr[i].sin_addr.s_addr = batch.m_addresses[i].GetAddress(ByteOrder::Network);
+                destAddr[i].sin_port = batch.m_addresses[i].GetPort(ByteOrder::Network);
+                buffers[i].iov_base = batch.m_buffers[i].data();
+                buffers[i].iov_len = batch.m_sizes[i];
+                messages[i].msg_hdr.msg_name = &destAddr[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(destAddr[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            uint32_t sentCount = 0;
+            while (sentCount < batch.m_count)
+            {
+                const int32_t result = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, batch.m_count - sentCount, 0);
+                if (result < 0)
+                {
+                    const int32_t error = GetLastNetworkError();
+                    if (ErrorIsWouldBlock(error))
+                    {
+                        // The send buffer is full, drop the remaining payloads just like individual sends would
+                        break;
+                    }
+
+                    // Skip the payload that failed and send the rest
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    ++sentCount;
+                    continue;
+                }
+                sentCount += aznumeric_cast<uint32_t>(result);
+            }
+        }
+#endif
+        batch.m_count = 0;
+    }
+
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
     {
+#if AZ_TRAIT_USE_SOCKET_BATCHED_IO
+        if (m_sendBatchDepth > 0 && net_UdpBatchedIo && size <= MaxUdpTransmissionUnit)
+        {
+            if (m_sendBatch == nullptr)
+            {
+                m_sendBatch = AZStd::make_unique<SendBatch>();
+            }
+            else if (m_sendBatch->m_count == MaxBatchedDatagrams)
+            {
+                FlushSendBatch();
+            }
+
+            // The payload is sent once the batch is flushed, socket errors are reported at that point
+            const uint32_t index = m_sendBatch->m_count++;
+            m_sendBatch->m_addresses[index] = address;
+            m_sendBatch->m_sizes[index] = size;
+            memcpy(m_sendBatch->m_buffers[index].data(), data, size);
+            return aznumeric_cast<int32_t>(size);
+        }
+#endif
+
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
         destAddr.sin_family = AF_INET;
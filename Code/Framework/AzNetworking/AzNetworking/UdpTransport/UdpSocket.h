@@ -12,7 +12,9 @@
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -41,6 +43,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! The maximum number of payloads read or written by a single batched socket operation.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! A payload read by ReceiveBatch.
+        struct ReceivedDatagram
+        {
+            IpAddress m_address;
+            uint8_t* m_buffer = nullptr;
+            uint32_t m_bufferSize = 0;
+            int32_t m_receivedBytes = 0;
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -92,6 +106,19 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param datagrams array of datagrams, each providing the buffer and buffer size to receive a payload into
+        //! @param count     number of datagrams in the array, at most MaxBatchedDatagrams
+        //! @return number of payloads received, the first datagrams of the array hold the address and size of each payload
+        uint32_t ReceiveBatch(ReceivedDatagram* datagrams, uint32_t count) const;
+
+        //! Starts collecting the payloads sent on this socket, so they can be sent with a single system call on platforms that support it.
+        //! Batches can be nested, the collected payloads are sent once the outermost batch ends or the batch is full.
+        void BeginSendBatch();
+
+        //! Ends a batch started with BeginSendBatch, sending the collected payloads if this was the outermost batch.
+        void EndSendBatch();
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -129,7 +156,20 @@ namespace AzNetworking
 
     private:
 
+        //! Sends all payloads collected by the current send batch.
+        void FlushSendBatch() const;
+
+        struct SendBatch
+        {
+            AZStd::array<IpAddress, MaxBatchedDatagrams> m_addresses;
+            AZStd::array<uint32_t, MaxBatchedDatagrams> m_sizes;
+            AZStd::array<AZStd::array<uint8_t, MaxUdpTransmissionUnit>, MaxBatchedDatagrams> m_buffers;
+            uint32_t m_count = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        uint32_t m_sendBatchDepth = 0;
+        mutable AZStd::unique_ptr<SendBatch> m_sendBatch;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
@@ -55,12 +55,17 @@ set(FILES
     Serialization/HashSerializer.h
     Serialization/ISerializer.h
     Serialization/ISerializer.inl
+    Serialization/NetworkBitInputSerializer.cpp
+    Serialization/NetworkBitInputSerializer.h
+    Serialization/NetworkBitOutputSerializer.cpp
+    Serialization/NetworkBitOutputSerializer.h
     Serialization/NetworkInputSerializer.cpp
     Serialization/NetworkInputSerializer.h
     Serialization/NetworkInputSerializer.inl
     Serialization/NetworkOutputSerializer.cpp
     Serialization/NetworkOutputSerializer.h
     Serialization/NetworkOutputSerializer.inl
+    Serialization/QuantizationSettings.h
     Serialization/StringifySerializer.cpp
     Serialization/StringifySerializer.h
     Serialization/TrackChangedSerializer.h
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AzNetworking;
+
+    TEST(NetworkBitSerializerTests, IntegersUseBitsImpliedByBounds)
+    {
+        uint8_t buffer[64];
+        NetworkBitInputSerializer inSerializer(buffer, sizeof(buffer), QuantizationSettings());
+        ISerializer& inSerializerBase = inSerializer;
+
+        bool inFlag = true;
+        uint8_t inSmall = 5;         // 3 bits
+        int32_t inSigned = -100;     // 8 bits
+        int64_t inFullRange = AZStd::numeric_limits<int64_t>::min();
+        EXPECT_TRUE(inSerializerBase.Serialize(inFlag, "Flag"));
+        EXPECT_TRUE(inSerializerBase.Serialize(inSmall, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(inSerializerBase.Serialize(inSigned, "Signed", -128, 127));
+        EXPECT_TRUE(inSerializerBase.Serialize(inFullRange, "FullRange"));
+        EXPECT_EQ(inSerializer.GetSize(), 10u); // 1 + 3 + 8 + 64 bits
+
+        NetworkBitOutputSerializer outSerializer(buffer, inSerializer.GetSize(), QuantizationSettings());
+        ISerializer& outSerializerBase = outSerializer;
+        bool outFlag = false;
+        uint8_t outSmall = 0;
+        int32_t outSigned = 0;
+        int64_t outFullRange = 0;
+        EXPECT_TRUE(outSerializerBase.Serialize(outFlag, "Flag"));
+        EXPECT_TRUE(outSerializerBase.Serialize(outSmall, "Small", uint8_t(0), uint8_t(7)));
+        EXPECT_TRUE(outSerializerBase.Serialize(outSigned, "Signed", -128, 127));
+        EXPECT_TRUE(outSerializerBase.Serialize(outFullRange, "FullRange"));
+        EXPECT_EQ(outFlag, inFlag);
+        EXPECT_EQ(outSmall, inSmall);
+        EXPECT_EQ(outSigned, inSigned);
+        EXPECT_EQ(outFullRange, inFullRange);
+    }
+
+    TEST(NetworkBitSerializerTests, FloatsAreQuantizedToPrecision)
+    {
+        QuantizationSettings settings;
+        settings.m_precision = 0.01f;
+        settings.m_minValue = -1000.0f;
+        settings.m_maxValue = 1000.0f;
+
+        uint8_t buffer[64];
+        NetworkBitInputSerializer inSerializer(buffer, sizeof(buffer), settings);
+        ISerializer& inSerializerBase = inSerializer;
+        AZ::Vector3 inVector(12.345f, -999.99f, 500.0f);
+        EXPECT_TRUE(inSerializerBase.Serialize(inVector, "Vector"));
+        EXPECT_EQ(inSerializer.GetSize(), 7u); // 3 x 18 bits, instead of 12 bytes
+
+        NetworkBitOutputSerializer outSerializer(buffer, inSerializer.GetSize(), settings);
+        ISerializer& outSerializerBase = outSerializer;
+        AZ::Vector3 outVector = AZ::Vector3::CreateZero();
+        EXPECT_TRUE(outSerializerBase.Serialize(outVector, "Vector"));
+        EXPECT_TRUE(outVector.IsClose(inVector, 0.005f + 0.0001f));
+    }
+
+    TEST(NetworkBitSerializerTests, QuaternionsUseSmallestThree)
+    {
+        QuantizationSettings settings;
+        settings.m_precision = 0.001f;
+
+        uint8_t buffer[64];
+        NetworkBitInputSerializer inSerializer(buffer, sizeof(buffer), settings);
+        // Largest component is negative, so the sign flip must still produce the same rotation
+        AZ::Quaternion inRotation = AZ::Quaternion::CreateRotationZ(-3.0f);
+        EXPECT_TRUE(inSerializer.SerializeQuaternion(inRotation, "Rotation"));
+        EXPECT_EQ(inSerializer.GetSize(), 5u); // 2 + 3 x 11 bits, instead of 16 bytes
+
+        NetworkBitOutputSerializer outSerializer(buffer, inSerializer.GetSize(), settings);
+        AZ::Quaternion outRotation = AZ::Quaternion::CreateIdentity();
+        EXPECT_TRUE(outSerializer.SerializeQuaternion(outRotation, "Rotation"));
+        EXPECT_TRUE(outRotation.IsClose(inRotation, 0.002f) || outRotation.IsClose(-inRotation, 0.002f));
+    }
+
+    TEST(NetworkBitSerializerTests, OverflowInvalidatesSerializer)
+    {
+        uint8_t buffer[1];
+        NetworkBitInputSerializer inSerializer(buffer, sizeof(buffer), QuantizationSettings());
+        ISerializer& inSerializerBase = inSerializer;
+        uint16_t value = 1000;
+        EXPECT_FALSE(inSerializerBase.Serialize(value, "Value"));
+        EXPECT_FALSE(inSerializer.IsValid());
+    }
+}
@@ -1,13 +1,68 @@
 /*
  * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
- * 
+ *
  * SPDX-License-Identifier: Apache-2.0 OR MIT
  *
  */
 
 #include <AzNetworking/Serialization/TrackChangedSerializer.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 namespace UnitTest
 {
+    using namespace AzNetworking;
+
+    // Serializes the incoming payload over a local buffer that currently holds localPayload, returns whether a change was tracked
+    static bool SerializeBytesOverLocalPayload(const uint8_t* incomingPayload, const uint8_t* localPayload, uint32_t payloadSize)
+    {
+        uint8_t streamBuffer[64];
+        NetworkInputSerializer inSerializer(streamBuffer, sizeof(streamBuffer));
+        uint8_t incoming[16];
+        memcpy(incoming, incomingPayload, payloadSize);
+        uint32_t incomingSize = payloadSize;
+        EXPECT_TRUE(inSerializer.SerializeBytes(incoming, sizeof(incoming), false, incomingSize, "Payload"));
+
+        TrackChangedSerializer<NetworkOutputSerializer> outSerializer(streamBuffer, inSerializer.GetSize());
+        ISerializer& outSerializerBase = outSerializer;
+        uint8_t local[16];
+        memcpy(local, localPayload, payloadSize);
+        uint32_t localSize = payloadSize;
+        outSerializerBase.ClearTrackedChangesFlag();
+        EXPECT_TRUE(outSerializerBase.SerializeBytes(local, sizeof(local), false, localSize, "Payload"));
+        EXPECT_EQ(localSize, payloadSize);
+        EXPECT_EQ(memcmp(local, incomingPayload, payloadSize), 0);
+        return outSerializerBase.GetTrackedChangesFlag();
+    }
+
+    TEST(TrackChangedSerializerTests, SerializeBytes_SamePayload_NoChangeTracked)
+    {
+        const uint8_t payload[4] = { 1, 2, 3, 4 };
+        EXPECT_FALSE(SerializeBytesOverLocalPayload(payload, payload, sizeof(payload)));
+    }
+
+    TEST(TrackChangedSerializerTests, SerializeBytes_DifferentPayload_ChangeTracked)
+    {
+        const uint8_t incomingPayload[4] = { 1, 2, 3, 4 };
+        const uint8_t localPayload[4] = { 1, 2, 3, 5 };
+        EXPECT_TRUE(SerializeBytesOverLocalPayload(incomingPayload, localPayload, sizeof(incomingPayload)));
+    }
+
+    TEST(TrackChangedSerializerTests, Serialize_DifferentValue_ChangeTracked)
+    {
+        uint8_t streamBuffer[64];
+        NetworkInputSerializer inSerializer(streamBuffer, sizeof(streamBuffer));
+        ISerializer& inSerializerBase = inSerializer;
+        uint32_t incoming = 42;
+        EXPECT_TRUE(inSerializerBase.Serialize(incoming, "Value"));
+
+        TrackChangedSerializer<NetworkOutputSerializer> outSerializer(streamBuffer, inSerializer.GetSize());
+        ISerializer& outSerializerBase = outSerializer;
+        uint32_t local = 7;
+        outSerializerBase.ClearTrackedChangesFlag();
+        EXPECT_TRUE(outSerializerBase.Serialize(local, "Value"));
+        EXPECT_EQ(local, incoming);
+        EXPECT_TRUE(outSerializerBase.GetTrackedChangesFlag());
+    }
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpSocket.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace AzNetworking;
+
+    // Sends packets from one socket to another over the loopback interface on a single thread.
+    // The reported items per second are the packets per second a single core can send and receive.
+    class BM_UdpSocket
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint16_t ReceiverPort = 33450;
+        static constexpr uint32_t PacketsPerIteration = UdpSocket::MaxBatchedDatagrams;
+        static constexpr uint32_t PacketSize = 200;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            SocketLayerInit();
+
+            m_receiver = AZStd::make_unique<UdpSocket>();
+            m_receiver->Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer);
+            m_sender = AZStd::make_unique<UdpSocket>();
+            m_sender->Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer);
+            m_dtlsEndpoint = AZStd::make_unique<DtlsEndpoint>();
+
+            for (uint32_t i = 0; i < PacketSize; ++i)
+            {
+                m_packet[i] = static_cast<uint8_t>(i);
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_dtlsEndpoint.reset();
+            m_sender.reset();
+            m_receiver.reset();
+
+            SocketLayerShutdown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        void SendPackets()
+        {
+            const IpAddress address(127, 0, 0, 1, ReceiverPort);
+            for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+            {
+                m_sender->Send(address, m_packet, PacketSize, false, *m_dtlsEndpoint, m_connectionQuality);
+            }
+        }
+
+        AZStd::unique_ptr<UdpSocket> m_receiver;
+        AZStd::unique_ptr<UdpSocket> m_sender;
+        AZStd::unique_ptr<DtlsEndpoint> m_dtlsEndpoint;
+        ConnectionQuality m_connectionQuality;
+        uint8_t m_packet[PacketSize];
+        uint8_t m_receiveBuffer[PacketsPerIteration][MaxUdpTransmissionUnit];
+    };
+
+    BENCHMARK_F(BM_UdpSocket, SendReceive)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            SendPackets();
+
+            // Drain the socket the way the reader thread does, until no more packets are available
+            uint32_t receivedCount = 0;
+            IpAddress address;
+            while (m_receiver->Receive(address, m_receiveBuffer[receivedCount % PacketsPerIteration], MaxUdpTransmissionUnit) > 0)
+            {
+                ++receivedCount;
+            }
+            benchmark::DoNotOptimize(receivedCount);
+        }
+        state.SetItemsProcessed(state.iterations() * PacketsPerIteration);
+    }
+
+    BENCHMARK_F(BM_UdpSocket, SendReceiveBatched)(benchmark::State& state)
+    {
+        UdpSocket::ReceivedDatagram datagrams[PacketsPerIteration];
+        for (auto _ : state)
+        {
+            m_sender->BeginSendBatch();
+            SendPackets();
+            m_sender->EndSendBatch();
+
+            uint32_t receivedCount = 0;
+            for (;;)
+            {
+                for (uint32_t i = 0; i < PacketsPerIteration; ++i)
+                {
+                    datagrams[i].m_buffer = m_receiveBuffer[i];
+                    datagrams[i].m_bufferSize = MaxUdpTransmissionUnit;
+                }
+
+                const uint32_t batchCount = m_receiver->ReceiveBatch(datagrams, PacketsPerIteration);
+                receivedCount += batchCount;
+                if (batchCount < PacketsPerIteration)
+                {
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(receivedCount);
+        }
+        state.SetItemsProcessed(state.iterations() * PacketsPerIteration);
+    }
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -243,6 +244,52 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, TestBatchedSendReceive)
+    {
+        constexpr uint16_t ReceiverPort = 12346;
+        constexpr uint32_t NumTestPackets = 3;
+
+        UdpSocket receiver;
+        UdpSocket sender;
+        EXPECT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        EXPECT_TRUE(sender.Open(0, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+
+        DtlsEndpoint dtlsEndpoint;
+        const uint8_t packetData[NumTestPackets] = { 1, 2, 3 };
+        sender.BeginSendBatch();
+        for (uint32_t i = 0; i < NumTestPackets; ++i)
+        {
+            // Each packet has a different size, so the received packets can be told apart
+            EXPECT_EQ(sender.Send(IpAddress(127, 0, 0, 1, ReceiverPort), packetData, i + 1, false, dtlsEndpoint, ConnectionQuality()), aznumeric_cast<int32_t>(i + 1));
+        }
+        sender.EndSendBatch();
+
+        uint8_t receiveBuffers[UdpSocket::MaxBatchedDatagrams][MaxUdpTransmissionUnit];
+        UdpSocket::ReceivedDatagram datagrams[UdpSocket::MaxBatchedDatagrams];
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < NumTestPackets && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 1000 })
+        {
+            const uint32_t slotCount = UdpSocket::MaxBatchedDatagrams - receivedCount;
+            for (uint32_t i = 0; i < slotCount; ++i)
+            {
+                datagrams[receivedCount + i].m_buffer = receiveBuffers[receivedCount + i];
+                datagrams[receivedCount + i].m_bufferSize = MaxUdpTransmissionUnit;
+            }
+            receivedCount += receiver.ReceiveBatch(datagrams + receivedCount, slotCount);
+        }
+
+        EXPECT_EQ(receivedCount, NumTestPackets);
+        for (uint32_t i = 0; i < receivedCount; ++i)
+        {
+            EXPECT_EQ(datagrams[i].m_receivedBytes, aznumeric_cast<int32_t>(i + 1));
+            EXPECT_EQ(memcmp(datagrams[i].m_buffer, packetData, i + 1), 0);
+            EXPECT_EQ(datagrams[i].m_address.GetAddress(ByteOrder::Host), IpAddress(127, 0, 0, 1, 0).GetAddress(ByteOrder::Host));
+        }
+        EXPECT_EQ(sender.GetSentPackets(), NumTestPackets);
+        EXPECT_EQ(receiver.GetRecvPackets(), NumTestPackets);
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
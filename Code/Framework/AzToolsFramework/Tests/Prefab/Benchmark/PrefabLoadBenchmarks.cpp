@@ -6,6 +6,7 @@
  */
 #if defined(HAVE_BENCHMARK)
 
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <Prefab/Benchmark/PrefabBenchmarkFixture.h>
 
 namespace Benchmark
@@ -47,6 +48,51 @@ namespace Benchmark
         ->Range(100, 1000)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    // Loads a list of entities, as found in prefabs, with the second argument as the parallel load threshold.
+    // A threshold of 0 loads all entities on the calling thread.
+    BENCHMARK_DEFINE_F(BM_PrefabLoad, LoadEntities_Json)(::benchmark::State& state)
+    {
+        const unsigned int numEntities = static_cast<unsigned int>(state.range(0));
+
+        AZStd::vector<AZ::Entity*> entities;
+        CreateEntities(numEntities, entities);
+
+        rapidjson::Document entitiesDom;
+        AZ::JsonSerialization::Store(entitiesDom, entitiesDom.GetAllocator(), entities);
+        for (AZ::Entity* entity : entities)
+        {
+            delete entity;
+        }
+
+        AZ::JsonDeserializerSettings settings;
+        settings.m_parallelLoadThreshold = static_cast<size_t>(state.range(1));
+
+        for (auto _ : state)
+        {
+            AZStd::vector<AZ::Entity*> loadedEntities;
+            AZ::JsonSerialization::Load(loadedEntities, entitiesDom, settings);
+
+            state.PauseTiming();
+
+            for (AZ::Entity* entity : loadedEntities)
+            {
+                delete entity;
+            }
+
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(numEntities);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabLoad, LoadEntities_Json)
+        ->Args({ 100, 0 })
+        ->Args({ 100, 64 })
+        ->Args({ 1000, 0 })
+        ->Args({ 1000, 64 })
+        ->Args({ 10000, 0 })
+        ->Args({ 10000, 64 })
+        ->Unit(benchmark::kMillisecond);
 }
 
 #endif
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <TraceReplay.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::StreamerTraceReplay
+{
+    static constexpr char ReplayWindow[] = "StreamerTraceReplay";
+
+    namespace Internal
+    {
+        struct PassState
+        {
+            AZStd::mutex m_lock;
+            AZStd::binary_semaphore m_allCompleted;
+            AZStd::atomic<u64> m_numPending{ 0 };
+            ReplayResult* m_result{ nullptr };
+        };
+
+        AZStd::string BuildPath(const ReplaySettings& settings, const AZStd::string& relativePath)
+        {
+            AZStd::string path = settings.m_root;
+            bool rootEndsWithSeparator = !path.empty() && (path.back() == '/' || path.back() == '\\');
+            bool relativeStartsWithSeparator = !relativePath.empty() && (relativePath.front() == '/' || relativePath.front() == '\\');
+            if (!path.empty() && !rootEndsWithSeparator && !relativeStartsWithSeparator)
+            {
+                path += '/';
+            }
+            path += (rootEndsWithSeparator && relativeStartsWithSeparator) ? relativePath.substr(1) : relativePath;
+            return path;
+        }
+
+        void ReplayPass(IO::Streamer& streamer, IO::IStreamerTypes::RequestMemoryAllocator& allocator, const IO::StreamerTrace& trace,
+            const ReplaySettings& settings, ReplayResult& result)
+        {
+            using namespace AZ::IO;
+
+            const AZStd::vector<StreamerTraceRecord>& records = trace.GetRecords();
+
+            AZStd::vector<AZStd::string> paths;
+            paths.reserve(trace.GetPaths().size());
+            for (const AZStd::string& path : trace.GetPaths())
+            {
+                paths.push_back(BuildPath(settings, path));
+            }
+
+            if (records.empty())
+            {
+                return;
+            }
+
+            // The last completion callback may still be releasing the semaphore after this thread has been woken up, so the
+            // callbacks share ownership of the state.
+            AZStd::shared_ptr<PassState> state = AZStd::make_shared<PassState>();
+            state->m_result = &result;
+            state->m_numPending = records.size();
+
+            auto start = AZStd::chrono::system_clock::now();
+            for (const StreamerTraceRecord& record : records)
+            {
+                if (settings.m_timeScale > 0.0)
+                {
+                    auto issueTime = start + AZStd::chrono::microseconds(
+                        aznumeric_cast<s64>(aznumeric_cast<double>(record.m_issueTimeUs) * settings.m_timeScale));
+                    auto now = AZStd::chrono::system_clock::now();
+                    if (issueTime > now)
+                    {
+                        AZStd::this_thread::sleep_for(issueTime - now);
+                    }
+                }
+
+                AZStd::chrono::microseconds deadline = IStreamerTypes::s_noDeadline;
+                if (record.m_deadlineUs != StreamerTraceRecord::s_noDeadline)
+                {
+                    deadline = AZStd::chrono::microseconds(AZStd::max<s64>(record.m_deadlineUs, 0));
+                }
+
+                FileRequestPtr request;
+                const AZStd::string& path = paths[record.m_pathIndex];
+                if (record.m_flags & StreamerTraceRecord::s_flagAllowReadOnlyView)
+                {
+                    request = streamer.ReadView(path, allocator, record.m_size, deadline, record.m_priority, record.m_offset);
+                }
+                else
+                {
+                    request = streamer.Read(path, allocator, record.m_size, deadline, record.m_priority, record.m_offset);
+                }
+
+                auto queueTime = AZStd::chrono::system_clock::now();
+                auto deadlineTime = (deadline == IStreamerTypes::s_noDeadline) ? FileRequest::s_noDeadlineTime : queueTime + deadline;
+                streamer.SetRequestCompleteCallback(request, [&streamer, state, queueTime, deadlineTime](FileRequestHandle handle)
+                    {
+                        auto now = AZStd::chrono::system_clock::now();
+                        auto latency = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(now - queueTime);
+
+                        void* buffer = nullptr;
+                        u64 numBytesRead = 0;
+                        IStreamerTypes::RequestStatus status = streamer.GetRequestStatus(handle);
+                        if (status == IStreamerTypes::RequestStatus::Completed)
+                        {
+                            streamer.GetReadRequestResult(handle, buffer, numBytesRead);
+                        }
+
+                        {
+                            AZStd::scoped_lock lock(state->m_lock);
+                            ReplayResult& result = *state->m_result;
+                            result.m_numRequests++;
+                            switch (status)
+                            {
+                            case IStreamerTypes::RequestStatus::Completed:
+                                result.m_numCompleted++;
+                                break;
+                            case IStreamerTypes::RequestStatus::Canceled:
+                                result.m_numCanceled++;
+                                break;
+                            default:
+                                result.m_numFailed++;
+                                break;
+                            }
+                            if (deadlineTime != FileRequest::s_noDeadlineTime)
+                            {
+                                result.m_numWithDeadline++;
+                                if (now > deadlineTime)
+                                {
+                                    result.m_numMissedDeadlines++;
+                                }
+                            }
+                            result.m_bytesRead += numBytesRead;
+                            result.m_totalLatency += latency;
+                            result.m_maxLatency = AZStd::max(result.m_maxLatency, latency);
+                        }
+
+                        if (--state->m_numPending == 0)
+                        {
+                            state->m_allCompleted.release();
+                        }
+                    });
+                streamer.QueueRequest(AZStd::move(request));
+            }
+
+            state->m_allCompleted.acquire();
+            result.m_duration += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::system_clock::now() - start);
+        }
+    } // namespace Internal
+
+    bool ReplayTrace(const IO::StreamerTrace& trace, const ReplaySettings& settings, ReplayResult& result)
+    {
+        using namespace AZ::IO;
+
+        AZStd::unique_ptr<Scheduler> scheduler = StreamerComponent::CreateStreamerStack(settings.m_profile);
+        if (!scheduler)
+        {
+            AZ_Error(ReplayWindow, false, "Unable to create a stream stack for profile '%s'.", settings.m_profile.c_str());
+            return false;
+        }
+
+        result = ReplayResult{};
+        IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+        {
+            Streamer streamer(AZStd::thread_desc{}, AZStd::move(scheduler));
+            for (u32 pass = 0; pass < settings.m_numPasses; ++pass)
+            {
+                AZ_TracePrintf(ReplayWindow, "Replaying pass %u of %u with %zu requests.\n",
+                    pass + 1, settings.m_numPasses, trace.GetRecords().size());
+                Internal::ReplayPass(streamer, allocator, trace, settings, result);
+            }
+            streamer.CollectStatistics(result.m_statistics);
+
+            // Requests release their memory when they're recycled, which can happen after the completion callback.
+            while (allocator.GetNumLocks() > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+        }
+        return true;
+    }
+
+    void PrintReport(const ReplayResult& result)
+    {
+        using namespace AZ::IO;
+
+        constexpr double bytesToMib = 1.0 / (1024.0 * 1024.0);
+        constexpr double usToSec = 1.0 / (1000.0 * 1000.0);
+        constexpr double usToMs = 1.0 / 1000.0;
+
+        double durationSec = aznumeric_cast<double>(result.m_duration.count()) * usToSec;
+        double throughput = durationSec > 0.0 ? (aznumeric_cast<double>(result.m_bytesRead) * bytesToMib) / durationSec : 0.0;
+        double averageLatencyMs = result.m_numRequests > 0
+            ? (aznumeric_cast<double>(result.m_totalLatency.count()) * usToMs) / aznumeric_cast<double>(result.m_numRequests)
+            : 0.0;
+        double missedPercentage = result.m_numWithDeadline > 0
+            ? (aznumeric_cast<double>(result.m_numMissedDeadlines) * 100.0) / aznumeric_cast<double>(result.m_numWithDeadline)
+            : 0.0;
+
+        AZ_Printf(ReplayWindow, "Requests: %llu (completed: %llu, failed: %llu, canceled: %llu)\n",
+            result.m_numRequests, result.m_numCompleted, result.m_numFailed, result.m_numCanceled);
+        AZ_Printf(ReplayWindow, "Data read: %.2f MiB in %.3f sec\n", aznumeric_cast<double>(result.m_bytesRead) * bytesToMib, durationSec);
+        AZ_Printf(ReplayWindow, "Throughput: %.2f MiB/s\n", throughput);
+        AZ_Printf(ReplayWindow, "Latency: %.3f ms avg, %.3f ms max\n",
+            averageLatencyMs, aznumeric_cast<double>(result.m_maxLatency.count()) * usToMs);
+        AZ_Printf(ReplayWindow, "Missed deadlines: %llu of %llu (%.2f%%)\n",
+            result.m_numMissedDeadlines, result.m_numWithDeadline, missedPercentage);
+
+        AZ_Printf(ReplayWindow, "Stream stack statistics:\n");
+        for (const Statistic& statistic : result.m_statistics)
+        {
+            switch (statistic.GetType())
+            {
+            case Statistic::Type::FloatingPoint:
+                AZ_Printf(ReplayWindow, "  %.*s/%.*s: %f\n", AZ_STRING_ARG(statistic.GetOwner()), AZ_STRING_ARG(statistic.GetName()),
+                    statistic.GetFloatValue());
+                break;
+            case Statistic::Type::Integer:
+                AZ_Printf(ReplayWindow, "  %.*s/%.*s: %lli\n", AZ_STRING_ARG(statistic.GetOwner()), AZ_STRING_ARG(statistic.GetName()),
+                    statistic.GetIntegerValue());
+                break;
+            case Statistic::Type::Percentage:
+                AZ_Printf(ReplayWindow, "  %.*s/%.*s: %.2f%%\n", AZ_STRING_ARG(statistic.GetOwner()), AZ_STRING_ARG(statistic.GetName()),
+                    statistic.GetPercentage() * 100.0);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+} // namespace AZ::StreamerTraceReplay
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::StreamerTraceReplay
+{
+    struct ReplaySettings
+    {
+        //! Alias or folder that the paths in the trace are relative to.
+        AZStd::string m_root{ "@assets@" };
+        //! Name of the Streamer profile to build the stream stack from. If empty the profile for the detected hardware is used.
+        AZStd::string m_profile;
+        //! Multiplier for the time between requests. 1 replays at the recorded pace, 0 queues all requests at once.
+        double m_timeScale{ 1.0 };
+        //! Number of times the trace is replayed. Caches are kept between passes, so later passes show the warm cache behavior.
+        u32 m_numPasses{ 1 };
+    };
+
+    struct ReplayResult
+    {
+        u64 m_numRequests{ 0 };
+        u64 m_numCompleted{ 0 };
+        u64 m_numFailed{ 0 };
+        u64 m_numCanceled{ 0 };
+        u64 m_numWithDeadline{ 0 };
+        u64 m_numMissedDeadlines{ 0 };
+        u64 m_bytesRead{ 0 };
+        AZStd::chrono::microseconds m_duration{ 0 };
+        AZStd::chrono::microseconds m_totalLatency{ 0 };
+        AZStd::chrono::microseconds m_maxLatency{ 0 };
+        //! Statistics from the stream stack, collected after the replay completed.
+        AZStd::vector<IO::Statistic> m_statistics;
+    };
+
+    //! Replays all requests in the trace against a newly created stream stack and waits for them to complete.
+    bool ReplayTrace(const IO::StreamerTrace& trace, const ReplaySettings& settings, ReplayResult& result);
+
+    //! Prints a summary of the replay and the statistics of the stream stack.
+    void PrintReport(const ReplayResult& result);
+} // namespace AZ::StreamerTraceReplay
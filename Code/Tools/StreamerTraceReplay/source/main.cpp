@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/Streamer/StreamerTrace.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/string/conversions.h>
+#include <AzFramework/Application/Application.h>
+#include <AzFramework/CommandLine/CommandLine.h>
+#include <TraceReplay.h>
+
+const char* appWindowName = "StreamerTraceReplay";
+enum class StreamerTraceReplayResult : AZ::u8
+{
+    Success = 0,
+
+    InvalidArg = 1,
+    FailedToLoadTrace,
+    FailedToReplay,
+};
+
+struct StreamerTraceReplayParams
+{
+    AZStd::string tracePath;
+    AZStd::vector<AZStd::string> settingsFiles;
+    AZ::StreamerTraceReplay::ReplaySettings settings;
+};
+
+void PrintUsage()
+{
+    AZ_Printf(appWindowName,
+        "Usage: StreamerTraceReplay <trace file> [options]\n"
+        "  --root <path>      Alias or folder the paths in the trace are relative to. Defaults to @assets@.\n"
+        "  --profile <name>   Streamer profile to build the stream stack from. Defaults to the profile for the detected hardware.\n"
+        "  --setreg <file>    Settings registry file to merge before the stream stack is created. Can be used multiple times to\n"
+        "                     try out stream stack configurations that aren't part of the project.\n"
+        "  --speed <factor>   Multiplier for the time between requests. 1 replays at the recorded pace, 0 as fast as possible.\n"
+        "  --passes <count>   Number of times to replay the trace.\n");
+}
+
+StreamerTraceReplayResult ParseArgs(const AzFramework::CommandLine* parser, StreamerTraceReplayParams& params)
+{
+    if (parser->GetNumMiscValues() < 1)
+    {
+        AZ_Error(appWindowName, false, "No trace file was provided.");
+        PrintUsage();
+        return StreamerTraceReplayResult::InvalidArg;
+    }
+    // AzFramework CommandLine consumes the first arg (the executable itself), so positional args start at 0
+    params.tracePath = parser->GetMiscValue(0);
+
+    if (parser->HasSwitch("root"))
+    {
+        params.settings.m_root = parser->GetSwitchValue("root", 0);
+    }
+    if (parser->HasSwitch("profile"))
+    {
+        params.settings.m_profile = parser->GetSwitchValue("profile", 0);
+    }
+    for (size_t index = 0; index < parser->GetNumSwitchValues("setreg"); ++index)
+    {
+        params.settingsFiles.push_back(parser->GetSwitchValue("setreg", index));
+    }
+    if (parser->HasSwitch("speed"))
+    {
+        params.settings.m_timeScale = AZStd::stod(parser->GetSwitchValue("speed", 0));
+        if (params.settings.m_timeScale < 0.0)
+        {
+            AZ_Error(appWindowName, false, "The replay speed can't be negative.");
+            return StreamerTraceReplayResult::InvalidArg;
+        }
+    }
+    if (parser->HasSwitch("passes"))
+    {
+        params.settings.m_numPasses = aznumeric_cast<AZ::u32>(AZStd::stoul(parser->GetSwitchValue("passes", 0)));
+        if (params.settings.m_numPasses == 0)
+        {
+            AZ_Error(appWindowName, false, "At least one pass is needed to replay the trace.");
+            return StreamerTraceReplayResult::InvalidArg;
+        }
+    }
+    return StreamerTraceReplayResult::Success;
+}
+
+StreamerTraceReplayResult StreamerTraceReplay(const StreamerTraceReplayParams& params)
+{
+    AZ::SettingsRegistryInterface* settingsRegistry = AZ::SettingsRegistry::Get();
+    for (const AZStd::string& settingsFile : params.settingsFiles)
+    {
+        if (!settingsRegistry->MergeSettingsFile(settingsFile, AZ::SettingsRegistryInterface::Format::JsonMergePatch))
+        {
+            AZ_Error(appWindowName, false, "Failed to merge settings file \"%s\".", settingsFile.c_str());
+            return StreamerTraceReplayResult::InvalidArg;
+        }
+    }
+
+    AZ::IO::FixedMaxPath tracePath;
+    if (!AZ::IO::FileIOBase::GetInstance()->ResolvePath(tracePath, AZ::IO::PathView(params.tracePath)))
+    {
+        tracePath = params.tracePath;
+    }
+
+    AZ::IO::StreamerTrace trace;
+    if (!trace.Load(tracePath.c_str()))
+    {
+        AZ_Error(appWindowName, false, "Failed to load Streamer trace \"%s\".", tracePath.c_str());
+        return StreamerTraceReplayResult::FailedToLoadTrace;
+    }
+
+    AZ::StreamerTraceReplay::ReplayResult result;
+    if (!AZ::StreamerTraceReplay::ReplayTrace(trace, params.settings, result))
+    {
+        return StreamerTraceReplayResult::FailedToReplay;
+    }
+    AZ::StreamerTraceReplay::PrintReport(result);
+    return StreamerTraceReplayResult::Success;
+}
+
+int main(int argc, char** argv)
+{
+    StreamerTraceReplayResult exitCode = StreamerTraceReplayResult::Success;
+
+    AzFramework::Application app(&argc, &argv);
+    app.Start(AzFramework::Application::Descriptor());
+    {
+        StreamerTraceReplayParams params;
+        exitCode = ParseArgs(app.GetCommandLine(), params);
+        if (exitCode == StreamerTraceReplayResult::Success)
+        {
+            exitCode = StreamerTraceReplay(params);
+        }
+
+        // Tick until everything is ready for shutdown
+        app.Tick();
+    }
+    app.Stop();
+    return static_cast<int>(exitCode);
+}
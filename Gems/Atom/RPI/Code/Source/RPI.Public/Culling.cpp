@@ -284,6 +284,21 @@ namespace AZ
             };
 
         private:
+            //! Bounding spheres of the cullables of an octree node, stored per component so they can be tested against the frustum four at a time
+            struct FineCullBatch
+            {
+                static constexpr size_t MaxCount = 64;
+
+                AzFramework::VisibilityEntry* m_entries[MaxCount];
+                Cullable* m_cullables[MaxCount];
+                float m_centerX[MaxCount];
+                float m_centerY[MaxCount];
+                float m_centerZ[MaxCount];
+                float m_radius[MaxCount];
+                IntersectResult m_results[MaxCount];
+                size_t m_count = 0;
+            };
+
             const AZStd::shared_ptr<JobData> m_jobData;
             CullingScene::WorkListType m_worklist;
 
@@ -347,22 +362,18 @@ namespace AZ
                     }
                     else
                     {
-                        //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        //Do fine-grained culling before adding objects to the view. The bounding spheres are gathered into batches
+                        //and tested against the frustum four at a time, only the spheres that overlap the frustum need the obb test.
+                        FineCullBatch batch;
+                        auto cullBatch = [&]()
                         {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                            {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
+                            m_jobData->m_frustum.IntersectSpheres(
+                                batch.m_centerX, batch.m_centerY, batch.m_centerZ, batch.m_radius, batch.m_count, batch.m_results);
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
+                            for (size_t i = 0; i < batch.m_count; ++i)
+                            {
+                                Cullable* c = batch.m_cullables[i];
+                                const IntersectResult res = batch.m_results[i];
                                 if (res == IntersectResult::Exterior)
                                 {
                                     continue;
@@ -370,7 +381,7 @@ namespace AZ
                                 else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
                                 {
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                                    if (TestOcclusionCulling(batch.m_entries[i]) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
                                     {
                                         numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
@@ -379,7 +390,37 @@ namespace AZ
                                     }
                                 }
                             }
+                            batch.m_count = 0;
+                        };
+
+                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        {
+                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
+                            {
+                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+
+                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                                    c->m_cullData.m_hideFlags & viewFlags ||
+                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                                    c->m_isHidden)
+                                {
+                                    continue;
+                                }
+
+                                const Vector3& center = c->m_cullData.m_boundingSphere.GetCenter();
+                                batch.m_entries[batch.m_count] = visibleEntry;
+                                batch.m_cullables[batch.m_count] = c;
+                                batch.m_centerX[batch.m_count] = center.GetX();
+                                batch.m_centerY[batch.m_count] = center.GetY();
+                                batch.m_centerZ[batch.m_count] = center.GetZ();
+                                batch.m_radius[batch.m_count] = c->m_cullData.m_boundingSphere.GetRadius();
+                                if (++batch.m_count == FineCullBatch::MaxCount)
+                                {
+                                    cullBatch();
+                                }
+                            }
                         }
+                        cullBatch();
                     }
 
                     if (m_jobData->m_debugCtx->m_debugDraw && (m_jobData->m_view->GetName() == m_jobData->m_debugCtx->m_currentViewSelectionName))
@@ -8,9 +8,16 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
 #include <AzNetworking/Serialization/ISerializer.h>
+#include <AzNetworking/Serialization/NetworkBitInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkBitOutputSerializer.h>
 #include <AzNetworking/DataStructures/FixedSizeBitsetView.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/NetworkTime/RewindableObject.h>
 #include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/MultiplayerTypes.h>
 #include <Multiplayer/IMultiplayer.h>
@@ -101,6 +108,128 @@ namespace Multiplayer
         return GetEntity()->FindComponent<ComponentType>();
     }
 
+    //! Largest serialized size of a single bit packed network property.
+    constexpr uint32_t MaxBitPackedPropertySize = 255;
+
+    //! Bit packed network properties are sent without a length, so only types whose packed size depends on the quantization
+    //! settings and not on the value can opt in.
+    template <typename TYPE>
+    struct IsFixedSizeBitPackedType
+        : AZStd::bool_constant<AZStd::is_arithmetic_v<TYPE>
+            || AZStd::is_same_v<TYPE, AZ::Vector2>
+            || AZStd::is_same_v<TYPE, AZ::Vector3>
+            || AZStd::is_same_v<TYPE, AZ::Vector4>
+            || AZStd::is_same_v<TYPE, AZ::Quaternion>>
+    {
+    };
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    struct IsFixedSizeBitPackedType<RewindableObject<BASE_TYPE, REWIND_SIZE>>
+        : IsFixedSizeBitPackedType<BASE_TYPE>
+    {
+    };
+
+    //! Routes a network property through a bit packing serializer.
+    //! Floats are quantized over the settings range, integers use the bit width of the settings range and unit
+    //! quaternions use smallest three compression.
+    template <typename TYPE, typename = void>
+    struct BitPackedPropertyHelper
+    {
+        template <typename SERIALIZER>
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, const char* name, [[maybe_unused]] const AzNetworking::QuantizationSettings& settings)
+        {
+            return static_cast<AzNetworking::ISerializer&>(serializer).Serialize(value, name);
+        }
+    };
+
+    template <typename TYPE>
+    struct BitPackedPropertyHelper<TYPE, AZStd::enable_if_t<AZStd::is_integral_v<TYPE> && !AZStd::is_same_v<TYPE, bool>>>
+    {
+        template <typename SERIALIZER>
+        static bool Serialize(SERIALIZER& serializer, TYPE& value, const char* name, const AzNetworking::QuantizationSettings& settings)
+        {
+            return static_cast<AzNetworking::ISerializer&>(serializer).Serialize(value, name, GetBound(settings.m_minValue), GetBound(settings.m_maxValue));
+        }
+
+        //! Converts a settings bound to the property type, bounds outside of the type's range select the whole range.
+        static TYPE GetBound(float bound)
+        {
+            if (bound <= static_cast<float>(AZStd::numeric_limits<TYPE>::lowest()))
+            {
+                return AZStd::numeric_limits<TYPE>::lowest();
+            }
+            if (bound >= static_cast<float>(AZStd::numeric_limits<TYPE>::max()))
+            {
+                return AZStd::numeric_limits<TYPE>::max();
+            }
+            return static_cast<TYPE>(bound);
+        }
+    };
+
+    template <>
+    struct BitPackedPropertyHelper<AZ::Quaternion>
+    {
+        template <typename SERIALIZER>
+        static bool Serialize(SERIALIZER& serializer, AZ::Quaternion& value, const char* name, [[maybe_unused]] const AzNetworking::QuantizationSettings& settings)
+        {
+            return serializer.SerializeQuaternion(value, name);
+        }
+    };
+
+    template <typename BASE_TYPE, AZStd::size_t REWIND_SIZE>
+    struct BitPackedPropertyHelper<RewindableObject<BASE_TYPE, REWIND_SIZE>>
+    {
+        template <typename SERIALIZER>
+        static bool Serialize(SERIALIZER& serializer, RewindableObject<BASE_TYPE, REWIND_SIZE>& value, const char* name, const AzNetworking::QuantizationSettings& settings)
+        {
+            BASE_TYPE baseValue = value.Get();
+            if (BitPackedPropertyHelper<BASE_TYPE>::Serialize(serializer, baseValue, name, settings) && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+            {
+                value = baseValue;
+            }
+            return serializer.IsValid();
+        }
+    };
+
+    //! Serializes a network property as a bit packed blob within the byte aligned stream.
+    //! The local value is always packed first. Its packed size only depends on the type and the settings, so it's also the size
+    //! of the incoming blob and no length is sent. Serializers that track changes compare the incoming blob against the quantized local value.
+    template <typename TYPE>
+    inline void SerializeBitPackedNetworkProperty
+    (
+        AzNetworking::ISerializer& serializer,
+        TYPE& value,
+        const char* name,
+        const AzNetworking::QuantizationSettings& bitPackingSettings
+    )
+    {
+        static_assert(IsFixedSizeBitPackedType<TYPE>::value, "BitPacked network properties must have a packed size that doesn't depend on their value");
+
+        uint8_t packedBuffer[MaxBitPackedPropertySize];
+        AzNetworking::NetworkBitInputSerializer packer(packedBuffer, sizeof(packedBuffer), bitPackingSettings);
+        BitPackedPropertyHelper<TYPE>::Serialize(packer, value, name, bitPackingSettings);
+        if (!packer.IsValid())
+        {
+            serializer.Invalidate();
+            return;
+        }
+
+        const uint32_t packedSize = packer.GetSize();
+        for (uint32_t byteIndex = 0; byteIndex < packedSize; ++byteIndex)
+        {
+            serializer.Serialize(packedBuffer[byteIndex], name);
+        }
+
+        if (serializer.IsValid() && (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject))
+        {
+            AzNetworking::NetworkBitOutputSerializer unpacker(packedBuffer, packedSize, bitPackingSettings);
+            if (!BitPackedPropertyHelper<TYPE>::Serialize(unpacker, value, name, bitPackingSettings))
+            {
+                serializer.Invalidate();
+            }
+        }
+    }
+
     template <typename TYPE>
     inline void SerializeNetworkPropertyHelper
     (
@@ -112,14 +241,22 @@ namespace Multiplayer
         const char* name, 
         NetComponentId componentId, 
         PropertyIndex propertyIndex, 
-        MultiplayerStats& stats
+        MultiplayerStats& stats,
+        const AzNetworking::QuantizationSettings* bitPackingSettings = nullptr
     )
     {
         if (bitset.GetBit(bitIndex))
         {
             const uint32_t prevUpdateSize = serializer.GetSize();
             serializer.ClearTrackedChangesFlag();
-            serializer.Serialize(value, name);
+            if (bitPackingSettings != nullptr)
+            {
+                SerializeBitPackedNetworkProperty(serializer, value, name, *bitPackingSettings);
+            }
+            else
+            {
+                serializer.Serialize(value, name);
+            }
             if (modifyRecord && !serializer.GetTrackedChangesFlag())
             {
                 // If the serializer didn't change any values, then lower the flag so we don't unnecessarily notify
@@ -170,6 +170,12 @@ namespace Multiplayer
         return (networkEntityManager != nullptr) ? networkEntityManager->GetNetworkEntityAuthorityTracker() : nullptr;
     }
 
+    inline EntityUpdateSerializationCache* GetEntityUpdateSerializationCache()
+    {
+        INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
+        return (networkEntityManager != nullptr) ? networkEntityManager->GetEntityUpdateSerializationCache() : nullptr;
+    }
+
     inline MultiplayerComponentRegistry* GetMultiplayerComponentRegistry()
     {
         INetworkEntityManager* networkEntityManager = GetNetworkEntityManager();
@@ -48,6 +48,18 @@ namespace Multiplayer
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! A single call to RecordPropertySent, kept so that reused serialized property updates can record their metrics again.
+        struct PropertySentSample
+        {
+            NetComponentId m_netComponentId = InvalidNetComponentId;
+            PropertyIndex m_propertyId = PropertyIndex{ 0 };
+            uint32_t m_totalBytes = 0;
+        };
+        using PropertySentSamples = AZStd::vector<PropertySentSample>;
+
+        //! If set, every call to RecordPropertySent is also appended to this list.
+        PropertySentSamples* m_propertySentCapture = nullptr;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
@@ -17,6 +17,7 @@ namespace Multiplayer
 {
     class NetworkEntityTracker;
     class NetworkEntityAuthorityTracker;
+    class EntityUpdateSerializationCache;
     class NetworkEntityRpcMessage;
     class MultiplayerComponentRegistry;
 
@@ -48,6 +49,10 @@ namespace Multiplayer
         //! @return the MultiplayerComponentRegistry for this INetworkEntityManager instance
         virtual MultiplayerComponentRegistry* GetMultiplayerComponentRegistry() = 0;
 
+        //! Returns the EntityUpdateSerializationCache shared by all connections for this INetworkEntityManager instance.
+        //! @return the EntityUpdateSerializationCache for this INetworkEntityManager instance
+        virtual EntityUpdateSerializationCache* GetEntityUpdateSerializationCache() = 0;
+
         //! Returns the HostId for this INetworkEntityManager instance.
         //! @return the HostId for this INetworkEntityManager instance
         virtual HostId GetHostId() const = 0;
@@ -36,6 +36,10 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_totalBytes += totalBytes;
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_callHistory[m_recordMetricIndex]++;
         m_componentStats[netComponentIndex].m_propertyUpdatesSent[propertyIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
+        if (m_propertySentCapture != nullptr)
+        {
+            m_propertySentCapture->push_back(PropertySentSample{ netComponentId, propertyId, totalBytes });
+        }
     }
 
     void MultiplayerStats::RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes)
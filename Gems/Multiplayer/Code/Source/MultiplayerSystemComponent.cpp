@@ -11,6 +11,7 @@
 #include <ConnectionData/ClientToServerConnectionData.h>
 #include <ConnectionData/ServerToClientConnectionData.h>
 #include <EntityDomains/FullOwnershipEntityDomain.h>
+#include <ReplicationWindows/InterestGridReplicationWindow.h>
 #include <ReplicationWindows/NullReplicationWindow.h>
 #include <ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Source/AutoGen/AutoComponentTypes.h>
@@ -80,6 +81,7 @@ namespace Multiplayer
     AZ_CVAR(bool, sv_isTransient, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether a dedicated server shuts down if all existing connections disconnect.");
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_UseInterestGrid, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Whether client replication windows gather entities from the shared interest grid instead of the visibility system");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The default spawnable to use when a new player connects");
 
     void MultiplayerSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -341,6 +343,10 @@ namespace Multiplayer
 
         // Send out the game state update to all connections
         {
+            // Serialized entity updates are only valid while network properties can't change, so they are shared within this send pass only
+            EntityUpdateSerializationCache* serializationCache = m_networkEntityManager.GetEntityUpdateSerializationCache();
+            serializationCache->Clear();
+
             auto sendNetworkUpdates = [hostTimeMs, &stats](IConnection& connection)
             {
                 if (connection.GetUserData() != nullptr)
@@ -359,6 +365,7 @@ namespace Multiplayer
             };
 
             m_networkInterface->GetConnectionSet().VisitConnections(sendNetworkUpdates);
+            serializationCache->Clear();
         }
 
         MultiplayerPackets::SyncConsole packet;
@@ -643,7 +650,19 @@ namespace Multiplayer
                 connection->SetUserData(new ServerToClientConnectionData(connection, *this, controlledEntity));
             }
 
-            AZStd::unique_ptr<IReplicationWindow> window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            AZStd::unique_ptr<IReplicationWindow> window;
+            if (sv_UseInterestGrid)
+            {
+                if (m_interestGridManager == nullptr)
+                {
+                    m_interestGridManager = AZStd::make_unique<InterestGridManager>();
+                }
+                window = AZStd::make_unique<InterestGridReplicationWindow>(*m_interestGridManager, controlledEntity, connection);
+            }
+            else
+            {
+                window = AZStd::make_unique<ServerToClientReplicationWindow>(controlledEntity, connection);
+            }
             reinterpret_cast<ServerToClientConnectionData*>(connection->GetUserData())->GetReplicationManager().SetReplicationWindow(AZStd::move(window));
         }
         else
@@ -11,6 +11,7 @@
 #include <Editor/MultiplayerEditorConnection.h>
 #include <NetworkTime/NetworkTime.h>
 #include <NetworkEntity/NetworkEntityManager.h>
+#include <ReplicationWindows/InterestGridManager.h>
 #include <Source/AutoGen/Multiplayer.AutoPacketDispatcher.h>
 
 #include <AzCore/Component/Component.h>
@@ -138,6 +139,7 @@ namespace Multiplayer
         AZ::ThreadSafeDeque<AZStd::string> m_cvarCommands;
 
         NetworkEntityManager m_networkEntityManager;
+        AZStd::unique_ptr<InterestGridManager> m_interestGridManager; // only created once a client connects with sv_UseInterestGrid enabled
         NetworkTime m_networkTime;
         MultiplayerAgentType m_agentType = MultiplayerAgentType::Uninitialized;
         
@@ -36,6 +36,9 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_ReplicationBandwidthBudgetBytes, 0, nullptr, AZ::ConsoleFunctorFlags::Null, "Bytes of entity updates each connection may send per tick, highest accumulated priority first, 0 sends every pending update up to the replication window limit");
+    AZ_CVAR(float, sv_ReplicationMinPriority, 0.000001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum priority an entity with pending updates accumulates per tick when a bandwidth budget is set");
+    AZ_CVAR(float, sv_ReplicationStalenessPriority, 0.0001f, nullptr, AZ::ConsoleFunctorFlags::Null, "Priority added per tick an entity update has waited when a bandwidth budget is set, so distant entities are not starved");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -115,7 +118,7 @@ namespace Multiplayer
         );
     }
 
-    void EntityReplicationManager::SendEntityUpdatesPacketHelper
+    uint32_t EntityReplicationManager::SendEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
         EntityReplicatorList& toSendList,
@@ -148,6 +151,7 @@ namespace Multiplayer
             pendingPacketSize += nextMessageSize;
             entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
             replicatorUpdatedList.push_back(replicator);
+            replicator->GetUpdatePriority().OnUpdateSent(nextMessageSize);
             toSendList.pop_front();
 
             if (largeEntityDetected)
@@ -172,6 +176,7 @@ namespace Multiplayer
         {
             replicator->GetPropertyPublisher()->FinalizeSerialization(sentId);
         }
+        return pendingPacketSize;
     }
 
     EntityReplicationManager::EntityReplicatorList EntityReplicationManager::GenerateEntityUpdateList()
@@ -184,8 +189,14 @@ namespace Multiplayer
         // Generate a list of all our entities that need updates
         EntityReplicatorList toSendList;
 
+        // With a bandwidth budget every pending replicator is a candidate, and the budget decides which of them are sent
+        const bool useBandwidthBudget = (sv_ReplicationBandwidthBudgetBytes > 0);
+        const uint32_t maxElements = useBandwidthBudget ? AZStd::numeric_limits<uint32_t>::max() : m_replicationWindow->GetMaxEntityReplicatorSendCount();
+
+        // Replicators are only marked pending creation once they are actually sent, so count the new ones considered this tick
+        uint32_t newPendingCreationCount = 0;
         uint32_t elementsAdded = 0;
-        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end() && elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount(); )
+        for (auto iter = m_replicatorsPendingSend.begin(); iter != m_replicatorsPendingSend.end() && elementsAdded < maxElements; )
         {
             EntityReplicator* replicator = GetEntityReplicator(*iter);
             bool clearPendingSend = true;
@@ -200,11 +211,16 @@ namespace Multiplayer
                     if (!propPublisher->IsRemoteReplicatorEstablished())
                     {
                         // If we have our maximum set of entities pending creation, and this entity isn't in that set, then skip it
-                        if ((m_remoteEntitiesPendingCreation.size() >= m_maxRemoteEntitiesPendingCreationCount) && (m_remoteEntitiesPendingCreation.find(entityId) == m_remoteEntitiesPendingCreation.end()))
+                        const bool isPendingCreation = (m_remoteEntitiesPendingCreation.find(entityId) != m_remoteEntitiesPendingCreation.end());
+                        if ((m_remoteEntitiesPendingCreation.size() + newPendingCreationCount >= m_maxRemoteEntitiesPendingCreationCount) && !isPendingCreation)
                         {
                             canSend = false; // don't send this
                             clearPendingSend = false;  // there might be outstanding data here, but we won't check, so we shouldn't clear it
                         }
+                        else if (!isPendingCreation && propPublisher->RequiresSerialization())
+                        {
+                            ++newPendingCreationCount;
+                        }
                     }
                     else
                     {
@@ -214,18 +230,13 @@ namespace Multiplayer
                     if (canSend && propPublisher->RequiresSerialization())
                     {
                         clearPendingSend = false;
-                        if (!propPublisher->IsRemoteReplicatorEstablished())
-                        {
-                            m_remoteEntitiesPendingCreation.insert(entityId);
-                        }
-
                         if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous)
                         {
                             toSendList.push_back(replicator);
                         }
                         else
                         {
-                            if (elementsAdded < m_replicationWindow->GetMaxEntityReplicatorSendCount())
+                            if (elementsAdded < maxElements)
                             {
                                 toSendList.push_back(replicator);
                             }
@@ -246,6 +257,27 @@ namespace Multiplayer
             }
         }
 
+        if (useBandwidthBudget)
+        {
+            m_updateScheduler.SelectUpdates
+            (
+                toSendList,
+                sv_ReplicationBandwidthBudgetBytes,
+                m_replicationWindow->GetMaxEntityReplicatorSendCount(),
+                sv_ReplicationMinPriority,
+                sv_ReplicationStalenessPriority
+            );
+        }
+
+        // Everything left in the list is sent this tick, replicators the budget left out don't hold a pending creation slot
+        for (EntityReplicator* replicator : toSendList)
+        {
+            if (!replicator->GetPropertyPublisher()->IsRemoteReplicatorEstablished())
+            {
+                m_remoteEntitiesPendingCreation.insert(replicator->GetEntityHandle().GetNetEntityId());
+            }
+        }
+
         return toSendList;
     }
 
@@ -262,10 +294,13 @@ namespace Multiplayer
         }
     
         // While our to send list is not empty, build up another packet to send
+        uint32_t sentBytes = 0;
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
+            sentBytes += SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
         } while (!toSendList.empty());
+
+        m_updateScheduler.OnUpdatesSent(sentBytes, sv_ReplicationBandwidthBudgetBytes);
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
@@ -942,7 +977,10 @@ namespace Multiplayer
             {
                 if (newWindowIter->first && (newWindowIter->first.GetNetEntityId() < currWindowIter->first))
                 {
-                    AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                    if (EntityReplicator* newReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                    {
+                        newReplicator->GetUpdatePriority().SetReplicationPriority(newWindowIter->second.m_priority);
+                    }
                     ++newWindowIter;
                 }
                 else if (newWindowIter->first.GetNetEntityId() > currWindowIter->first)
@@ -963,6 +1001,7 @@ namespace Multiplayer
                         currReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
                     }
                     currReplicator->ClearPendingRemoval();
+                    currReplicator->GetUpdatePriority().SetReplicationPriority(newWindowIter->second.m_priority);
                     ++newWindowIter;
                     ++currWindowIter;
                 }
@@ -971,7 +1010,10 @@ namespace Multiplayer
             // Do remaining adds
             while (newWindowIter != newWindow.end())
             {
-                AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole);
+                if (EntityReplicator* newReplicator = AddEntityReplicator(newWindowIter->first, newWindowIter->second.m_netEntityRole))
+                {
+                    newReplicator->GetUpdatePriority().SetReplicationPriority(newWindowIter->second.m_priority);
+                }
                 ++newWindowIter;
             }
 
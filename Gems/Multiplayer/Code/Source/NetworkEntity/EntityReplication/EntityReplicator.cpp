@@ -7,6 +7,7 @@
 
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Source/NetworkEntity/EntityReplication/EntityReplicationManager.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
 #include <Source/NetworkEntity/EntityReplication/PropertySubscriber.h>
 #include <Source/NetworkEntity/NetworkEntityAuthorityTracker.h>
@@ -31,6 +32,8 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR(bool, net_EntityUpdateSerializationCache, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Share serialized entity property updates between connections that are missing the same properties within a tick");
+
     EntityReplicator::EntityReplicator
     (
         EntityReplicationManager& replicationManager,
@@ -79,6 +82,8 @@ namespace Multiplayer
 
         m_wasMigrated = false;
 
+        m_updatePriority.Reset();
+
         m_onSendRpcHandler.Disconnect();
         m_onForwardRpcHandler.Disconnect();
         m_onSendAutonomousRpcHandler.Disconnect();
@@ -433,8 +438,9 @@ namespace Multiplayer
             updateMessage.SetPrefabEntityId(netBindComponent->GetPrefabEntityId());
         }
 
+        EntityUpdateSerializationCache* serializationCache = net_EntityUpdateSerializationCache ? GetEntityUpdateSerializationCache() : nullptr;
         AzNetworking::NetworkInputSerializer inputSerializer(updateMessage.ModifyData().GetBuffer(), updateMessage.ModifyData().GetCapacity());
-        m_propertyPublisher->UpdateSerialization(inputSerializer);
+        m_propertyPublisher->UpdateSerialization(inputSerializer, serializationCache);
         updateMessage.ModifyData().Resize(inputSerializer.GetSize());
 
         return updateMessage;
@@ -15,6 +15,7 @@
 #include <AzCore/std/containers/ring_buffer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h>
 
 namespace AzNetworking
 {
@@ -66,6 +67,10 @@ namespace Multiplayer
 
         AZ::TimeMs GetResendTimeoutTimeMs() const;
 
+        // Send scheduling state, used when the replication manager is limited to a bandwidth budget
+        EntityUpdatePriority& GetUpdatePriority();
+        const EntityUpdatePriority& GetUpdatePriority() const;
+
         PropertyPublisher* GetPropertyPublisher();
         const PropertyPublisher* GetPropertyPublisher() const;
         PropertySubscriber* GetPropertySubscriber();
@@ -132,6 +137,8 @@ namespace Multiplayer
         NetEntityRole m_boundLocalNetworkRole;
         NetEntityRole m_remoteNetworkRole;
 
+        EntityUpdatePriority m_updatePriority;
+
         bool m_wasMigrated = false;
         bool m_isForwardingRpc = false;
         bool m_prefabEntityIdSet = false;
@@ -50,6 +50,16 @@ namespace Multiplayer
         m_wasMigrated = wasMigrated;
     }
 
+    inline EntityUpdatePriority& EntityReplicator::GetUpdatePriority()
+    {
+        return m_updatePriority;
+    }
+
+    inline const EntityUpdatePriority& EntityReplicator::GetUpdatePriority() const
+    {
+        return m_updatePriority;
+    }
+
     inline PropertyPublisher* EntityReplicator::GetPropertyPublisher()
     {
         return m_propertyPublisher.get();
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! Size assumed for an entity update that has never been sent, any error is corrected through the budget debt.
+    constexpr uint32_t DefaultEntityUpdateSizeEstimate = 64;
+
+    //! @class EntityUpdatePriority
+    //! @brief The send scheduling state of a single entity replicator.
+    class EntityUpdatePriority
+    {
+    public:
+        EntityUpdatePriority() = default;
+
+        //! Sets the priority the replication window assigned to the entity.
+        //! @param replicationPriority the replication window priority, distance based for client windows
+        void SetReplicationPriority(float replicationPriority);
+
+        //! Adds one tick of waiting to the accumulated priority.
+        //! @param minPriority       the minimum priority accumulated per tick
+        //! @param stalenessPriority the priority added per tick the update has waited
+        //! @return the new accumulated priority
+        float Accumulate(float minPriority, float stalenessPriority);
+
+        //! Returns the priority accumulated since the last sent update.
+        //! @return the priority accumulated since the last sent update
+        float GetAccumulatedPriority() const;
+
+        //! Returns the expected size of the next update, the size of the last sent update if there is one.
+        //! @return the expected size of the next update in bytes
+        uint32_t GetEstimatedUpdateSize() const;
+
+        //! Resets the accumulated priority after an update was sent.
+        //! @param updateSize the size of the sent update in bytes
+        void OnUpdateSent(uint32_t updateSize);
+
+        //! Discards all the scheduling state except the replication window priority.
+        void Reset();
+
+    private:
+
+        float m_replicationPriority = 0.0f;
+        float m_accumulatedPriority = 0.0f;
+        uint32_t m_ticksSinceLastSent = 0;
+        uint32_t m_lastUpdateSize = 0;
+    };
+
+    //! @class EntityUpdateScheduler
+    //! @brief Chooses which pending entity updates a connection sends each tick when it is limited to a bandwidth budget.
+    //! Candidates are sent highest accumulated priority first until the budget is used. Autonomous entities are always
+    //! sent but count against the budget. Bytes sent over budget are carried into the next tick as debt.
+    //! REPLICATOR must provide GetRemoteNetworkRole() and GetUpdatePriority(), returning an EntityUpdatePriority.
+    template <typename REPLICATOR>
+    class EntityUpdateScheduler
+    {
+    public:
+        using ReplicatorList = AZStd::deque<REPLICATOR*>;
+
+        EntityUpdateScheduler() = default;
+
+        //! Removes every replicator from the list that doesn't fit in this tick's budget.
+        //! Replicators left out keep their accumulated priority, so they compete again next tick.
+        //! @param toSendList        the replicators with pending updates, replaced by the ones to send this tick
+        //! @param budgetBytes       the bytes of entity updates the connection may send per tick
+        //! @param maxSendCount      the maximum number of non autonomous replicators to send
+        //! @param minPriority       the minimum priority accumulated per tick
+        //! @param stalenessPriority the priority added per tick an update has waited
+        void SelectUpdates(ReplicatorList& toSendList, uint32_t budgetBytes, uint32_t maxSendCount, float minPriority, float stalenessPriority);
+
+        //! Carries any overspend into the next tick, capped at one tick's budget.
+        //! @param sentBytes   the bytes of entity updates actually sent this tick
+        //! @param budgetBytes the bytes of entity updates the connection may send per tick, 0 if there is no budget
+        void OnUpdatesSent(uint32_t sentBytes, uint32_t budgetBytes);
+
+        //! Returns the bytes sent over budget that the next tick pays back.
+        //! @return the bytes sent over budget that the next tick pays back
+        int64_t GetDebtBytes() const;
+
+    private:
+
+        //! Replicators competing for the bandwidth budget, kept around to avoid reallocating every tick
+        AZStd::vector<REPLICATOR*> m_candidates;
+        int64_t m_debtBytes = 0;
+    };
+}
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.inl>
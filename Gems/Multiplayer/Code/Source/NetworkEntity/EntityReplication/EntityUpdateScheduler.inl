@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    inline void EntityUpdatePriority::SetReplicationPriority(float replicationPriority)
+    {
+        m_replicationPriority = replicationPriority;
+    }
+
+    inline float EntityUpdatePriority::Accumulate(float minPriority, float stalenessPriority)
+    {
+        // The staleness term grows with every tick the update waits, so even the lowest priority entities are eventually sent
+        ++m_ticksSinceLastSent;
+        m_accumulatedPriority += AZStd::max(m_replicationPriority, minPriority) + stalenessPriority * aznumeric_cast<float>(m_ticksSinceLastSent);
+        return m_accumulatedPriority;
+    }
+
+    inline float EntityUpdatePriority::GetAccumulatedPriority() const
+    {
+        return m_accumulatedPriority;
+    }
+
+    inline uint32_t EntityUpdatePriority::GetEstimatedUpdateSize() const
+    {
+        return (m_lastUpdateSize > 0) ? m_lastUpdateSize : DefaultEntityUpdateSizeEstimate;
+    }
+
+    inline void EntityUpdatePriority::OnUpdateSent(uint32_t updateSize)
+    {
+        m_accumulatedPriority = 0.0f;
+        m_ticksSinceLastSent = 0;
+        m_lastUpdateSize = updateSize;
+    }
+
+    inline void EntityUpdatePriority::Reset()
+    {
+        m_accumulatedPriority = 0.0f;
+        m_ticksSinceLastSent = 0;
+        m_lastUpdateSize = 0;
+    }
+
+    template <typename REPLICATOR>
+    inline void EntityUpdateScheduler<REPLICATOR>::SelectUpdates(ReplicatorList& toSendList, uint32_t budgetBytes, uint32_t maxSendCount, float minPriority, float stalenessPriority)
+    {
+        // Bytes sent over budget last tick are paid back this tick, so the bandwidth used stays flat even when estimates are off
+        const int64_t availableBytes = static_cast<int64_t>(budgetBytes) - m_debtBytes;
+
+        ReplicatorList selectedList;
+        int64_t estimatedBytes = 0;
+        m_candidates.clear();
+        for (REPLICATOR* replicator : toSendList)
+        {
+            if (replicator->GetRemoteNetworkRole() == NetEntityRole::Autonomous)
+            {
+                // Autonomous entities are always sent, but still count against the budget
+                selectedList.push_back(replicator);
+                estimatedBytes += replicator->GetUpdatePriority().GetEstimatedUpdateSize();
+            }
+            else
+            {
+                replicator->GetUpdatePriority().Accumulate(minPriority, stalenessPriority);
+                m_candidates.push_back(replicator);
+            }
+        }
+
+        AZStd::sort(m_candidates.begin(), m_candidates.end(), [](const REPLICATOR* lhs, const REPLICATOR* rhs)
+        {
+            return lhs->GetUpdatePriority().GetAccumulatedPriority() > rhs->GetUpdatePriority().GetAccumulatedPriority();
+        });
+
+        uint32_t selectedCount = 0;
+        for (REPLICATOR* replicator : m_candidates)
+        {
+            const uint32_t estimatedSize = replicator->GetUpdatePriority().GetEstimatedUpdateSize();
+            const bool budgetReached = (estimatedBytes + estimatedSize > availableBytes) && !selectedList.empty();
+            if (budgetReached || (selectedCount >= maxSendCount))
+            {
+                break;
+            }
+            selectedList.push_back(replicator);
+            estimatedBytes += estimatedSize;
+            ++selectedCount;
+        }
+
+        toSendList.swap(selectedList);
+    }
+
+    template <typename REPLICATOR>
+    inline void EntityUpdateScheduler<REPLICATOR>::OnUpdatesSent(uint32_t sentBytes, uint32_t budgetBytes)
+    {
+        if (budgetBytes > 0)
+        {
+            // Cap the debt at one tick's budget so a single oversized update can't stall the connection for long
+            const int64_t budget = static_cast<int64_t>(budgetBytes);
+            m_debtBytes = AZStd::clamp<int64_t>(m_debtBytes + sentBytes - budget, 0, budget);
+        }
+        else
+        {
+            m_debtBytes = 0;
+        }
+    }
+
+    template <typename REPLICATOR>
+    inline int64_t EntityUpdateScheduler<REPLICATOR>::GetDebtBytes() const
+    {
+        return m_debtBytes;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+
+namespace Multiplayer
+{
+    bool EntityUpdateSerializationCache::SerializeUpdate
+    (
+        NetEntityId netEntityId,
+        NetBindComponent& netBindComponent,
+        ReplicationRecord& replicationRecord,
+        AzNetworking::NetworkInputSerializer& serializer
+    )
+    {
+        auto serializeStateDelta = [&netBindComponent](ReplicationRecord& record, AzNetworking::NetworkInputSerializer& stateDeltaSerializer)
+        {
+            netBindComponent.SerializeStateDeltaMessage(record, stateDeltaSerializer);
+        };
+        return SerializeUpdate(netEntityId, replicationRecord, serializer, GetMultiplayer()->GetStats(), serializeStateDelta);
+    }
+
+    bool EntityUpdateSerializationCache::SerializeUpdate
+    (
+        NetEntityId netEntityId,
+        ReplicationRecord& replicationRecord,
+        AzNetworking::NetworkInputSerializer& serializer,
+        MultiplayerStats& stats,
+        const SerializeStateDeltaFunction& serializeStateDelta
+    )
+    {
+        // The serialized record is the key, two connections that are missing the same set of properties share a state delta
+        const uint32_t recordStart = serializer.GetSize();
+        replicationRecord.ResetConsumedBits();
+        replicationRecord.Serialize(serializer);
+        if (!serializer.IsValid())
+        {
+            return false;
+        }
+
+        const uint8_t* recordBytes = serializer.GetBuffer() + recordStart;
+        const uint32_t recordSize = serializer.GetSize() - recordStart;
+        const NetEntityRole remoteNetworkRole = replicationRecord.GetRemoteNetworkRole();
+
+        AZStd::vector<CachedUpdate>& cachedUpdates = m_cachedUpdates[netEntityId];
+        for (const CachedUpdate& cachedUpdate : cachedUpdates)
+        {
+            if ((cachedUpdate.m_remoteNetworkRole == remoteNetworkRole)
+             && (cachedUpdate.m_recordBytes.size() == recordSize)
+             && (memcmp(cachedUpdate.m_recordBytes.data(), recordBytes, recordSize) == 0))
+            {
+                // Record the same property metrics the serialization would have, bandwidth is still spent once per connection
+                for (const MultiplayerStats::PropertySentSample& sample : cachedUpdate.m_propertySentSamples)
+                {
+                    stats.RecordPropertySent(sample.m_netComponentId, sample.m_propertyId, sample.m_totalBytes);
+                }
+                return serializer.CopyToBuffer(cachedUpdate.m_stateDeltaBytes.data(), aznumeric_cast<uint32_t>(cachedUpdate.m_stateDeltaBytes.size()));
+            }
+        }
+
+        CachedUpdate newUpdate;
+        newUpdate.m_remoteNetworkRole = remoteNetworkRole;
+        newUpdate.m_recordBytes.assign(recordBytes, recordBytes + recordSize);
+
+        const uint32_t stateDeltaStart = serializer.GetSize();
+        stats.m_propertySentCapture = &newUpdate.m_propertySentSamples;
+        serializeStateDelta(replicationRecord, serializer);
+        stats.m_propertySentCapture = nullptr;
+        if (!serializer.IsValid())
+        {
+            // Don't cache partial updates, the replicator will retry in a packet with more space
+            return false;
+        }
+
+        const uint8_t* stateDeltaBytes = serializer.GetBuffer() + stateDeltaStart;
+        newUpdate.m_stateDeltaBytes.assign(stateDeltaBytes, stateDeltaBytes + (serializer.GetSize() - stateDeltaStart));
+        cachedUpdates.emplace_back(AZStd::move(newUpdate));
+        return true;
+    }
+
+    void EntityUpdateSerializationCache::Clear()
+    {
+        m_cachedUpdates.clear();
+    }
+}
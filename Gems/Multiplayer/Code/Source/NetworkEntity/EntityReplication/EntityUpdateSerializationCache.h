@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace AzNetworking
+{
+    class NetworkInputSerializer;
+}
+
+namespace Multiplayer
+{
+    class NetBindComponent;
+    class ReplicationRecord;
+
+    //! @class EntityUpdateSerializationCache
+    //! @brief Shares serialized entity updates between all the connections sent to within a single tick.
+    //! Every connection serializes its own replication record for an entity, which is the set of properties the remote
+    //! endpoint has not acknowledged yet. Connections that are missing the same properties receive identical bytes, so
+    //! the first connection to serialize a record stores the state delta and every following connection copies it.
+    //! The cache must be cleared whenever network properties may have changed, in practice before and after each send pass.
+    class EntityUpdateSerializationCache
+    {
+    public:
+        //! Serializes the state delta described by a replication record, NetBindComponent::SerializeStateDeltaMessage in practice.
+        using SerializeStateDeltaFunction = AZStd::function<void(ReplicationRecord&, AzNetworking::NetworkInputSerializer&)>;
+
+        EntityUpdateSerializationCache() = default;
+
+        //! Serializes the replication record and state delta of an entity into the provided serializer.
+        //! If an identical record was already serialized for the same entity and remote role since the last Clear, the
+        //! cached state delta is copied instead and its property metrics are recorded again.
+        //! @param netEntityId       the network entity id of the entity being serialized
+        //! @param netBindComponent  the NetBindComponent of the entity being serialized
+        //! @param replicationRecord the replication record describing the properties to send
+        //! @param serializer        the serializer to write the record and state delta to
+        //! @return boolean true on success, false if the serializer ran out of space
+        bool SerializeUpdate
+        (
+            NetEntityId netEntityId,
+            NetBindComponent& netBindComponent,
+            ReplicationRecord& replicationRecord,
+            AzNetworking::NetworkInputSerializer& serializer
+        );
+
+        //! Serializes the replication record and state delta of an entity, using a caller provided state delta serializer.
+        //! @param netEntityId         the network entity id of the entity being serialized
+        //! @param replicationRecord   the replication record describing the properties to send
+        //! @param serializer          the serializer to write the record and state delta to
+        //! @param stats               the multiplayer stats to record property metrics to
+        //! @param serializeStateDelta the function that serializes the state delta on a cache miss
+        //! @return boolean true on success, false if the serializer ran out of space
+        bool SerializeUpdate
+        (
+            NetEntityId netEntityId,
+            ReplicationRecord& replicationRecord,
+            AzNetworking::NetworkInputSerializer& serializer,
+            MultiplayerStats& stats,
+            const SerializeStateDeltaFunction& serializeStateDelta
+        );
+
+        //! Discards all the cached updates.
+        void Clear();
+
+    private:
+
+        EntityUpdateSerializationCache& operator= (const EntityUpdateSerializationCache&) = delete;
+
+        struct CachedUpdate final
+        {
+            NetEntityRole m_remoteNetworkRole = NetEntityRole::InvalidRole;
+            AZStd::vector<uint8_t> m_recordBytes;
+            AZStd::vector<uint8_t> m_stateDeltaBytes;
+            MultiplayerStats::PropertySentSamples m_propertySentSamples;
+        };
+
+        using CachedUpdateMap = AZStd::unordered_map<NetEntityId, AZStd::vector<CachedUpdate>>;
+
+        CachedUpdateMap m_cachedUpdates;
+    };
+}
@@ -6,6 +6,8 @@
  */
 
 #include <Source/NetworkEntity/EntityReplication/PropertyPublisher.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
@@ -158,9 +160,13 @@ namespace Multiplayer
         return !IsDeleted();
     }
 
-    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::ISerializer &serializer)
+    bool PropertyPublisher::SerializeUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer, EntityUpdateSerializationCache* serializationCache)
     {
         AZ_Assert(m_netBindComponent, "NetBindComponent is nullptr");
+        if (serializationCache != nullptr)
+        {
+            return serializationCache->SerializeUpdate(m_netBindComponent->GetNetEntityId(), *m_netBindComponent, m_pendingRecord, serializer);
+        }
         m_pendingRecord.ResetConsumedBits();
         m_pendingRecord.Serialize(serializer);
         m_netBindComponent->SerializeStateDeltaMessage(m_pendingRecord, serializer);
@@ -276,7 +282,7 @@ namespace Multiplayer
     }
 
 
-    bool PropertyPublisher::UpdateSerialization(AzNetworking::ISerializer& serializer)
+    bool PropertyPublisher::UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer, EntityUpdateSerializationCache* serializationCache)
     {
         bool success(true);
         switch (m_replicatorState)
@@ -288,7 +294,7 @@ namespace Multiplayer
         case PropertyPublisher::EntityReplicatorState::Updating:
         {
             AZ_Assert(m_serializationPhase == PropertyPublisher::EntityReplicatorSerializationPhase::Prepared, "Unexpected serialization phase");
-            success = SerializeUpdateEntityRecord(serializer);
+            success = SerializeUpdateEntityRecord(serializer, serializationCache);
         }
         break;
         case PropertyPublisher::EntityReplicatorState::Deleting:
@@ -13,10 +13,13 @@
 namespace AzNetworking
 {
     class IConnection;
+    class NetworkInputSerializer;
 }
 
 namespace Multiplayer
 {
+    class EntityUpdateSerializationCache;
+
     class PropertyPublisher
     {
     public:
@@ -42,7 +45,8 @@ namespace Multiplayer
         //! @{
         bool RequiresSerialization();
         bool PrepareSerialization();
-        bool UpdateSerialization(AzNetworking::ISerializer& serializer);
+        //! @param serializationCache optional cache used to share serialized updates with other connections this tick
+        bool UpdateSerialization(AzNetworking::NetworkInputSerializer& serializer, EntityUpdateSerializationCache* serializationCache = nullptr);
         void FinalizeSerialization(AzNetworking::PacketId sentId);
         //! @}
 
@@ -75,7 +79,7 @@ namespace Multiplayer
 
         //! Phase 2, serialize the record
         //! No add, they share the update path
-        bool SerializeUpdateEntityRecord(AzNetworking::ISerializer& serializer);
+        bool SerializeUpdateEntityRecord(AzNetworking::NetworkInputSerializer& serializer, EntityUpdateSerializationCache* serializationCache);
         bool SerializeDeleteEntityRecord(AzNetworking::ISerializer& serializer);
 
         //! Phase 3, finalize with the packet id
@@ -62,6 +62,11 @@ namespace Multiplayer
         return &m_multiplayerComponentRegistry;
     }
 
+    EntityUpdateSerializationCache* NetworkEntityManager::GetEntityUpdateSerializationCache()
+    {
+        return &m_entityUpdateSerializationCache;
+    }
+
     HostId NetworkEntityManager::GetHostId() const
     {
         return m_hostId;
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/std/math.h>
+
+namespace Multiplayer
+{
+    bool InterestGrid::PrioritizedEntry::operator >(const PrioritizedEntry& rhs) const
+    {
+        return m_priority > rhs.m_priority;
+    }
+
+    size_t InterestGrid::CellKeyHash::operator()(CellKey cellKey) const
+    {
+        // Neighbouring cells only differ in their low bits, mix them so they spread across buckets
+        cellKey ^= cellKey >> 33;
+        cellKey *= 0xff51afd7ed558ccdull;
+        cellKey ^= cellKey >> 33;
+        return static_cast<size_t>(cellKey);
+    }
+
+    InterestGrid::InterestGrid(float cellSize)
+        : m_cellSize(AZStd::max(cellSize, 1.0f))
+        , m_inverseCellSize(1.0f / m_cellSize)
+    {
+        ;
+    }
+
+    float InterestGrid::GetCellSize() const
+    {
+        return m_cellSize;
+    }
+
+    uint32_t InterestGrid::GetEntityCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_locations.size());
+    }
+
+    InterestGrid::CellKey InterestGrid::GetCellKey(const AZ::Vector3& position) const
+    {
+        return MakeCellKey(GetCellCoordinate(position.GetX()), GetCellCoordinate(position.GetY()));
+    }
+
+    void InterestGrid::AddEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        if (m_locations.find(netEntityId) != m_locations.end())
+        {
+            MoveEntity(netEntityId, position);
+            return;
+        }
+
+        InsertIntoCell(netEntityId, position, GetCellKey(position));
+        ClearQueryCache();
+    }
+
+    void InterestGrid::MoveEntity(NetEntityId netEntityId, const AZ::Vector3& position)
+    {
+        auto locationIter = m_locations.find(netEntityId);
+        if (locationIter == m_locations.end())
+        {
+            return;
+        }
+
+        const CellKey cellKey = GetCellKey(position);
+        const EntityLocation location = locationIter->second;
+        if (location.m_cellKey == cellKey)
+        {
+            m_cells[cellKey][location.m_index].m_position = position;
+        }
+        else
+        {
+            RemoveFromCell(location);
+            InsertIntoCell(netEntityId, position, cellKey);
+        }
+        ClearQueryCache();
+    }
+
+    void InterestGrid::RemoveEntity(NetEntityId netEntityId)
+    {
+        auto locationIter = m_locations.find(netEntityId);
+        if (locationIter == m_locations.end())
+        {
+            return;
+        }
+
+        RemoveFromCell(locationIter->second);
+        m_locations.erase(netEntityId);
+        ClearQueryCache();
+    }
+
+    const InterestGrid::EntryList& InterestGrid::Query(const AZ::Vector3& position, float radius)
+    {
+        const int32_t centerX = GetCellCoordinate(position.GetX());
+        const int32_t centerY = GetCellCoordinate(position.GetY());
+
+        CachedQuery& cachedQuery = m_queryCache[MakeCellKey(centerX, centerY)];
+        if ((cachedQuery.m_radius == radius) && (radius > 0.0f))
+        {
+            return cachedQuery.m_entries;
+        }
+
+        // The query position can be anywhere within the center cell, so cover every cell within radius of any point in it
+        const int32_t cellRadius = aznumeric_cast<int32_t>(AZStd::ceil(radius * m_inverseCellSize));
+        cachedQuery.m_radius = radius;
+        cachedQuery.m_entries.clear();
+        for (int32_t y = centerY - cellRadius; y <= centerY + cellRadius; ++y)
+        {
+            for (int32_t x = centerX - cellRadius; x <= centerX + cellRadius; ++x)
+            {
+                auto cellIter = m_cells.find(MakeCellKey(x, y));
+                if (cellIter != m_cells.end())
+                {
+                    cachedQuery.m_entries.insert(cachedQuery.m_entries.end(), cellIter->second.begin(), cellIter->second.end());
+                }
+            }
+        }
+        return cachedQuery.m_entries;
+    }
+
+    void InterestGrid::GatherPrioritized(const AZ::Vector3& position, float radius, PrioritizedEntryList& outPrioritizedEntries)
+    {
+        const EntryList& entries = Query(position, radius);
+        const float radiusSquared = radius * radius;
+
+        outPrioritizedEntries.clear();
+        outPrioritizedEntries.reserve(entries.size());
+        for (const Entry& entry : entries)
+        {
+            const float distanceSquared = position.GetDistanceSq(entry.m_position);
+            if (distanceSquared < radiusSquared)
+            {
+                const float priority = (distanceSquared > 0.0f) ? 1.0f / distanceSquared : 0.0f;
+                outPrioritizedEntries.push_back(PrioritizedEntry{ entry.m_netEntityId, priority });
+            }
+        }
+    }
+
+    void InterestGrid::ClearQueryCache()
+    {
+        if (!m_queryCache.empty())
+        {
+            m_queryCache.clear();
+        }
+    }
+
+    int32_t InterestGrid::GetCellCoordinate(float value) const
+    {
+        return aznumeric_cast<int32_t>(AZStd::floor(value * m_inverseCellSize));
+    }
+
+    InterestGrid::CellKey InterestGrid::MakeCellKey(int32_t x, int32_t y)
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+
+    void InterestGrid::InsertIntoCell(NetEntityId netEntityId, const AZ::Vector3& position, CellKey cellKey)
+    {
+        EntryList& cell = m_cells[cellKey];
+        m_locations[netEntityId] = EntityLocation{ cellKey, aznumeric_cast<uint32_t>(cell.size()) };
+        cell.push_back(Entry{ netEntityId, position });
+    }
+
+    void InterestGrid::RemoveFromCell(const EntityLocation& location)
+    {
+        auto cellIter = m_cells.find(location.m_cellKey);
+        AZ_Assert(cellIter != m_cells.end(), "Entity location refers to a missing interest grid cell");
+        EntryList& cell = cellIter->second;
+
+        // Swap the last entry into the removed slot so removal stays constant time
+        if (location.m_index + 1 < cell.size())
+        {
+            cell[location.m_index] = cell.back();
+            m_locations[cell[location.m_index].m_netEntityId].m_index = location.m_index;
+        }
+        cell.pop_back();
+
+        if (cell.empty())
+        {
+            m_cells.erase(cellIter);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    //! @class InterestGrid
+    //! @brief A uniform spatial hash of networked entity positions used for server to client interest management.
+    //! The grid is two dimensional, each cell is a column of cellSize by cellSize units on the X and Y axes.
+    //! Entities are moved between cells incrementally as they move, and queries made from the same cell with the same
+    //! radius share their results until the grid next changes.
+    class InterestGrid
+    {
+    public:
+        using CellKey = uint64_t;
+
+        struct Entry
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        };
+        using EntryList = AZStd::vector<Entry>;
+
+        struct PrioritizedEntry
+        {
+            NetEntityId m_netEntityId = InvalidNetEntityId;
+            float m_priority = 0.0f;
+            bool operator >(const PrioritizedEntry& rhs) const;
+        };
+        using PrioritizedEntryList = AZStd::vector<PrioritizedEntry>;
+
+        explicit InterestGrid(float cellSize);
+
+        //! Returns the edge length of each cell.
+        //! @return the edge length of each cell
+        float GetCellSize() const;
+
+        //! Returns the number of entities tracked by the grid.
+        //! @return the number of entities tracked by the grid
+        uint32_t GetEntityCount() const;
+
+        //! Returns the key of the cell containing the provided position.
+        //! @param position the position to look up
+        //! @return the key of the cell containing the provided position
+        CellKey GetCellKey(const AZ::Vector3& position) const;
+
+        //! Adds an entity to the grid, or moves it if it is already tracked.
+        //! @param netEntityId the network entity id of the entity to add
+        //! @param position    the world position of the entity
+        void AddEntity(NetEntityId netEntityId, const AZ::Vector3& position);
+
+        //! Updates the position of an entity, only touching the cell lists if the entity changed cells.
+        //! @param netEntityId the network entity id of the entity that moved
+        //! @param position    the new world position of the entity
+        void MoveEntity(NetEntityId netEntityId, const AZ::Vector3& position);
+
+        //! Removes an entity from the grid.
+        //! @param netEntityId the network entity id of the entity to remove
+        void RemoveEntity(NetEntityId netEntityId);
+
+        //! Returns every entity in the cells that can overlap a sphere of the provided radius centered anywhere in the cell containing position.
+        //! The result is cached and shared by every query made from the same cell with the same radius until the grid changes.
+        //! @param position the center of the query
+        //! @param radius   the radius of the query
+        //! @return the entities in the overlapped cells, which may include entities slightly further away than radius
+        const EntryList& Query(const AZ::Vector3& position, float radius);
+
+        //! Gathers the entities within radius of position and computes their priority relative to position.
+        //! Priority is the inverse of the squared distance, the list is not sorted.
+        //! @param position          the center of the query
+        //! @param radius            the radius of the query
+        //! @param outPrioritizedEntries receives the entities within radius of position and their priorities
+        void GatherPrioritized(const AZ::Vector3& position, float radius, PrioritizedEntryList& outPrioritizedEntries);
+
+        //! Discards all cached query results.
+        void ClearQueryCache();
+
+    private:
+
+        InterestGrid& operator= (const InterestGrid&) = delete;
+
+        struct CellKeyHash
+        {
+            size_t operator()(CellKey cellKey) const;
+        };
+
+        struct EntityLocation
+        {
+            CellKey m_cellKey = 0;
+            uint32_t m_index = 0;
+        };
+
+        struct CachedQuery
+        {
+            float m_radius = 0.0f;
+            EntryList m_entries;
+        };
+
+        int32_t GetCellCoordinate(float value) const;
+        static CellKey MakeCellKey(int32_t x, int32_t y);
+        void InsertIntoCell(NetEntityId netEntityId, const AZ::Vector3& position, CellKey cellKey);
+        void RemoveFromCell(const EntityLocation& location);
+
+        using CellMap = AZStd::unordered_map<CellKey, EntryList, CellKeyHash>;
+        using LocationMap = AZStd::unordered_map<NetEntityId, EntityLocation>;
+        using QueryCache = AZStd::unordered_map<CellKey, CachedQuery, CellKeyHash>;
+
+        CellMap m_cells;
+        LocationMap m_locations;
+        QueryCache m_queryCache;
+        float m_cellSize = 1.0f;
+        float m_inverseCellSize = 1.0f;
+    };
+}
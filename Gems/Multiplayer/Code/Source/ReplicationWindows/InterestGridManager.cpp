@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGridManager.h>
+#include <Source/ReplicationWindows/InterestGridReplicationWindow.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_InterestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The edge length of each interest grid cell, only applied when the grid is created");
+    AZ_CVAR(AZ::TimeMs, sv_InterestGridUpdateMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Rate at which a slice of the interest grid replication windows is updated");
+
+    InterestGridManager::InterestGridManager()
+        : m_grid(sv_InterestGridCellSize)
+        , m_entityActivatedEventHandler([this](AZ::Entity* entity) { OnEntityActivated(entity); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity* entity) { OnEntityDeactivated(entity); })
+        , m_updateWindowsEvent([this]() { UpdateWindows(); }, AZ::Name("Interest grid replication window update event"))
+    {
+        // Pick up any networked entities that were activated before the grid was created
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (networkEntityTracker != nullptr)
+        {
+            for (auto& entry : *networkEntityTracker)
+            {
+                if ((entry.second != nullptr) && (entry.second->GetState() == AZ::Entity::State::Active))
+                {
+                    TrackEntity(entry.second);
+                }
+            }
+        }
+
+        AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+        AZ::Interface<AZ::ComponentApplicationRequests>::Get()->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        m_updateWindowsEvent.Enqueue(sv_InterestGridUpdateMs, true);
+    }
+
+    InterestGridManager::~InterestGridManager()
+    {
+        AZ_Assert(m_windows.empty(), "Interest grid replication windows must be destroyed before the InterestGridManager");
+    }
+
+    InterestGrid& InterestGridManager::GetGrid()
+    {
+        return m_grid;
+    }
+
+    void InterestGridManager::RegisterWindow(InterestGridReplicationWindow* window)
+    {
+        m_windows.push_back(window);
+    }
+
+    void InterestGridManager::UnregisterWindow(InterestGridReplicationWindow* window)
+    {
+        auto iter = AZStd::find(m_windows.begin(), m_windows.end(), window);
+        if (iter != m_windows.end())
+        {
+            *iter = m_windows.back();
+            m_windows.pop_back();
+        }
+    }
+
+    void InterestGridManager::OnEntityActivated(AZ::Entity* entity)
+    {
+        TrackEntity(entity);
+
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        if ((netBindComponent != nullptr) && netBindComponent->HasController() && (entity->GetTransform() != nullptr))
+        {
+            const ConstNetworkEntityHandle entityHandle(netBindComponent, GetNetworkEntityTracker());
+            const AZ::Vector3 position = entity->GetTransform()->GetWorldTranslation();
+            for (InterestGridReplicationWindow* window : m_windows)
+            {
+                window->OnEntityActivated(entityHandle, position);
+            }
+        }
+    }
+
+    void InterestGridManager::OnEntityDeactivated(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        if (netBindComponent != nullptr)
+        {
+            const NetEntityId netEntityId = netBindComponent->GetNetEntityId();
+            m_grid.RemoveEntity(netEntityId);
+            m_transformChangedHandlers.erase(netEntityId);
+
+            const ConstNetworkEntityHandle entityHandle(netBindComponent, GetNetworkEntityTracker());
+            for (InterestGridReplicationWindow* window : m_windows)
+            {
+                window->OnEntityDeactivated(entityHandle);
+            }
+        }
+    }
+
+    void InterestGridManager::TrackEntity(AZ::Entity* entity)
+    {
+        NetBindComponent* netBindComponent = entity->FindComponent<NetBindComponent>();
+        AZ::TransformInterface* transformInterface = entity->GetTransform();
+        if ((netBindComponent == nullptr) || (transformInterface == nullptr) || (netBindComponent->GetNetEntityId() == InvalidNetEntityId))
+        {
+            return;
+        }
+
+        const NetEntityId netEntityId = netBindComponent->GetNetEntityId();
+        m_grid.AddEntity(netEntityId, transformInterface->GetWorldTranslation());
+
+        // Unordered map nodes never move, so the handler can stay connected while other entities are added and removed
+        AZ::TransformChangedEvent::Handler& handler = m_transformChangedHandlers[netEntityId];
+        handler = AZ::TransformChangedEvent::Handler([this, netEntityId](const AZ::Transform&, const AZ::Transform& worldTransform)
+        {
+            m_grid.MoveEntity(netEntityId, worldTransform.GetTranslation());
+        });
+        transformInterface->BindTransformChangedEventHandler(handler);
+    }
+
+    void InterestGridManager::UpdateWindows()
+    {
+        // Spread the windows across enough passes that each one is still refreshed every sv_ClientReplicationWindowUpdateMs
+        const int64_t windowUpdateMs = static_cast<int64_t>(static_cast<AZ::TimeMs>(sv_ClientReplicationWindowUpdateMs));
+        const int64_t gridUpdateMs = static_cast<int64_t>(static_cast<AZ::TimeMs>(sv_InterestGridUpdateMs));
+        const uint64_t sliceCount = (gridUpdateMs > 0) ? static_cast<uint64_t>(AZStd::max<int64_t>(windowUpdateMs / gridUpdateMs, 1)) : 1;
+        m_updateSlice = aznumeric_cast<uint32_t>((m_updateSlice + 1) % sliceCount);
+
+        // Nothing moves while the windows update, so windows in the same cell reuse the same query
+        m_grid.ClearQueryCache();
+        for (InterestGridReplicationWindow* window : m_windows)
+        {
+            AZ::Vector3 position;
+            const InterestGrid::CellKey cellKey = window->GetControlledEntityPosition(position) ? m_grid.GetCellKey(position) : 0;
+            if ((cellKey % sliceCount) == m_updateSlice)
+            {
+                window->UpdateWindow();
+            }
+        }
+    }
+}
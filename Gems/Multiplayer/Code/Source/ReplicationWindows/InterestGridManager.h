@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/EBus/ScheduledEvent.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace Multiplayer
+{
+    class InterestGridReplicationWindow;
+
+    //! @class InterestGridManager
+    //! @brief Keeps the InterestGrid up to date with networked entities and updates every InterestGridReplicationWindow.
+    //! Entities are added when they activate and moved when their transform changes, so only entities that actually move
+    //! touch the grid. Windows are updated in slices, all the windows in the same cell fall into the same slice so they
+    //! share their grid query, and each window is still refreshed every sv_ClientReplicationWindowUpdateMs.
+    class InterestGridManager
+    {
+    public:
+        InterestGridManager();
+        ~InterestGridManager();
+
+        //! Returns the grid of networked entities.
+        //! @return the grid of networked entities
+        InterestGrid& GetGrid();
+
+        //! Registers a window to be updated by this manager.
+        //! @param window the window to register
+        void RegisterWindow(InterestGridReplicationWindow* window);
+
+        //! Unregisters a window previously registered with RegisterWindow.
+        //! @param window the window to unregister
+        void UnregisterWindow(InterestGridReplicationWindow* window);
+
+    private:
+        void OnEntityActivated(AZ::Entity* entity);
+        void OnEntityDeactivated(AZ::Entity* entity);
+        void TrackEntity(AZ::Entity* entity);
+        void UpdateWindows();
+
+        InterestGridManager& operator=(const InterestGridManager&) = delete;
+
+        using TransformChangedHandlerMap = AZStd::unordered_map<NetEntityId, AZ::TransformChangedEvent::Handler>;
+
+        InterestGrid m_grid;
+        TransformChangedHandlerMap m_transformChangedHandlers;
+        AZStd::vector<InterestGridReplicationWindow*> m_windows;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+        AZ::ScheduledEvent m_updateWindowsEvent;
+        uint32_t m_updateSlice = 0;
+    };
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGridReplicationWindow.h>
+#include <Source/ReplicationWindows/InterestGridManager.h>
+#include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+namespace Multiplayer
+{
+    InterestGridReplicationWindow::InterestGridReplicationWindow
+    (
+        InterestGridManager& interestGridManager,
+        NetworkEntityHandle controlledEntity,
+        const AzNetworking::IConnection* connection
+    )
+        : m_interestGridManager(interestGridManager)
+        , m_controlledEntity(controlledEntity)
+        , m_connection(connection)
+        , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
+        , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
+    {
+        AZ_Assert(m_controlledEntity.GetEntity() && m_controlledEntity.GetEntity()->GetTransform(), "Controlled player entity must have a transform");
+        m_interestGridManager.RegisterWindow(this);
+    }
+
+    InterestGridReplicationWindow::~InterestGridReplicationWindow()
+    {
+        m_interestGridManager.UnregisterWindow(this);
+    }
+
+    bool InterestGridReplicationWindow::ReplicationSetUpdateReady()
+    {
+        // if we don't have a controlled entity anymore, don't send updates (validate this)
+        if (!m_controlledEntity.Exists())
+        {
+            m_replicationSet.clear();
+        }
+        return true;
+    }
+
+    const ReplicationSet& InterestGridReplicationWindow::GetReplicationSet() const
+    {
+        return m_replicationSet;
+    }
+
+    uint32_t InterestGridReplicationWindow::GetMaxEntityReplicatorSendCount() const
+    {
+        return m_isPoorConnection ? sv_MinEntitiesToReplicate : sv_MaxEntitiesToReplicate;
+    }
+
+    bool InterestGridReplicationWindow::IsInWindow(const ConstNetworkEntityHandle& entityHandle, NetEntityRole& outNetworkRole) const
+    {
+        AZ_Assert(false, "IsInWindow should not be called on the InterestGridReplicationWindow");
+        outNetworkRole = NetEntityRole::InvalidRole;
+        auto iter = m_replicationSet.find(entityHandle);
+        if (iter != m_replicationSet.end())
+        {
+            outNetworkRole = iter->second.m_netEntityRole;
+            return true;
+        }
+        return false;
+    }
+
+    void InterestGridReplicationWindow::UpdateWindow()
+    {
+        m_replicationSet.clear();
+
+        NetBindComponent* netBindComponent = m_controlledEntity.GetNetBindComponent();
+        if (!netBindComponent || !netBindComponent->HasController())
+        {
+            // if we don't have a controlled entity, or we no longer have control of the entity, don't run the update
+            return;
+        }
+
+        EvaluateConnection();
+
+        const AZ::Vector3 controlledEntityPosition = m_controlledEntity.GetEntity()->GetTransform()->GetWorldTranslation();
+        m_interestGridManager.GetGrid().GatherPrioritized(controlledEntityPosition, sv_ClientAwarenessRadius, m_candidates);
+
+        // Only the best candidates need to be ordered, the rest are sorted lazily if filtering rejects some of them
+        const size_t maxCandidates = aznumeric_cast<size_t>(static_cast<uint32_t>(sv_MaxEntitiesToTrackReplication));
+        size_t sortedCount = AZStd::min(maxCandidates, m_candidates.size());
+        AZStd::partial_sort(m_candidates.begin(), m_candidates.begin() + sortedCount, m_candidates.end(), AZStd::greater<InterestGrid::PrioritizedEntry>());
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        size_t acceptedCount = 0;
+        for (size_t index = 0; (index < m_candidates.size()) && (acceptedCount < maxCandidates); ++index)
+        {
+            if (index == sortedCount)
+            {
+                AZStd::sort(m_candidates.begin() + index, m_candidates.end(), AZStd::greater<InterestGrid::PrioritizedEntry>());
+                sortedCount = m_candidates.size();
+            }
+
+            const InterestGrid::PrioritizedEntry& candidate = m_candidates[index];
+            ConstNetworkEntityHandle entityHandle = networkEntityTracker->Get(candidate.m_netEntityId);
+            if (IsEntityReplicable(entityHandle))
+            {
+                m_replicationSet[entityHandle] = { NetEntityRole::Client, candidate.m_priority };
+                ++acceptedCount;
+            }
+        }
+
+        // Add in Autonomous Entities
+        // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
+        m_replicationSet[m_controlledEntity] = { NetEntityRole::Autonomous, 1.0f };  // Always replicate autonomous entities
+    }
+
+    void InterestGridReplicationWindow::DebugDraw() const
+    {
+        ;
+    }
+
+    bool InterestGridReplicationWindow::GetControlledEntityPosition(AZ::Vector3& outPosition) const
+    {
+        const AZ::Entity* entity = m_controlledEntity.GetEntity();
+        if (entity == nullptr || entity->GetTransform() == nullptr)
+        {
+            return false;
+        }
+        outPosition = entity->GetTransform()->GetWorldTranslation();
+        return true;
+    }
+
+    void InterestGridReplicationWindow::OnEntityActivated(const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position)
+    {
+        AZ::Vector3 clientPosition;
+        if (!GetControlledEntityPosition(clientPosition))
+        {
+            return;
+        }
+
+        // Make sure we would be in the awareness radius
+        const float distSq = clientPosition.GetDistanceSq(position);
+        const float awarenessSq = sv_ClientAwarenessRadius * sv_ClientAwarenessRadius;
+        if ((distSq < awarenessSq) && (m_replicationSet.find(entityHandle) == m_replicationSet.end()) && IsEntityReplicable(entityHandle))
+        {
+            m_replicationSet[entityHandle] = { NetEntityRole::Client, 1.0f };
+        }
+    }
+
+    void InterestGridReplicationWindow::OnEntityDeactivated(const ConstNetworkEntityHandle& entityHandle)
+    {
+        m_replicationSet.erase(entityHandle);
+    }
+
+    void InterestGridReplicationWindow::EvaluateConnection()
+    {
+        const uint32_t newPacketsSent = m_connection->GetMetrics().m_packetsSent;
+        const uint32_t packetSentDelta = newPacketsSent - m_lastCheckedSentPackets;
+
+        if (packetSentDelta > sv_PacketsToIntegrateQos) // Just some threshold for having enough samples
+        {
+            const uint32_t newPacketsLost = m_connection->GetMetrics().m_packetsLost;
+            const uint32_t packetLostDelta = newPacketsLost - m_lastCheckedLostPackets;
+            const float packetLostPercent = float(packetLostDelta) / float(packetSentDelta);
+            const bool isPoorConnection = (packetLostPercent > sv_BadConnectionThreshold);
+            if (isPoorConnection != m_isPoorConnection)
+            {
+                m_isPoorConnection = isPoorConnection;
+                AZLOG_INFO
+                (
+                    "Connection# %u with entity %u quality state changed status from %s to %s",
+                    static_cast<uint32_t>(m_connection->GetConnectionId()),
+                    static_cast<uint32_t>(m_controlledEntity.GetNetEntityId()),
+                    GetConnectionStateString(!m_isPoorConnection),
+                    GetConnectionStateString(m_isPoorConnection)
+                );
+            }
+
+            m_lastCheckedSentPackets = newPacketsSent;
+            m_lastCheckedLostPackets = newPacketsLost;
+        }
+    }
+
+    bool InterestGridReplicationWindow::IsEntityReplicable(ConstNetworkEntityHandle entityHandle) const
+    {
+        const NetBindComponent* netBindComponent = entityHandle.GetNetBindComponent();
+        if ((netBindComponent == nullptr) || (entityHandle == m_controlledEntity))
+        {
+            return false;
+        }
+
+        if (!sv_ReplicateServerProxies && (netBindComponent->GetNetEntityRole() == NetEntityRole::Server))
+        {
+            // Proxy replication disabled
+            return false;
+        }
+
+        IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
+        if (filterEntityManager && filterEntityManager->IsEntityFiltered(entityHandle.GetEntity(), m_controlledEntity, m_connection->GetConnectionId()))
+        {
+            return false;
+        }
+        return true;
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <Multiplayer/IMultiplayer.h>
+#include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
+#include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+
+namespace Multiplayer
+{
+    class InterestGridManager;
+
+    //! @class InterestGridReplicationWindow
+    //! @brief A server to client replication window that gathers relevant entities from the shared InterestGrid.
+    //! Windows are updated by the InterestGridManager rather than on their own schedule, so all the windows in the same
+    //! cell are updated together and share a single grid query.
+    class InterestGridReplicationWindow
+        : public IReplicationWindow
+    {
+    public:
+        InterestGridReplicationWindow(InterestGridManager& interestGridManager, NetworkEntityHandle controlledEntity, const AzNetworking::IConnection* connection);
+        ~InterestGridReplicationWindow() override;
+
+        //! IReplicationWindow interface
+        //! @{
+        bool ReplicationSetUpdateReady() override;
+        const ReplicationSet& GetReplicationSet() const override;
+        uint32_t GetMaxEntityReplicatorSendCount() const override;
+        bool IsInWindow(const ConstNetworkEntityHandle& entityPtr, NetEntityRole& outNetworkRole) const override;
+        void UpdateWindow() override;
+        void DebugDraw() const override;
+        //! @}
+
+        //! Returns the position of the controlled entity, used by the InterestGridManager to group windows by cell.
+        //! @param outPosition receives the world position of the controlled entity
+        //! @return boolean true if the controlled entity exists, false otherwise
+        bool GetControlledEntityPosition(AZ::Vector3& outPosition) const;
+
+        //! Invoked by the InterestGridManager when a networked entity with a controller activates.
+        //! @param entityHandle the handle of the activated entity
+        //! @param position     the world position of the activated entity
+        void OnEntityActivated(const ConstNetworkEntityHandle& entityHandle, const AZ::Vector3& position);
+
+        //! Invoked by the InterestGridManager when a networked entity deactivates.
+        //! @param entityHandle the handle of the deactivated entity
+        void OnEntityDeactivated(const ConstNetworkEntityHandle& entityHandle);
+
+    private:
+        void EvaluateConnection();
+        bool IsEntityReplicable(ConstNetworkEntityHandle entityHandle) const;
+
+        InterestGridReplicationWindow& operator=(const InterestGridReplicationWindow&) = delete;
+
+        InterestGridManager& m_interestGridManager;
+        ReplicationSet m_replicationSet;
+
+        // Scratch storage reused across updates
+        InterestGrid::PrioritizedEntryList m_candidates;
+
+        NetworkEntityHandle m_controlledEntity;
+        const AzNetworking::IConnection* m_connection = nullptr;
+
+        // Cached values to detect a poor network connection
+        uint32_t m_lastCheckedSentPackets = 0;
+        uint32_t m_lastCheckedLostPackets = 0;
+        bool     m_isPoorConnection = true;
+    };
+}
@@ -18,6 +18,18 @@
 
 namespace Multiplayer
 {
+    AZ_CVAR_EXTERNED(bool, sv_ReplicateServerProxies);
+    AZ_CVAR_EXTERNED(uint32_t, sv_MaxEntitiesToTrackReplication);
+    AZ_CVAR_EXTERNED(uint32_t, sv_MinEntitiesToReplicate);
+    AZ_CVAR_EXTERNED(uint32_t, sv_MaxEntitiesToReplicate);
+    AZ_CVAR_EXTERNED(uint32_t, sv_PacketsToIntegrateQos);
+    AZ_CVAR_EXTERNED(float, sv_BadConnectionThreshold);
+    AZ_CVAR_EXTERNED(AZ::TimeMs, sv_ClientReplicationWindowUpdateMs);
+    AZ_CVAR_EXTERNED(float, sv_ClientAwarenessRadius);
+
+    //! Returns a printable description of a connection quality state.
+    const char* GetConnectionStateString(bool isPoor);
+
     class NetSystemComponent;
 
     class ServerToClientReplicationWindow
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzNetworking/Serialization/TrackChangedSerializer.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/Components/MultiplayerComponent.h>
+#include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <MultiplayerSystemComponent.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class BitPackedNetworkPropertyTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+        }
+
+        void TearDown() override
+        {
+            TeardownAllocator();
+        }
+
+        // Writes a value through SerializeBitPackedNetworkProperty, reads it back into outValue and returns the stream size
+        template <typename TYPE>
+        uint32_t RoundTrip(TYPE inValue, TYPE& outValue, const AzNetworking::QuantizationSettings& settings)
+        {
+            AzNetworking::NetworkInputSerializer inSerializer(m_buffer, sizeof(m_buffer));
+            SerializeBitPackedNetworkProperty(inSerializer, inValue, "Value", settings);
+            EXPECT_TRUE(inSerializer.IsValid());
+
+            AzNetworking::NetworkOutputSerializer outSerializer(m_buffer, inSerializer.GetSize());
+            SerializeBitPackedNetworkProperty(outSerializer, outValue, "Value", settings);
+            EXPECT_TRUE(outSerializer.IsValid());
+            return inSerializer.GetSize();
+        }
+
+        uint8_t m_buffer[MaxBitPackedPropertySize + 16];
+    };
+
+    TEST_F(BitPackedNetworkPropertyTests, Quaternion_RoundTrip_UsesSmallestThree)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.001f, -1.0f, 1.0f };
+        const AZ::Quaternion inRotation = AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, 2.0f, 3.0f).GetNormalized(), 1.234f);
+        AZ::Quaternion outRotation = AZ::Quaternion::CreateIdentity();
+
+        // A 2 bit index and three 11 bit components
+        EXPECT_EQ(RoundTrip(inRotation, outRotation, settings), 5u);
+        EXPECT_TRUE(outRotation.IsClose(inRotation, 0.002f) || outRotation.IsClose(-inRotation, 0.002f));
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Integer_WithBounds_UsesBitsImpliedByBounds)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.0f, 0.0f, 1000.0f };
+        uint32_t outValue = 0;
+
+        // 10 bits
+        EXPECT_EQ(RoundTrip<uint32_t>(700, outValue, settings), 2u);
+        EXPECT_EQ(outValue, 700u);
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Integer_WithBounds_IsNoLargerThanByteAlignedSerializer)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.0f, 0.0f, 1000.0f };
+        uint32_t outValue = 0;
+
+        uint32_t byteAlignedValue = 700;
+        uint8_t byteAlignedBuffer[16];
+        AzNetworking::NetworkInputSerializer byteAlignedSerializer(byteAlignedBuffer, sizeof(byteAlignedBuffer));
+        static_cast<AzNetworking::ISerializer&>(byteAlignedSerializer).Serialize(byteAlignedValue, "Value", 0u, 1000u);
+        ASSERT_TRUE(byteAlignedSerializer.IsValid());
+
+        EXPECT_LE(RoundTrip<uint32_t>(700, outValue, settings), byteAlignedSerializer.GetSize());
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Integer_WithoutBounds_UsesFullRange)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.0f, AZStd::numeric_limits<float>::lowest(), AZStd::numeric_limits<float>::max() };
+        int32_t outValue = 0;
+
+        EXPECT_EQ(RoundTrip<int32_t>(AZStd::numeric_limits<int32_t>::lowest(), outValue, settings), 4u);
+        EXPECT_EQ(outValue, AZStd::numeric_limits<int32_t>::lowest());
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Bool_RoundTrip_UsesSingleByte)
+    {
+        const AzNetworking::QuantizationSettings settings{};
+        bool outValue = false;
+
+        EXPECT_EQ(RoundTrip(true, outValue, settings), 1u);
+        EXPECT_TRUE(outValue);
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Integer_OutsideBounds_InvalidatesSerializer)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.0f, 0.0f, 1000.0f };
+        uint32_t value = 2000;
+
+        AzNetworking::NetworkInputSerializer inSerializer(m_buffer, sizeof(m_buffer));
+        SerializeBitPackedNetworkProperty(inSerializer, value, "Value", settings);
+        EXPECT_FALSE(inSerializer.IsValid());
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, Float_WithPrecision_IsQuantizedOverBounds)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.01f, -10.0f, 10.0f };
+        float outValue = 0.0f;
+
+        // 2001 steps fit in 11 bits
+        EXPECT_EQ(RoundTrip(3.14159f, outValue, settings), 2u);
+        EXPECT_NEAR(outValue, 3.14159f, 0.005f);
+    }
+
+    TEST_F(BitPackedNetworkPropertyTests, TrackChangedSerializer_ComparesQuantizedValues)
+    {
+        const AzNetworking::QuantizationSettings settings{ 0.001f, -1.0f, 1.0f };
+        AZ::Quaternion inRotation = AZ::Quaternion::CreateRotationZ(0.5f);
+
+        AzNetworking::NetworkInputSerializer inSerializer(m_buffer, sizeof(m_buffer));
+        SerializeBitPackedNetworkProperty(inSerializer, inRotation, "Rotation", settings);
+        ASSERT_TRUE(inSerializer.IsValid());
+
+        // Receiving the value that is already held locally is not a change
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outSerializer(m_buffer, inSerializer.GetSize());
+            AzNetworking::ISerializer& outSerializerBase = outSerializer;
+            AZ::Quaternion localRotation = inRotation;
+            outSerializerBase.ClearTrackedChangesFlag();
+            SerializeBitPackedNetworkProperty(outSerializerBase, localRotation, "Rotation", settings);
+            EXPECT_TRUE(outSerializerBase.IsValid());
+            EXPECT_FALSE(outSerializerBase.GetTrackedChangesFlag());
+        }
+
+        // Receiving a different value is
+        {
+            AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> outSerializer(m_buffer, inSerializer.GetSize());
+            AzNetworking::ISerializer& outSerializerBase = outSerializer;
+            AZ::Quaternion localRotation = AZ::Quaternion::CreateRotationZ(-0.5f);
+            outSerializerBase.ClearTrackedChangesFlag();
+            SerializeBitPackedNetworkProperty(outSerializerBase, localRotation, "Rotation", settings);
+            EXPECT_TRUE(outSerializerBase.IsValid());
+            EXPECT_TRUE(outSerializerBase.GetTrackedChangesFlag());
+            EXPECT_TRUE(localRotation.IsClose(inRotation, 0.002f));
+        }
+    }
+
+    class BitPackedAutoComponentTests
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SetupAllocator();
+            AZ::NameDictionary::Create();
+            m_netComponent = new AzNetworking::NetworkingSystemComponent();
+            m_mpComponent = new Multiplayer::MultiplayerSystemComponent();
+            m_mpComponent->Activate();
+        }
+
+        void TearDown() override
+        {
+            m_mpComponent->Deactivate();
+            delete m_mpComponent;
+            delete m_netComponent;
+            AZ::NameDictionary::Destroy();
+            TeardownAllocator();
+        }
+
+        // The dirty enumeration is private to the generated source, these follow the property order in NetworkTransformComponent.AutoComponent.xml
+        static constexpr uint32_t AuthorityToClientPropertyCount = 6;
+        static constexpr uint32_t RotationDirtyBit = 0;
+
+        // A record with only the rotation property of NetworkTransformComponent marked dirty
+        static ReplicationRecord MakeRotationRecord()
+        {
+            ReplicationRecord record(NetEntityRole::Client);
+            record.m_authorityToClient.Resize(AuthorityToClientPropertyCount);
+            record.m_authorityToClient.SetBit(RotationDirtyBit, true);
+            return record;
+        }
+
+        AzNetworking::NetworkingSystemComponent* m_netComponent = nullptr;
+        Multiplayer::MultiplayerSystemComponent* m_mpComponent = nullptr;
+    };
+
+    TEST_F(BitPackedAutoComponentTests, NetworkTransformRotation_IsBitPacked)
+    {
+        // Build the stream the generated serializer should produce, using the settings declared in the AutoComponent xml
+        const AzNetworking::QuantizationSettings settings{ 0.001f, -1.0f, 1.0f };
+        AZ::Quaternion sentRotation = AZ::Quaternion::CreateRotationY(1.0f);
+        uint8_t sentBuffer[64];
+        AzNetworking::NetworkInputSerializer sentSerializer(sentBuffer, sizeof(sentBuffer));
+        SerializeBitPackedNetworkProperty(sentSerializer, sentRotation, "rotation", settings);
+        ASSERT_TRUE(sentSerializer.IsValid());
+
+        NetworkTransformComponent component;
+
+        // Apply the stream through the generated deserializer
+        ReplicationRecord receiveRecord = MakeRotationRecord();
+        AzNetworking::NetworkOutputSerializer receiveSerializer(sentBuffer, sentSerializer.GetSize());
+        EXPECT_TRUE(component.SerializeStateDeltaMessage(receiveRecord, receiveSerializer));
+        EXPECT_EQ(receiveSerializer.GetSize(), sentSerializer.GetSize());
+        EXPECT_TRUE(component.GetRotation().IsClose(sentRotation, 0.002f));
+
+        // The generated serializer packs the received value back into identical bytes
+        ReplicationRecord sendRecord = MakeRotationRecord();
+        uint8_t resentBuffer[64];
+        AzNetworking::NetworkInputSerializer resentSerializer(resentBuffer, sizeof(resentBuffer));
+        EXPECT_TRUE(component.SerializeStateDeltaMessage(sendRecord, resentSerializer));
+        ASSERT_EQ(resentSerializer.GetSize(), 5u);
+        ASSERT_EQ(resentSerializer.GetSize(), sentSerializer.GetSize());
+        EXPECT_EQ(memcmp(resentBuffer, sentBuffer, resentSerializer.GetSize()), 0);
+    }
+}
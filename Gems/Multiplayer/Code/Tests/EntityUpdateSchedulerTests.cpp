@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzTest/AzTest.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    // Provides the part of the EntityReplicator interface the scheduler uses
+    class TestReplicator
+    {
+    public:
+        TestReplicator(NetEntityRole remoteNetworkRole, float replicationPriority, uint32_t updateSize)
+            : m_remoteNetworkRole(remoteNetworkRole)
+        {
+            m_updatePriority.SetReplicationPriority(replicationPriority);
+            m_updatePriority.OnUpdateSent(updateSize);
+        }
+
+        NetEntityRole GetRemoteNetworkRole() const { return m_remoteNetworkRole; }
+        EntityUpdatePriority& GetUpdatePriority() { return m_updatePriority; }
+        const EntityUpdatePriority& GetUpdatePriority() const { return m_updatePriority; }
+
+    private:
+        NetEntityRole m_remoteNetworkRole;
+        EntityUpdatePriority m_updatePriority;
+    };
+
+    class EntityUpdateSchedulerTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t UpdateSize = 100;
+        static constexpr uint32_t MaxSendCount = 64;
+        static constexpr float MinPriority = 0.000001f;
+        static constexpr float StalenessPriority = 0.0001f;
+
+        using Scheduler = EntityUpdateScheduler<TestReplicator>;
+
+        void SetUp() override
+        {
+            SetupAllocator();
+            m_scheduler = AZStd::make_unique<Scheduler>();
+        }
+
+        void TearDown() override
+        {
+            m_scheduler.reset();
+            TeardownAllocator();
+        }
+
+        // Runs a single tick, sends whatever was selected and reports the actual bytes sent back to the scheduler
+        Scheduler::ReplicatorList Tick(const Scheduler::ReplicatorList& pending, uint32_t budgetBytes, uint32_t maxSendCount = MaxSendCount)
+        {
+            Scheduler::ReplicatorList toSendList = pending;
+            m_scheduler->SelectUpdates(toSendList, budgetBytes, maxSendCount, MinPriority, StalenessPriority);
+
+            uint32_t sentBytes = 0;
+            for (TestReplicator* replicator : toSendList)
+            {
+                sentBytes += UpdateSize;
+                replicator->GetUpdatePriority().OnUpdateSent(UpdateSize);
+            }
+            m_scheduler->OnUpdatesSent(sentBytes, budgetBytes);
+            return toSendList;
+        }
+
+        AZStd::unique_ptr<Scheduler> m_scheduler;
+    };
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_UnderBudget_HighestPriorityFirst)
+    {
+        TestReplicator low(NetEntityRole::Client, 0.1f, UpdateSize);
+        TestReplicator high(NetEntityRole::Client, 0.9f, UpdateSize);
+        TestReplicator medium(NetEntityRole::Client, 0.5f, UpdateSize);
+
+        // Only two of the three updates fit in the budget
+        const Scheduler::ReplicatorList sent = Tick({ &low, &high, &medium }, 2 * UpdateSize);
+        ASSERT_EQ(sent.size(), 2u);
+        EXPECT_EQ(sent[0], &high);
+        EXPECT_EQ(sent[1], &medium);
+
+        // The update left out keeps its accumulated priority, sent updates start over
+        EXPECT_GT(low.GetUpdatePriority().GetAccumulatedPriority(), 0.0f);
+        EXPECT_EQ(high.GetUpdatePriority().GetAccumulatedPriority(), 0.0f);
+        EXPECT_EQ(medium.GetUpdatePriority().GetAccumulatedPriority(), 0.0f);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_MaxSendCount_LimitsSelection)
+    {
+        TestReplicator first(NetEntityRole::Client, 0.9f, UpdateSize);
+        TestReplicator second(NetEntityRole::Client, 0.5f, UpdateSize);
+
+        const Scheduler::ReplicatorList sent = Tick({ &first, &second }, 10 * UpdateSize, 1);
+        ASSERT_EQ(sent.size(), 1u);
+        EXPECT_EQ(sent[0], &first);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_Autonomous_AlwaysSent)
+    {
+        TestReplicator client(NetEntityRole::Client, 0.9f, UpdateSize);
+        TestReplicator autonomous(NetEntityRole::Autonomous, 0.0f, 4 * UpdateSize);
+
+        // The autonomous update alone exceeds the budget, it is still sent and leaves no room for anything else
+        const Scheduler::ReplicatorList sent = Tick({ &client, &autonomous }, 2 * UpdateSize);
+        ASSERT_EQ(sent.size(), 1u);
+        EXPECT_EQ(sent[0], &autonomous);
+        EXPECT_GT(client.GetUpdatePriority().GetAccumulatedPriority(), 0.0f);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_BudgetSmallerThanUpdate_StillSendsOne)
+    {
+        TestReplicator large(NetEntityRole::Client, 0.5f, 10 * UpdateSize);
+
+        Scheduler::ReplicatorList toSendList = { &large };
+        m_scheduler->SelectUpdates(toSendList, UpdateSize, MaxSendCount, MinPriority, StalenessPriority);
+        ASSERT_EQ(toSendList.size(), 1u);
+        EXPECT_EQ(toSendList[0], &large);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, OnUpdatesSent_Overspend_DebtCappedAtOneTickBudget)
+    {
+        const uint32_t budgetBytes = 1000;
+
+        m_scheduler->OnUpdatesSent(budgetBytes + 300, budgetBytes);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), 300);
+
+        // A single huge update can't stall the connection for more than one tick
+        m_scheduler->OnUpdatesSent(10 * budgetBytes, budgetBytes);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), budgetBytes);
+
+        // Underspending pays the debt back, but never builds up credit
+        m_scheduler->OnUpdatesSent(0, budgetBytes);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), 0);
+        m_scheduler->OnUpdatesSent(0, budgetBytes);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), 0);
+
+        // Turning the budget off forgets any debt
+        m_scheduler->OnUpdatesSent(10 * budgetBytes, budgetBytes);
+        m_scheduler->OnUpdatesSent(10 * budgetBytes, 0);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), 0);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_WithDebt_SendsLess)
+    {
+        TestReplicator first(NetEntityRole::Client, 0.9f, UpdateSize);
+        TestReplicator second(NetEntityRole::Client, 0.5f, UpdateSize);
+
+        m_scheduler->OnUpdatesSent(3 * UpdateSize, 2 * UpdateSize);
+        EXPECT_EQ(m_scheduler->GetDebtBytes(), UpdateSize);
+
+        Scheduler::ReplicatorList toSendList = { &first, &second };
+        m_scheduler->SelectUpdates(toSendList, 2 * UpdateSize, MaxSendCount, MinPriority, StalenessPriority);
+        ASSERT_EQ(toSendList.size(), 1u);
+        EXPECT_EQ(toSendList[0], &first);
+    }
+
+    TEST_F(EntityUpdateSchedulerTests, SelectUpdates_LowPriorityEntity_IsNotStarved)
+    {
+        // A distant entity competes with a close one that always has a new update, and only one update fits per tick
+        TestReplicator close(NetEntityRole::Client, 1.0f, UpdateSize);
+        TestReplicator distant(NetEntityRole::Client, 0.0f, UpdateSize);
+
+        constexpr uint32_t MaxTicks = 1000;
+        uint32_t distantSentTick = MaxTicks;
+        for (uint32_t tick = 0; tick < MaxTicks; ++tick)
+        {
+            const Scheduler::ReplicatorList sent = Tick({ &close, &distant }, UpdateSize);
+            ASSERT_EQ(sent.size(), 1u);
+            if (sent[0] == &distant)
+            {
+                distantSentTick = tick;
+                break;
+            }
+        }
+
+        // The staleness term grows every tick the distant update waits, so it eventually outranks the close entity
+        EXPECT_LT(distantSentTick, MaxTicks);
+        EXPECT_EQ(distant.GetUpdatePriority().GetAccumulatedPriority(), 0.0f);
+    }
+}
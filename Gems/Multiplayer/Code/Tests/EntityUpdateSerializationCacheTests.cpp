@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzTest/AzTest.h>
+#include <Multiplayer/MultiplayerStats.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class EntityUpdateSerializationCacheTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr uint32_t BufferSize = 256;
+        static constexpr NetComponentId TestComponentId = NetComponentId{ 1 };
+
+        void SetUp() override
+        {
+            SetupAllocator();
+            m_cache = AZStd::make_unique<EntityUpdateSerializationCache>();
+            m_stats = AZStd::make_unique<MultiplayerStats>();
+            m_stats->ReserveComponentStats(TestComponentId, 2, 0);
+        }
+
+        void TearDown() override
+        {
+            m_stats.reset();
+            m_cache.reset();
+            TeardownAllocator();
+        }
+
+        ReplicationRecord MakeRecord(NetEntityRole remoteRole, uint32_t dirtyBit)
+        {
+            ReplicationRecord record(remoteRole);
+            record.m_authorityToClient.Resize(8);
+            record.m_authorityToClient.SetBit(dirtyBit, true);
+            return record;
+        }
+
+        // Stands in for NetBindComponent::SerializeStateDeltaMessage, writes a fixed payload and records two properties
+        void SerializeStateDelta(ReplicationRecord&, AzNetworking::NetworkInputSerializer& serializer)
+        {
+            ++m_stateDeltaSerializeCount;
+            AzNetworking::ISerializer& baseSerializer = serializer;
+            uint32_t firstProperty = m_firstPropertyValue;
+            uint32_t secondProperty = 0xC0FFEE;
+            baseSerializer.Serialize(firstProperty, "FirstProperty");
+            m_stats->RecordPropertySent(TestComponentId, PropertyIndex{ 0 }, sizeof(firstProperty));
+            baseSerializer.Serialize(secondProperty, "SecondProperty");
+            m_stats->RecordPropertySent(TestComponentId, PropertyIndex{ 1 }, sizeof(secondProperty));
+        }
+
+        bool SerializeUpdate(NetEntityId netEntityId, ReplicationRecord& record, AzNetworking::NetworkInputSerializer& serializer)
+        {
+            auto serializeStateDelta = [this](ReplicationRecord& stateDeltaRecord, AzNetworking::NetworkInputSerializer& stateDeltaSerializer)
+            {
+                SerializeStateDelta(stateDeltaRecord, stateDeltaSerializer);
+            };
+            return m_cache->SerializeUpdate(netEntityId, record, serializer, *m_stats, serializeStateDelta);
+        }
+
+        AZStd::unique_ptr<EntityUpdateSerializationCache> m_cache;
+        AZStd::unique_ptr<MultiplayerStats> m_stats;
+        uint32_t m_stateDeltaSerializeCount = 0;
+        uint32_t m_firstPropertyValue = 1234;
+    };
+
+    TEST_F(EntityUpdateSerializationCacheTests, SerializeUpdate_SameRecordTwice_CachedBytesMatchFreshSerialization)
+    {
+        const NetEntityId netEntityId = NetEntityId{ 1 };
+
+        uint8_t firstBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer firstSerializer(firstBuffer, BufferSize);
+        ReplicationRecord firstRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(netEntityId, firstRecord, firstSerializer));
+
+        uint8_t secondBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer secondSerializer(secondBuffer, BufferSize);
+        ReplicationRecord secondRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(netEntityId, secondRecord, secondSerializer));
+
+        // The second connection must reuse the cached state delta, and produce exactly the bytes it would have serialized itself
+        EXPECT_EQ(m_stateDeltaSerializeCount, 1);
+        ASSERT_EQ(firstSerializer.GetSize(), secondSerializer.GetSize());
+        EXPECT_EQ(memcmp(firstBuffer, secondBuffer, firstSerializer.GetSize()), 0);
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, SerializeUpdate_DifferentRoleRecordOrEntity_DoNotShareEntries)
+    {
+        uint8_t buffer[BufferSize];
+
+        ReplicationRecord clientRecord = MakeRecord(NetEntityRole::Client, 3);
+        AzNetworking::NetworkInputSerializer clientSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, clientRecord, clientSerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 1);
+
+        ReplicationRecord autonomousRecord = MakeRecord(NetEntityRole::Autonomous, 3);
+        AzNetworking::NetworkInputSerializer autonomousSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, autonomousRecord, autonomousSerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 2);
+
+        ReplicationRecord otherRecord = MakeRecord(NetEntityRole::Client, 5);
+        AzNetworking::NetworkInputSerializer otherRecordSerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, otherRecord, otherRecordSerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 3);
+
+        ReplicationRecord otherEntityRecord = MakeRecord(NetEntityRole::Client, 3);
+        AzNetworking::NetworkInputSerializer otherEntitySerializer(buffer, BufferSize);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 2 }, otherEntityRecord, otherEntitySerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 4);
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, SerializeUpdate_CacheHit_ReplaysPropertyStats)
+    {
+        uint8_t buffer[BufferSize];
+        for (uint32_t connection = 0; connection < 3; ++connection)
+        {
+            AzNetworking::NetworkInputSerializer serializer(buffer, BufferSize);
+            ReplicationRecord record = MakeRecord(NetEntityRole::Client, 3);
+            EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, record, serializer));
+        }
+
+        EXPECT_EQ(m_stateDeltaSerializeCount, 1);
+        EXPECT_EQ(m_stats->m_propertySentCapture, nullptr);
+        const MultiplayerStats::ComponentStats& componentStats = m_stats->m_componentStats[aznumeric_cast<uint16_t>(TestComponentId)];
+        EXPECT_EQ(componentStats.m_propertyUpdatesSent[0].m_totalCalls, 3);
+        EXPECT_EQ(componentStats.m_propertyUpdatesSent[0].m_totalBytes, 3 * sizeof(uint32_t));
+        EXPECT_EQ(componentStats.m_propertyUpdatesSent[1].m_totalCalls, 3);
+        EXPECT_EQ(componentStats.m_propertyUpdatesSent[1].m_totalBytes, 3 * sizeof(uint32_t));
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, SerializeUpdate_RecordDoesNotFit_NoEntryIsCached)
+    {
+        // Not even the record fits, so the state delta is never serialized
+        uint8_t tinyBuffer[1];
+        AzNetworking::NetworkInputSerializer tinySerializer(tinyBuffer, sizeof(tinyBuffer));
+        ReplicationRecord tinyRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_FALSE(SerializeUpdate(NetEntityId{ 1 }, tinyRecord, tinySerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 0);
+
+        uint8_t buffer[BufferSize];
+        AzNetworking::NetworkInputSerializer serializer(buffer, BufferSize);
+        ReplicationRecord record = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, record, serializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 1);
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, SerializeUpdate_StateDeltaOverflows_NoEntryIsCached)
+    {
+        // Find out how large the record is, then leave room for it but not for the whole state delta
+        uint8_t recordBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer recordSerializer(recordBuffer, BufferSize);
+        ReplicationRecord sizingRecord = MakeRecord(NetEntityRole::Client, 3);
+        sizingRecord.Serialize(recordSerializer);
+        const uint32_t recordSize = recordSerializer.GetSize();
+
+        uint8_t smallBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer smallSerializer(smallBuffer, recordSize + sizeof(uint32_t));
+        ReplicationRecord overflowRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_FALSE(SerializeUpdate(NetEntityId{ 1 }, overflowRecord, smallSerializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 1);
+        EXPECT_EQ(m_stats->m_propertySentCapture, nullptr);
+
+        // The partial update must not be reused, the next connection serializes the full state delta again
+        uint8_t buffer[BufferSize];
+        AzNetworking::NetworkInputSerializer serializer(buffer, BufferSize);
+        ReplicationRecord record = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, record, serializer));
+        EXPECT_EQ(m_stateDeltaSerializeCount, 2);
+        EXPECT_EQ(serializer.GetSize(), recordSize + 2 * sizeof(uint32_t));
+    }
+
+    TEST_F(EntityUpdateSerializationCacheTests, Clear_AfterPropertiesChange_SerializesFreshStateDelta)
+    {
+        uint8_t firstBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer firstSerializer(firstBuffer, BufferSize);
+        ReplicationRecord firstRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, firstRecord, firstSerializer));
+
+        m_cache->Clear();
+        m_firstPropertyValue = 5678;
+
+        uint8_t secondBuffer[BufferSize];
+        AzNetworking::NetworkInputSerializer secondSerializer(secondBuffer, BufferSize);
+        ReplicationRecord secondRecord = MakeRecord(NetEntityRole::Client, 3);
+        EXPECT_TRUE(SerializeUpdate(NetEntityId{ 1 }, secondRecord, secondSerializer));
+
+        EXPECT_EQ(m_stateDeltaSerializeCount, 2);
+        ASSERT_EQ(firstSerializer.GetSize(), secondSerializer.GetSize());
+        EXPECT_NE(memcmp(firstBuffer, secondBuffer, firstSerializer.GetSize()), 0);
+    }
+}
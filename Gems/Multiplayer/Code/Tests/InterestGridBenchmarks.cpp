@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    using namespace Multiplayer;
+
+    // 50k networked entities spread across a 4km square world and 1k clients gathered in groups of 20 around 50 points of interest,
+    // each client selecting its 512 highest priority entities within 500m the way InterestGridReplicationWindow does.
+    class BM_InterestGrid
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr uint32_t EntityCount = 50000;
+        static constexpr uint32_t ClientCount = 1000;
+        static constexpr uint32_t ClientsPerGroup = 20;
+        static constexpr float WorldSize = 4000.0f;
+        static constexpr float CellSize = 100.0f;
+        static constexpr float AwarenessRadius = 500.0f;
+        static constexpr size_t MaxEntitiesToTrack = 512;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_grid = AZStd::make_unique<InterestGrid>(CellSize);
+            m_entityPositions.reserve(EntityCount);
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                m_entityPositions.push_back(RandomPosition(0.0f, WorldSize));
+                m_grid->AddEntity(NetEntityId{ i }, m_entityPositions.back());
+            }
+
+            m_clientPositions.reserve(ClientCount);
+            AZ::Vector3 groupCenter = AZ::Vector3::CreateZero();
+            for (uint32_t i = 0; i < ClientCount; ++i)
+            {
+                if (i % ClientsPerGroup == 0)
+                {
+                    groupCenter = RandomPosition(AwarenessRadius, WorldSize - AwarenessRadius);
+                }
+                m_clientPositions.push_back(groupCenter + RandomPosition(-25.0f, 25.0f));
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_clientPositions = {};
+            m_entityPositions = {};
+            m_candidates = {};
+            m_grid.reset();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+        AZ::Vector3 RandomPosition(float minValue, float maxValue)
+        {
+            const float range = maxValue - minValue;
+            return AZ::Vector3(minValue + m_random.GetRandomFloat() * range, minValue + m_random.GetRandomFloat() * range, 0.0f);
+        }
+
+        void UpdateClient(const AZ::Vector3& clientPosition)
+        {
+            m_grid->GatherPrioritized(clientPosition, AwarenessRadius, m_candidates);
+            const size_t sortedCount = AZStd::min(MaxEntitiesToTrack, m_candidates.size());
+            AZStd::partial_sort(m_candidates.begin(), m_candidates.begin() + sortedCount, m_candidates.end(), AZStd::greater<InterestGrid::PrioritizedEntry>());
+            benchmark::DoNotOptimize(m_candidates.data());
+        }
+
+        AZ::SimpleLcgRandom m_random;
+        AZStd::unique_ptr<InterestGrid> m_grid;
+        AZStd::vector<AZ::Vector3> m_entityPositions;
+        AZStd::vector<AZ::Vector3> m_clientPositions;
+        InterestGrid::PrioritizedEntryList m_candidates;
+    };
+
+    BENCHMARK_F(BM_InterestGrid, UpdateAllClientsSharedQueries)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            m_grid->ClearQueryCache();
+            for (const AZ::Vector3& clientPosition : m_clientPositions)
+            {
+                UpdateClient(clientPosition);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * ClientCount);
+    }
+
+    BENCHMARK_F(BM_InterestGrid, UpdateAllClientsUnsharedQueries)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (const AZ::Vector3& clientPosition : m_clientPositions)
+            {
+                m_grid->ClearQueryCache();
+                UpdateClient(clientPosition);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * ClientCount);
+    }
+
+    BENCHMARK_F(BM_InterestGrid, MoveAllEntities)(benchmark::State& state)
+    {
+        const AZ::Vector3 offsets[2] = { AZ::Vector3(3.0f, 2.0f, 0.0f), AZ::Vector3(-3.0f, -2.0f, 0.0f) };
+        uint32_t frame = 0;
+        for (auto _ : state)
+        {
+            const AZ::Vector3& offset = offsets[frame++ & 1];
+            for (uint32_t i = 0; i < EntityCount; ++i)
+            {
+                m_entityPositions[i] += offset;
+                m_grid->MoveEntity(NetEntityId{ i }, m_entityPositions[i]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * EntityCount);
+    }
+}
+
+#endif
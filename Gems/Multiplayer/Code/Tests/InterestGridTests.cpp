@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/InterestGrid.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+namespace UnitTest
+{
+    using namespace Multiplayer;
+
+    class InterestGridTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr float CellSize = 10.0f;
+
+        static bool Contains(const InterestGrid::EntryList& entries, NetEntityId netEntityId)
+        {
+            return AZStd::find_if(entries.begin(), entries.end(), [netEntityId](const InterestGrid::Entry& entry) { return entry.m_netEntityId == netEntityId; }) != entries.end();
+        }
+
+        static bool Contains(const InterestGrid::PrioritizedEntryList& entries, NetEntityId netEntityId)
+        {
+            return AZStd::find_if(entries.begin(), entries.end(), [netEntityId](const InterestGrid::PrioritizedEntry& entry) { return entry.m_netEntityId == netEntityId; }) != entries.end();
+        }
+    };
+
+    TEST_F(InterestGridTests, AddMoveRemove)
+    {
+        InterestGrid grid(CellSize);
+        grid.AddEntity(NetEntityId{ 1 }, AZ::Vector3(1.0f, 1.0f, 0.0f));
+        grid.AddEntity(NetEntityId{ 2 }, AZ::Vector3(2.0f, 2.0f, 0.0f));
+        grid.AddEntity(NetEntityId{ 3 }, AZ::Vector3(500.0f, 500.0f, 0.0f));
+        EXPECT_EQ(grid.GetEntityCount(), 3u);
+
+        const InterestGrid::EntryList& nearOrigin = grid.Query(AZ::Vector3::CreateZero(), 5.0f);
+        EXPECT_EQ(nearOrigin.size(), 2u);
+        EXPECT_TRUE(Contains(nearOrigin, NetEntityId{ 1 }));
+        EXPECT_TRUE(Contains(nearOrigin, NetEntityId{ 2 }));
+
+        // Moving into another cell, then removing an entity, must keep the remaining entries consistent
+        grid.MoveEntity(NetEntityId{ 1 }, AZ::Vector3(501.0f, 501.0f, 0.0f));
+        grid.RemoveEntity(NetEntityId{ 2 });
+        EXPECT_EQ(grid.GetEntityCount(), 2u);
+        EXPECT_TRUE(grid.Query(AZ::Vector3::CreateZero(), 5.0f).empty());
+
+        const InterestGrid::EntryList& farAway = grid.Query(AZ::Vector3(500.0f, 500.0f, 0.0f), 5.0f);
+        EXPECT_EQ(farAway.size(), 2u);
+        EXPECT_TRUE(Contains(farAway, NetEntityId{ 1 }));
+        EXPECT_TRUE(Contains(farAway, NetEntityId{ 3 }));
+
+        grid.RemoveEntity(NetEntityId{ 3 });
+        EXPECT_TRUE(Contains(grid.Query(AZ::Vector3(500.0f, 500.0f, 0.0f), 5.0f), NetEntityId{ 1 }));
+    }
+
+    TEST_F(InterestGridTests, QueryCoversNegativeCoordinates)
+    {
+        InterestGrid grid(CellSize);
+        grid.AddEntity(NetEntityId{ 1 }, AZ::Vector3(-1.0f, -1.0f, 0.0f));
+        grid.AddEntity(NetEntityId{ 2 }, AZ::Vector3(-25.0f, 3.0f, 0.0f));
+
+        const InterestGrid::EntryList& entries = grid.Query(AZ::Vector3(1.0f, 1.0f, 0.0f), 30.0f);
+        EXPECT_TRUE(Contains(entries, NetEntityId{ 1 }));
+        EXPECT_TRUE(Contains(entries, NetEntityId{ 2 }));
+    }
+
+    TEST_F(InterestGridTests, QueriesFromSameCellShareResults)
+    {
+        InterestGrid grid(CellSize);
+        grid.AddEntity(NetEntityId{ 1 }, AZ::Vector3(15.0f, 15.0f, 0.0f));
+
+        const InterestGrid::EntryList& first = grid.Query(AZ::Vector3(1.0f, 1.0f, 0.0f), 20.0f);
+        const InterestGrid::EntryList& second = grid.Query(AZ::Vector3(9.0f, 9.0f, 0.0f), 20.0f);
+        EXPECT_EQ(&first, &second);
+        EXPECT_EQ(first.size(), 1u);
+
+        // Any change to the grid must invalidate the cached results
+        grid.AddEntity(NetEntityId{ 2 }, AZ::Vector3(5.0f, 5.0f, 0.0f));
+        EXPECT_EQ(grid.Query(AZ::Vector3(1.0f, 1.0f, 0.0f), 20.0f).size(), 2u);
+    }
+
+    TEST_F(InterestGridTests, GatherPrioritizedFiltersByRadius)
+    {
+        InterestGrid grid(CellSize);
+        grid.AddEntity(NetEntityId{ 1 }, AZ::Vector3(2.0f, 0.0f, 0.0f));
+        grid.AddEntity(NetEntityId{ 2 }, AZ::Vector3(4.0f, 0.0f, 0.0f));
+        grid.AddEntity(NetEntityId{ 3 }, AZ::Vector3(9.0f, 9.0f, 0.0f));
+
+        InterestGrid::PrioritizedEntryList prioritized;
+        grid.GatherPrioritized(AZ::Vector3::CreateZero(), 5.0f, prioritized);
+        ASSERT_EQ(prioritized.size(), 2u);
+        EXPECT_TRUE(Contains(prioritized, NetEntityId{ 1 }));
+        EXPECT_TRUE(Contains(prioritized, NetEntityId{ 2 }));
+        EXPECT_FALSE(Contains(prioritized, NetEntityId{ 3 }));
+
+        // Closer entities have a higher priority
+        AZStd::sort(prioritized.begin(), prioritized.end(), AZStd::greater<InterestGrid::PrioritizedEntry>());
+        EXPECT_EQ(prioritized[0].m_netEntityId, NetEntityId{ 1 });
+        EXPECT_FLOAT_EQ(prioritized[0].m_priority, 1.0f / 4.0f);
+    }
+}
@@ -11,9 +11,12 @@
 #include <AzCore/Name/Name.h>
 #include <AzFramework/Spawnable/SpawnableSystemComponent.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
 #include <AzTest/AzTest.h>
+#include <Multiplayer/NetworkEntity/EntityReplication/ReplicationRecord.h>
 #include <MultiplayerSystemComponent.h>
 #include <IMultiplayerConnectionMock.h>
+#include <Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h>
 
 namespace UnitTest
 {
@@ -105,5 +108,34 @@ namespace UnitTest
         m_mpComponent->OnDisconnect(&connMock1, AzNetworking::DisconnectReason::None, AzNetworking::TerminationEndpoint::Local);
         m_mpComponent->OnDisconnect(&connMock2, AzNetworking::DisconnectReason::None, AzNetworking::TerminationEndpoint::Local);
     }
-}
 
+    TEST_F(MultiplayerSystemTests, TestEntityUpdateSerializationCacheClearedOnTick)
+    {
+        Multiplayer::EntityUpdateSerializationCache* serializationCache = m_mpComponent->GetNetworkEntityManager()->GetEntityUpdateSerializationCache();
+        ASSERT_NE(serializationCache, nullptr);
+
+        uint32_t stateDeltaSerializeCount = 0;
+        auto serializeStateDelta = [&stateDeltaSerializeCount](Multiplayer::ReplicationRecord&, AzNetworking::NetworkInputSerializer&)
+        {
+            ++stateDeltaSerializeCount;
+        };
+        auto serializeUpdate = [this, serializationCache, &serializeStateDelta]()
+        {
+            uint8_t buffer[64];
+            AzNetworking::NetworkInputSerializer serializer(buffer, sizeof(buffer));
+            Multiplayer::ReplicationRecord record(Multiplayer::NetEntityRole::Client);
+            record.m_authorityToClient.Resize(8);
+            record.m_authorityToClient.SetBit(0, true);
+            return serializationCache->SerializeUpdate(Multiplayer::NetEntityId{ 1 }, record, serializer, m_mpComponent->GetStats(), serializeStateDelta);
+        };
+
+        EXPECT_TRUE(serializeUpdate());
+        EXPECT_TRUE(serializeUpdate());
+        EXPECT_EQ(stateDeltaSerializeCount, 1);
+
+        // Network properties may change between ticks, so nothing serialized before a tick may be reused after it
+        m_mpComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+        EXPECT_TRUE(serializeUpdate());
+        EXPECT_EQ(stateDeltaSerializeCount, 2);
+    }
+}
@@ -72,6 +72,10 @@ set(FILES
     Source/NetworkEntity/EntityReplication/EntityReplicator.cpp
     Source/NetworkEntity/EntityReplication/EntityReplicator.h
     Source/NetworkEntity/EntityReplication/EntityReplicator.inl
+    Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.h
+    Source/NetworkEntity/EntityReplication/EntityUpdateScheduler.inl
+    Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.cpp
+    Source/NetworkEntity/EntityReplication/EntityUpdateSerializationCache.h
     Source/NetworkEntity/EntityReplication/PropertyPublisher.cpp
     Source/NetworkEntity/EntityReplication/PropertyPublisher.h
     Source/NetworkEntity/EntityReplication/PropertySubscriber.cpp
@@ -105,6 +109,12 @@ set(FILES
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/Physics/PhysicsUtils.cpp
+    Source/ReplicationWindows/InterestGrid.cpp
+    Source/ReplicationWindows/InterestGrid.h
+    Source/ReplicationWindows/InterestGridManager.cpp
+    Source/ReplicationWindows/InterestGridManager.h
+    Source/ReplicationWindows/InterestGridReplicationWindow.cpp
+    Source/ReplicationWindows/InterestGridReplicationWindow.h
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
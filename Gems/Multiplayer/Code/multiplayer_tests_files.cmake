@@ -7,7 +7,12 @@
 
 set(FILES
     Tests/Main.cpp
+    Tests/BitPackedNetworkPropertyTests.cpp
+    Tests/EntityUpdateSchedulerTests.cpp
+    Tests/EntityUpdateSerializationCacheTests.cpp
     Tests/IMultiplayerConnectionMock.h
+    Tests/InterestGridBenchmarks.cpp
+    Tests/InterestGridTests.cpp
     Tests/MultiplayerSystemTests.cpp
     Tests/RewindableContainerTests.cpp
     Tests/RewindableObjectTests.cpp